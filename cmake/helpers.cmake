@@ -127,6 +127,23 @@ function(add_ur_executable name)
     add_ur_target_link_options(${name})
 endfunction()
 
+# Adds the microbenchmark bench-<name> when UR_BUILD_BENCHMARKS is set.
+# Benchmarks print their measurements and are run by hand, so they are never
+# registered with ctest.
+function(add_ur_benchmark name)
+    cmake_parse_arguments(ARG "" "" "SOURCES;INCLUDE_DIRS;LIBS" ${ARGN})
+    if(NOT UR_BUILD_BENCHMARKS)
+        return()
+    endif()
+    set(target bench-${name})
+    add_ur_executable(${target} ${ARG_SOURCES})
+    target_include_directories(${target} PRIVATE ${ARG_INCLUDE_DIRS})
+    target_link_libraries(${target} PRIVATE
+        ${PROJECT_NAME}::headers
+        ${ARG_LIBS}
+    )
+endfunction()
+
 function(add_ur_library name)
     add_library(${name} ${ARGN})
     add_ur_target_compile_options(${name})
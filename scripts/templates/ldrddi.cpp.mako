@@ -42,7 +42,10 @@ namespace ur_loader
 
         [[maybe_unused]] auto context = getContext();
         %if re.match(r"\w+AdapterGet$", th.make_func_name(n, tags, obj)):
-        
+
+        // Opens the adapters now if their loading was deferred.
+        context->loadLazyAdapters();
+
         size_t adapterIndex = 0;
         if( nullptr != ${obj['params'][1]['name']} && ${obj['params'][0]['name']} !=0)
         {
@@ -81,7 +84,7 @@ namespace ur_loader
         {
             // extract adapter's function pointer table
             auto dditable =
-                reinterpret_cast<${n}_platform_object_t *>( ${obj['params'][0]['name']}[adapter_index])->dditable;
+                ${n}_adapter_object_t::getDditable( ${obj['params'][0]['name']}[adapter_index] );
 
             if( ( 0 < ${obj['params'][2]['name']} ) && ( ${obj['params'][2]['name']} == total_platform_handle_count))
                 break;
@@ -124,7 +127,7 @@ namespace ur_loader
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
         %if not '_native_object_' in item['obj']:
         // extract platform's function pointer table
-        auto dditable = reinterpret_cast<${item['obj']}*>( ${item['pointer']}${item['name']} )->dditable;
+        auto dditable = ${item['obj']}::getDditable( ${item['pointer']}${item['name']} );
         auto ${th.make_pfn_name(n, tags, obj)} = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNINITIALIZED;
@@ -137,16 +140,16 @@ namespace ur_loader
         <%
         add_local = True
         param_replacements[item['name']] = item['name'] + 'Local.data()'%>// convert loader handles to platform handles
-        auto ${item['name']}Local = std::vector<${item['type']}>(${item['range'][1]});
+        auto ${item['name']}Local = handle_list_t<${item['type']}>(${item['range'][1]});
         for( size_t i = ${item['range'][0]}; i < ${item['range'][1]}; ++i )
-            ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
+            ${item['name']}Local[ i ] = ${item['obj']}::getHandle( ${item['name']}[ i ] );
         %else:
         %if not '_native_object_' in item['obj']:
         // convert loader handle to platform handle
         %if item['optional']:
-        ${item['name']} = ( ${item['name']} ) ? reinterpret_cast<${item['obj']}*>( ${item['name']} )->handle : nullptr;
+        ${item['name']} = ( ${item['name']} ) ? ${item['obj']}::getHandle( ${item['name']} ) : nullptr;
         %else:
-        ${item['name']} = reinterpret_cast<${item['obj']}*>( ${item['name']} )->handle;
+        ${item['name']} = ${item['obj']}::getHandle( ${item['name']} );
         %endif
         %endif
         %endif
@@ -211,9 +214,8 @@ namespace ur_loader
                     if(NewRangeStruct.${handle_member['parent']}${handle_member['name']})
                     %endif
                     NewRangeStruct.${handle_member['parent']}${handle_member['name']} =
-                        reinterpret_cast<${handle_member['obj_name']}*>(
-                            NewRangeStruct.${handle_member['parent']}${handle_member['name']})
-                            ->handle;
+                        ${handle_member['obj_name']}::getHandle(
+                            NewRangeStruct.${handle_member['parent']}${handle_member['name']});
                     %endfor
 
                     ${range_vector_name}.push_back(NewRangeStruct);
@@ -227,7 +229,7 @@ namespace ur_loader
                 range_vector_name = struct['name'] + parent_no_deref + member['name'] %>
                 std::vector<${member['type']}> ${range_vector_name};
                 for(uint32_t i = 0;i < ${struct['name']}->${member['parent']}${member['range_end']};i++) {
-                    ${range_vector_name}.push_back(reinterpret_cast<${member['obj_name']}*>(${struct['name']}->${member['parent']}${member['name']}[i])->handle);
+                    ${range_vector_name}.push_back(${member['obj_name']}::getHandle(${struct['name']}->${member['parent']}${member['name']}[i]));
                 }
                 ${struct['name']}Local.${member['parent']}${member['name']} = ${range_vector_name}.data();
             %else:
@@ -235,8 +237,8 @@ namespace ur_loader
                 if(${struct['name']}Local.${member['parent']}${member['name']})
                 %endif
                 ${struct['name']}Local.${member['parent']}${member['name']} =
-                    reinterpret_cast<${member['obj_name']}*>(
-                        ${struct['name']}Local.${member['parent']}${member['name']})->handle;
+                    ${member['obj_name']}::getHandle(
+                        ${struct['name']}Local.${member['parent']}${member['name']});
             %endif
         %endfor
         %endfor
@@ -331,6 +333,24 @@ namespace ur_loader
     %endif
 
     %endfor
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Fills the DDI tables of a platform opened after the loader's own
+    ///        tables were filled, by context_t::loadLazyAdapters
+    ${x}_result_t context_t::initPlatformDdiTables(platform_t &platform)
+    {
+    %for tbl in th.get_pfntables(specs, meta, n, tags):
+        if(platform.initStatus == ${X}_RESULT_SUCCESS)
+        {
+            auto getTable = reinterpret_cast<${tbl['pfn']}>(
+                LibLoader::getFunctionPtr(platform.handle.get(), "${tbl['export']['name']}"));
+            if(getTable)
+                platform.initStatus = getTable( version, &platform.dditable.${n}.${tbl['name']});
+        }
+
+    %endfor
+        return platform.initStatus;
+    }
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -39,7 +39,7 @@ namespace ur_loader
         _factory = re.sub(r"(\w+)_handle_t", r"\1_factory", _handle_t)
         factories.append((_factory_t, _factory))
     %>using ${th.append_ws(_object_t, 35)} = object_t < ${_handle_t} >;
-    using ${th.append_ws(_factory_t, 35)} = singleton_factory_t < ${_object_t}, ${_handle_t} >;
+    using ${th.append_ws(_factory_t, 35)} = handle_factory_t < ${_object_t}, ${_handle_t} >;
 
     %endif
     %endfor
@@ -42,18 +42,20 @@ namespace ur_tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !getContext()->isTraced(${th.make_func_etor(n, tags, obj)}) )
+            return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
         uint64_t instance = getContext()->notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params);
 
-        getContext()->logger.info("---> ${th.make_func_name(n, tags, obj)}");
+        auto &logger = getContext()->logger;
+        logger.info("---> ${th.make_func_name(n, tags, obj)}");
 
         ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 
         getContext()->notify_end(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params, &result, instance);
 
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, ${th.make_func_etor(n, tags, obj)}, &params);
-        getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+        logger.info("({}) -> {};\n", params_printer_t{${th.make_func_etor(n, tags, obj)}, &params}, result);
 
         return result;
     }
@@ -124,6 +126,17 @@ namespace ur_tracing_layer
 
         ur_tracing_layer::getContext()->codelocData = codelocData;
 
+        initTracing();
+    %for obj in th.get_adapter_functions(specs):
+    %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+    %endif
+        initTracedFunction(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}");
+    %if 'condition' in obj:
+    #endif
+    %endif
+    %endfor
+
     %for tbl in th.get_pfntables(specs, meta, n, tags):
         if( ${X}_RESULT_SUCCESS == result )
         {
@@ -8,186 +8,587 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <array>
+#include <cstring>
+
+#include "command_buffer.hpp"
 #include "common.hpp"
+#include "enqueue.hpp"
+#include "event.hpp"
+#include "memops.hpp"
+#include "memory.hpp"
+#include "queue.hpp"
+
+struct ur_exp_command_buffer_handle_t_::execution {
+  execution(ur_exp_command_buffer_handle_t commandBuffer,
+            ur_event_handle_t event)
+      : commandBuffer(commandBuffer), event(event),
+        remainingDeps(new std::atomic<uint32_t>[commandBuffer->nodes.size()]),
+        remainingNodes(commandBuffer->nodes.size()) {
+    for (size_t i = 0; i < commandBuffer->nodes.size(); i++) {
+      remainingDeps[i].store(commandBuffer->nodes[i].deps.size(),
+                             std::memory_order_relaxed);
+    }
+  }
+
+  void start(ur_exp_command_buffer_sync_point_t index) {
+    const node &n = commandBuffer->nodes[index];
+    auto &tp = commandBuffer->device->tp;
+    if (n.kernelCommand) {
+      auto *command = n.kernelCommand;
+      native_cpu::launch_desc *desc =
+          event->getQueue()->getLaunchDescs().acquire();
+      desc->capture(command->kernel, command->args);
+      desc->plan = &command->plan;
+      desc->done = [this, index]() { complete(index); };
+      native_cpu::launchKernel(*desc, tp, commandBuffer->device->localMem);
+    } else if (n.op) {
+      tp.schedule([this, index](size_t) {
+        commandBuffer->nodes[index].op();
+        complete(index);
+      });
+    } else {
+      complete(index);
+    }
+  }
+
+  void complete(ur_exp_command_buffer_sync_point_t index) {
+    for (auto successor : commandBuffer->nodes[index].successors) {
+      if (remainingDeps[successor].fetch_sub(1, std::memory_order_acq_rel) ==
+          1) {
+        start(successor);
+      }
+    }
+    if (remainingNodes.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      event->complete();
+      decrementOrDelete(commandBuffer);
+      delete this;
+    }
+  }
+
+  ur_exp_command_buffer_handle_t commandBuffer;
+  ur_event_handle_t event;
+  std::unique_ptr<std::atomic<uint32_t>[]> remainingDeps;
+  std::atomic<size_t> remainingNodes;
+};
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  for (auto &n : nodes) {
+    if (n.kernelCommand) {
+      decrementOrDelete(n.kernelCommand);
+    }
+  }
+  for (auto mem : memRefs) {
+    urMemRelease(mem);
+  }
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::addCommand(
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_command_handle_t kernelCommand,
+    std::function<void()> &&op, std::initializer_list<ur_mem_handle_t> mems) {
+  UR_ASSERT(!finalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_ASSERT(numSyncPointsInWaitList == 0 || pSyncPointWaitList,
+            UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP);
+
+  node n{kernelCommand, std::move(op), {}, {}};
+  for (uint32_t i = 0; i < numSyncPointsInWaitList; i++) {
+    UR_ASSERT(pSyncPointWaitList[i] < nodes.size(),
+              UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_EXP);
+    n.deps.push_back(pSyncPointWaitList[i]);
+  }
+  if (isInOrder && !nodes.empty()) {
+    n.deps.push_back(nodes.size() - 1);
+  }
 
-/// Stub implementations of UR experimental feature command-buffers
-/// Taken almost unchanged from another adapter. Perhaps going forward
-/// these stubs could be defined in core UR as the default which would
-/// reduce code duplication. Adapters could then "override" these defaults.
-/// Issue raised for this comment in
-/// https://github.com/oneapi-src/unified-runtime/issues/1064
+  const auto syncPoint =
+      static_cast<ur_exp_command_buffer_sync_point_t>(nodes.size());
+  nodes.push_back(std::move(n));
+  for (auto mem : mems) {
+    mem->_refCount++;
+    memRefs.push_back(mem);
+  }
+  if (pSyncPoint) {
+    *pSyncPoint = syncPoint;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::finalize() {
+  UR_ASSERT(!finalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  const size_t numParallelThreads = device->tp.num_threads();
+  for (size_t i = 0; i < nodes.size(); i++) {
+    auto &n = nodes[i];
+    const auto index = static_cast<ur_exp_command_buffer_sync_point_t>(i);
+    if (n.deps.empty()) {
+      roots.push_back(index);
+    }
+    for (auto dep : n.deps) {
+      nodes[dep].successors.push_back(index);
+    }
+    if (n.kernelCommand) {
+      n.kernelCommand->plan.reset(n.kernelCommand->ndr, numParallelThreads);
+    }
+  }
+  finalized = true;
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_exp_command_buffer_handle_t_::execute(ur_event_handle_t event) {
+  if (nodes.empty()) {
+    event->complete();
+    return;
+  }
+  // The command-buffer is kept alive until the execution has completed.
+  incrementReferenceCount();
+  auto *exec = new execution(this, event);
+  for (auto root : roots) {
+    exec->start(root);
+  }
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t, ur_device_handle_t,
-    const ur_exp_command_buffer_desc_t *, ur_exp_command_buffer_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+    ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  const bool isUpdatable =
+      pCommandBufferDesc ? pCommandBufferDesc->isUpdatable : false;
+  const bool isInOrder =
+      pCommandBufferDesc ? pCommandBufferDesc->isInOrder : false;
+  *phCommandBuffer = new ur_exp_command_buffer_handle_t_(
+      hContext, hDevice, isUpdatable, isInOrder);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hCommandBuffer->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  decrementOrDelete(hCommandBuffer);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  return hCommandBuffer->finalize();
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
-    ur_exp_command_buffer_handle_t, ur_kernel_handle_t, uint32_t,
-    const size_t *, const size_t *, const size_t *, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pGlobalWorkSize, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(!hCommandBuffer->isFinalized(), UR_RESULT_ERROR_INVALID_OPERATION);
+
+  if (hKernel->hasReqdWGSize() && pLocalWorkSize != nullptr) {
+    const auto &Reqd = hKernel->getReqdWGSize();
+    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
+      if (pLocalWorkSize[Dim] != Reqd[Dim]) {
+        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
+      }
+    }
+  }
+
+  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                           pLocalWorkSize);
+  if (auto result = native_cpu::reserveLocalMem(
+          hKernel->_args, hCommandBuffer->device->localMem);
+      result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  auto *command = new ur_exp_command_buffer_command_handle_t_(
+      hCommandBuffer, hKernel, ndr, pLocalWorkSize != nullptr);
+
+  auto result =
+      hCommandBuffer->addCommand(numSyncPointsInWaitList, pSyncPointWaitList,
+                                 pSyncPoint, command, nullptr);
+  if (result != UR_RESULT_SUCCESS) {
+    delete command;
+    return result;
+  }
+
+  if (phCommand) {
+    command->incrementReferenceCount();
+    hCommandBuffer->incrementReferenceCount();
+    *phCommand = command;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
+    size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      [pDst, pSrc, size]() { memcpy(pDst, pSrc, size); });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hSrcMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDstMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  const void *srcPtr = hSrcMem->_mem + srcOffset;
+  void *dstPtr = hDstMem->_mem + dstOffset;
+  return hCommandBuffer->addCommand(numSyncPointsInWaitList, pSyncPointWaitList,
+                                    pSyncPoint, nullptr,
+                                    [srcPtr, dstPtr, size]() {
+                                      if (srcPtr != dstPtr && size)
+                                        memmove(dstPtr, srcPtr, size);
+                                    },
+                                    {hSrcMem, hDstMem});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t,
-    ur_rect_offset_t, ur_rect_offset_t, ur_rect_region_t, size_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
+    ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
+    size_t srcSlicePitch, size_t dstRowPitch, size_t dstSlicePitch,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hSrcMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDstMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  const native_cpu::rect_desc srcRect{hSrcMem->_mem, srcOrigin, srcRowPitch,
+                                      srcSlicePitch};
+  const native_cpu::rect_desc dstRect{hDstMem->_mem, dstOrigin, dstRowPitch,
+                                      dstSlicePitch};
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      native_cpu::makeCopyRect(dstRect, srcRect, region, 1),
+      {hSrcMem, hDstMem});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t,
-    const void *, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, const void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  void *dstPtr = hBuffer->_mem + offset;
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      [dstPtr, pSrc, size]() { memcpy(dstPtr, pSrc, size); }, {hBuffer});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  const void *srcPtr = hBuffer->_mem + offset;
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      [pDst, srcPtr, size]() { memcpy(pDst, srcPtr, size); }, {hBuffer});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  const native_cpu::rect_desc bufferRect{hBuffer->_mem, bufferOffset,
+                                         bufferRowPitch, bufferSlicePitch};
+  const native_cpu::rect_desc hostRect{static_cast<char *>(pSrc), hostOffset,
+                                       hostRowPitch, hostSlicePitch};
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      native_cpu::makeCopyRect(bufferRect, hostRect, region, 1), {hBuffer});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pDst,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  const native_cpu::rect_desc bufferRect{hBuffer->_mem, bufferOffset,
+                                         bufferRowPitch, bufferSlicePitch};
+  const native_cpu::rect_desc hostRect{static_cast<char *>(pDst), hostOffset,
+                                       hostRowPitch, hostSlicePitch};
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      native_cpu::makeCopyRect(hostRect, bufferRect, region, 1), {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
-    ur_exp_command_buffer_handle_t, ur_queue_handle_t, uint32_t,
-    const ur_event_handle_t *, ur_event_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hCommandBuffer->isFinalized(),
+            UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_EXP);
+
+  // The command-buffer may be released before the command starts, so it is
+  // retained until then.
+  hCommandBuffer->incrementReferenceCount();
+  auto result = hQueue->enqueue(UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                [hCommandBuffer](ur_event_handle_t event) {
+                                  hCommandBuffer->execute(event);
+                                  decrementOrDelete(hCommandBuffer);
+                                });
+  if (result != UR_RESULT_SUCCESS) {
+    decrementOrDelete(hCommandBuffer);
+  }
+  return result;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, const void *, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    const void *pPattern, size_t patternSize, size_t offset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+
+  void *ptr = hBuffer->_mem + offset;
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      native_cpu::makeFill(ptr, pPattern, patternSize, size, 1), {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, size_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pMemory, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE);
+
+  return hCommandBuffer->addCommand(
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr,
+      native_cpu::makeFill(pMemory, pPattern, patternSize, size, 1));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t,
-    ur_usm_migration_flags_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = flags;
+
+  // Prefetches have no effect on the host, the command only orders the
+  // commands depending on it.
+  return hCommandBuffer->addCommand(numSyncPointsInWaitList, pSyncPointWaitList,
+                                    pSyncPoint, nullptr, nullptr);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t, ur_usm_advice_flags_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = advice;
+
+  return hCommandBuffer->addCommand(numSyncPointsInWaitList, pSyncPointWaitList,
+                                    pSyncPoint, nullptr, nullptr);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hCommand->incrementReferenceCount();
+  hCommand->commandBuffer->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // The command-buffer holds a reference to its commands, so the command is
+  // only deleted along with it.
+  ur_exp_command_buffer_handle_t commandBuffer = hCommand->commandBuffer;
+  decrementOrDelete(hCommand);
+  decrementOrDelete(commandBuffer);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
-    ur_exp_command_buffer_command_handle_t,
-    const ur_exp_command_buffer_update_kernel_launch_desc_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pUpdateKernelLaunch, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // Update requires the command-buffer to be finalized and created with
+  // update enabled. The command-buffer must not be executing while its
+  // commands are updated.
+  ur_exp_command_buffer_handle_t commandBuffer = hCommand->commandBuffer;
+  if (!commandBuffer->isFinalized() || !commandBuffer->isUpdatable) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  const uint32_t newWorkDim = pUpdateKernelLaunch->newWorkDim;
+  if (newWorkDim) {
+    if (newWorkDim != hCommand->ndr.WorkDim) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    if (pUpdateKernelLaunch->pNewLocalWorkSize &&
+        !pUpdateKernelLaunch->pNewGlobalWorkSize) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    if (hCommand->hasLocalSize !=
+        (pUpdateKernelLaunch->pNewLocalWorkSize != nullptr)) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+  }
+
+  auto &args = hCommand->args;
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewMemObjArgs; i++) {
+    const auto &argDesc = pUpdateKernelLaunch->pNewMemObjArgList[i];
+    UR_ASSERT(argDesc.argIndex < args.size(),
+              UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX);
+    args.setPointer(argDesc.argIndex, argDesc.hNewMemObjArg
+                                          ? argDesc.hNewMemObjArg->_mem
+                                          : nullptr);
+  }
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewPointerArgs; i++) {
+    const auto &argDesc = pUpdateKernelLaunch->pNewPointerArgList[i];
+    UR_ASSERT(argDesc.argIndex < args.size(),
+              UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX);
+    // pNewPointerArg points to the new pointer value
+    args.setPointer(argDesc.argIndex,
+                    *static_cast<void *const *>(argDesc.pNewPointerArg));
+  }
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewValueArgs; i++) {
+    const auto &argDesc = pUpdateKernelLaunch->pNewValueArgList[i];
+    UR_ASSERT(argDesc.argIndex < args.size(),
+              UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX);
+    args.setValue(argDesc.argIndex, argDesc.pNewValueArg, argDesc.argSize);
+  }
+
+  if (newWorkDim) {
+    auto &ndr = hCommand->ndr;
+    std::array<size_t, 3> globalOffset = ndr.GlobalOffset;
+    std::array<size_t, 3> globalSize = ndr.GlobalSize;
+    std::array<size_t, 3> localSize = ndr.LocalSize;
+    for (uint32_t dim = 0; dim < newWorkDim; dim++) {
+      if (pUpdateKernelLaunch->pNewGlobalWorkOffset) {
+        globalOffset[dim] = pUpdateKernelLaunch->pNewGlobalWorkOffset[dim];
+      }
+      if (pUpdateKernelLaunch->pNewGlobalWorkSize) {
+        globalSize[dim] = pUpdateKernelLaunch->pNewGlobalWorkSize[dim];
+      }
+      if (pUpdateKernelLaunch->pNewLocalWorkSize) {
+        localSize[dim] = pUpdateKernelLaunch->pNewLocalWorkSize[dim];
+      }
+    }
+    ndr = native_cpu::NDRDescT(
+        newWorkDim, globalOffset.data(), globalSize.data(),
+        hCommand->hasLocalSize ? localSize.data() : nullptr);
+    hCommand->plan.reset(ndr, commandBuffer->device->tp.num_threads());
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t, ur_exp_command_buffer_info_t, size_t,
-    void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    ur_exp_command_buffer_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommandBuffer->getReferenceCount()});
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
-    ur_exp_command_buffer_command_handle_t,
-    ur_exp_command_buffer_command_info_t, size_t, void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_exp_command_buffer_command_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommand->getReferenceCount()});
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
 }
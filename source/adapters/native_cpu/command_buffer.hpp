@@ -0,0 +1,105 @@
+//===--------- command_buffer.hpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include "common.hpp"
+#include "device.hpp"
+#include "enqueue.hpp"
+#include "kernel.hpp"
+#include "ur_api.h"
+
+// A kernel launch recorded in a command-buffer. Each reference to the command
+// held by the user also holds one to the command-buffer, so that it stays
+// alive until all its command handles are released.
+struct ur_exp_command_buffer_command_handle_t_ : RefCounted {
+  // Captures the arguments currently set on kernel, which is retained by the
+  // command.
+  ur_exp_command_buffer_command_handle_t_(
+      ur_exp_command_buffer_handle_t commandBuffer, ur_kernel_handle_t kernel,
+      const native_cpu::NDRDescT &ndr, bool hasLocalSize)
+      : commandBuffer(commandBuffer), kernel(kernel), args(kernel->_args),
+        ndr(ndr), hasLocalSize(hasLocalSize) {
+    kernel->incrementReferenceCount();
+  }
+
+  ~ur_exp_command_buffer_command_handle_t_() { decrementOrDelete(kernel); }
+
+  ur_exp_command_buffer_handle_t commandBuffer;
+  ur_kernel_handle_t kernel;
+  native_cpu::kernel_args args;
+  native_cpu::NDRDescT ndr;
+  bool hasLocalSize;
+  // Computed when the command-buffer is finalized, and again whenever the
+  // ND-range is updated.
+  native_cpu::launch_plan plan;
+};
+
+struct ur_exp_command_buffer_handle_t_ : RefCounted {
+  ur_exp_command_buffer_handle_t_(ur_context_handle_t context,
+                                  ur_device_handle_t device, bool isUpdatable,
+                                  bool isInOrder)
+      : context(context), device(device), isUpdatable(isUpdatable),
+        isInOrder(isInOrder) {}
+
+  ~ur_exp_command_buffer_handle_t_();
+
+  // Records a command, which runs once the commands of the sync points in the
+  // wait list have completed. Kernel launches are recorded as kernelCommand,
+  // other commands execute op on the threadpool, or nothing if it is empty.
+  // The memory objects in mems are retained until the command-buffer is
+  // released.
+  ur_result_t
+  addCommand(uint32_t numSyncPointsInWaitList,
+             const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+             ur_exp_command_buffer_sync_point_t *pSyncPoint,
+             ur_exp_command_buffer_command_handle_t kernelCommand,
+             std::function<void()> &&op,
+             std::initializer_list<ur_mem_handle_t> mems = {});
+
+  // Builds the execution graph and plans the kernel launches, so that
+  // replaying the command-buffer doesn't have to.
+  ur_result_t finalize();
+
+  // Runs the commands of the command-buffer, the event is completed once all
+  // of them have completed.
+  void execute(ur_event_handle_t event);
+
+  bool isFinalized() const noexcept { return finalized; }
+
+  const ur_context_handle_t context;
+  ur_device_handle_t_ *const device;
+  const bool isUpdatable;
+  const bool isInOrder;
+
+private:
+  // The state of one execution of the command-buffer.
+  struct execution;
+
+  struct node {
+    ur_exp_command_buffer_command_handle_t kernelCommand;
+    std::function<void()> op;
+    std::vector<ur_exp_command_buffer_sync_point_t> deps;
+    // The nodes depending on this one, built by finalize.
+    std::vector<ur_exp_command_buffer_sync_point_t> successors;
+  };
+
+  std::vector<node> nodes;
+  // The memory objects accessed by the recorded commands.
+  std::vector<ur_mem_handle_t> memRefs;
+  // The nodes without dependencies, built by finalize.
+  std::vector<ur_exp_command_buffer_sync_point_t> roots;
+  bool finalized = false;
+};
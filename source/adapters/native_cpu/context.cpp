@@ -25,8 +25,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
   assert(DeviceCount == 1);
 
   // TODO: Proper error checking.
-  auto ctx = new ur_context_handle_t_(*phDevices);
-  *phContext = ctx;
+  try {
+    *phContext = new ur_context_handle_t_(*phDevices);
+  } catch (ur_result_t Result) {
+    return Result;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -55,11 +60,8 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
   case UR_CONTEXT_INFO_REFERENCE_COUNT:
     return returnValue(uint32_t{hContext->getReferenceCount()});
   case UR_CONTEXT_INFO_USM_MEMCPY2D_SUPPORT:
-    return returnValue(true);
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
-    // case UR_CONTEXT_INFO_USM_MEMSET2D_SUPPORT:
-    // 2D USM operations currently not supported.
-    return returnValue(false);
+    return returnValue(true);
   case UR_CONTEXT_INFO_ATOMIC_MEMORY_ORDER_CAPABILITIES:
   case UR_CONTEXT_INFO_ATOMIC_MEMORY_SCOPE_CAPABILITIES:
   case UR_CONTEXT_INFO_ATOMIC_FENCE_ORDER_CAPABILITIES:
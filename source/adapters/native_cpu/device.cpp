@@ -8,6 +8,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
 #include <ur_api.h>
 
 #include "platform.hpp"
@@ -128,7 +131,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_TYPE:
     return ReturnValue(UR_DEVICE_TYPE_CPU);
   case UR_DEVICE_INFO_PARENT_DEVICE:
-    return ReturnValue(nullptr);
+    return ReturnValue(hDevice->Parent);
   case UR_DEVICE_INFO_PLATFORM:
     return ReturnValue(hDevice->Platform);
   case UR_DEVICE_INFO_NAME:
@@ -164,16 +167,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_LINKER_AVAILABLE:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_MAX_COMPUTE_UNITS:
+    // One compute unit per thread of the device, as placed on the host CPUs.
     return ReturnValue(static_cast<uint32_t>(hDevice->tp.num_threads()));
-  case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES:
-    return ReturnValue(uint32_t{0});
-  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS:
-    // TODO: Ensure this property is tested correctly
-    // Taken from CUDA ur adapter
-    if (pPropSizeRet) {
-      *pPropSizeRet = 0;
+  case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES: {
+    // Sub-devices have at least one thread each.
+    const size_t NumThreads = hDevice->tp.num_threads();
+    return ReturnValue(static_cast<uint32_t>(NumThreads > 1 ? NumThreads : 0));
+  }
+  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS: {
+    // SYCL spec says: if this SYCL device cannot be partitioned into at least
+    // two sub devices then the returned vector must be empty.
+    if (hDevice->tp.num_threads() < 2) {
+      if (pPropSizeRet) {
+        *pPropSizeRet = 0;
+      }
+      return UR_RESULT_SUCCESS;
     }
-    return UR_RESULT_SUCCESS;
+    const ur_device_partition_t Partitions[] = {
+        UR_DEVICE_PARTITION_EQUALLY, UR_DEVICE_PARTITION_BY_COUNTS,
+        UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN};
+    // Partitioning by affinity domain needs more than one NUMA node.
+    const size_t NumPartitions =
+        hDevice->tp.placement().numNodes > 1 ? 3 : 2;
+    return ReturnValue(Partitions, NumPartitions);
+  }
   case UR_DEVICE_INFO_VENDOR_ID:
     // '0x8086' : 'Intel HD graphics vendor ID'
     return ReturnValue(uint32_t{0x8086});
@@ -205,6 +222,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_WORK_ITEM_DIMENSIONS:
     return ReturnValue(uint32_t{3});
   case UR_DEVICE_INFO_PARTITION_TYPE:
+    if (hDevice->isSubDevice()) {
+      return ReturnValue(hDevice->PartitionProperty);
+    }
     if (pPropSizeRet) {
       *pPropSizeRet = 0;
     }
@@ -291,8 +311,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_GLOBAL_MEM_SIZE:
     return ReturnValue(hDevice->mem_size);
   case UR_DEVICE_INFO_LOCAL_MEM_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{32768});
+    return ReturnValue(uint64_t{native_cpu::maxLocalMemSize});
   case UR_DEVICE_INFO_MAX_CONSTANT_BUFFER_SIZE:
     // TODO : CHECK
     return ReturnValue(uint64_t{0});
@@ -304,9 +323,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(UR_DEVICE_LOCAL_MEM_TYPE_LOCAL);
   case UR_DEVICE_INFO_ERROR_CORRECTION_SUPPORT:
     return ReturnValue(bool{false});
-  case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION:
-    // TODO : CHECK
-    return ReturnValue(size_t{0});
+  case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION: {
+    // In nanoseconds, of the clock of the profiling timestamps.
+    using period = std::chrono::steady_clock::period;
+    return ReturnValue(
+        std::max(size_t{1}, size_t(period::num * 1000000000 / period::den)));
+  }
   case UR_DEVICE_INFO_BUILT_IN_KERNELS:
     // TODO : CHECK
     return ReturnValue("");
@@ -316,6 +338,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_PREFERRED_INTEROP_USER_SYNC:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN:
+    if (hDevice->tp.placement().numNodes > 1) {
+      return ReturnValue(ur_device_affinity_domain_flags_t{
+          UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA |
+          UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE});
+    }
     return ReturnValue(ur_device_affinity_domain_flags_t{0});
   case UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE: {
     size_t Global = hDevice->mem_size;
@@ -389,10 +416,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP:
   case UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
 
   case UR_DEVICE_INFO_TIMESTAMP_RECORDING_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
 
   case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP:
     return ReturnValue(false);
@@ -420,21 +447,31 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
     ur_device_handle_t hDevice,
     const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
     ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
-  std::ignore = hDevice;
-  std::ignore = NumDevices;
-  std::ignore = pProperties;
-  std::ignore = phSubDevices;
-  std::ignore = pNumDevicesRet;
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pProperties, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  const std::vector<ur_device_handle_t> *SubDevices = nullptr;
+  if (auto Result = hDevice->partition(*pProperties, SubDevices);
+      Result != UR_RESULT_SUCCESS) {
+    return Result;
+  }
+  if (pNumDevicesRet) {
+    *pNumDevicesRet = static_cast<uint32_t>(SubDevices->size());
+  }
+  if (phSubDevices) {
+    const size_t Count = std::min<size_t>(NumDevices, SubDevices->size());
+    std::copy_n(SubDevices->begin(), Count, phSubDevices);
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
     ur_device_handle_t hDevice, ur_native_handle_t *phNativeDevice) {
-  std::ignore = hDevice;
-  std::ignore = phNativeDevice;
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phNativeDevice, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION
+  *phNativeDevice = reinterpret_cast<ur_native_handle_t>(hDevice);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
@@ -452,19 +489,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
     uint64_t *pHostTimestamp) {
-  std::ignore = hDevice; // todo
+  std::ignore = hDevice;
+  // The device runs on the host, the profiling timestamps of its commands
+  // come from the same clock.
+  const uint64_t timestamp = native_cpu::getTimestamp();
   if (pHostTimestamp) {
-    using namespace std::chrono;
-    *pHostTimestamp =
-        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
-            .count();
+    *pHostTimestamp = timestamp;
   }
   if (pDeviceTimestamp) {
-    // todo: calculate elapsed time properly
-    using namespace std::chrono;
-    *pDeviceTimestamp =
-        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
-            .count();
+    *pDeviceTimestamp = timestamp;
   }
   return UR_RESULT_SUCCESS;
 }
@@ -494,4 +527,116 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
 }
 
 ur_device_handle_t_::ur_device_handle_t_(ur_platform_handle_t ArgPlt)
-    : mem_size(os_memory_bounded_size()), Platform(ArgPlt) {}
+    : tp(native_cpu::getThreadPlacement()), localMem(tp.num_threads()),
+      mem_size(os_memory_bounded_size()), Platform(ArgPlt) {}
+
+ur_device_handle_t_::ur_device_handle_t_(
+    ur_device_handle_t Parent, native_cpu::thread_placement Placement,
+    const ur_device_partition_property_t &PartitionProperty)
+    : tp(std::move(Placement)), localMem(tp.num_threads()),
+      mem_size(Parent->mem_size), Platform(Parent->Platform), Parent(Parent),
+      PartitionProperty(PartitionProperty) {}
+
+ur_result_t ur_device_handle_t_::partition(
+    const ur_device_partition_properties_t &Properties,
+    const std::vector<ur_device_handle_t> *&Result) {
+  UR_ASSERT(Properties.pProperties, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(Properties.PropCount, UR_RESULT_ERROR_INVALID_VALUE);
+  const native_cpu::thread_placement &Placement = tp.placement();
+  const size_t NumThreads = Placement.numThreads;
+  if (NumThreads < 2 || Placement.threadCpus.size() != NumThreads) {
+    return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+  }
+
+  partition_key_t Key;
+  for (size_t I = 0; I < Properties.PropCount; I++) {
+    const auto &Prop = Properties.pProperties[I];
+    Key.emplace_back(Prop.type, Prop.value.count);
+  }
+  std::lock_guard<std::mutex> Lock(SubDevicesMutex);
+  if (auto It = SubDeviceHandles.find(Key); It != SubDeviceHandles.end()) {
+    Result = &It->second;
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Threads are taken in NUMA node order, so that sub-devices don't span more
+  // nodes than they need to.
+  std::vector<size_t> Threads(NumThreads);
+  std::iota(Threads.begin(), Threads.end(), 0);
+  std::stable_sort(Threads.begin(), Threads.end(), [&](size_t L, size_t R) {
+    return Placement.threadCpus[L].node < Placement.threadCpus[R].node;
+  });
+
+  // The threads of each sub-device, and the property it reports.
+  std::vector<std::vector<size_t>> Groups;
+  std::vector<ur_device_partition_property_t> GroupProperties;
+  const ur_device_partition_property_t &First = Properties.pProperties[0];
+  switch (First.type) {
+  case UR_DEVICE_PARTITION_EQUALLY: {
+    const size_t PerSubDevice = First.value.equally;
+    UR_ASSERT(Properties.PropCount == 1 && PerSubDevice > 0,
+              UR_RESULT_ERROR_INVALID_VALUE);
+    if (PerSubDevice > NumThreads) {
+      return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+    }
+    for (size_t Begin = 0; Begin + PerSubDevice <= NumThreads;
+         Begin += PerSubDevice) {
+      Groups.emplace_back(Threads.begin() + Begin,
+                          Threads.begin() + Begin + PerSubDevice);
+      GroupProperties.push_back(First);
+    }
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_COUNTS: {
+    size_t Begin = 0;
+    for (size_t I = 0; I < Properties.PropCount; I++) {
+      const auto &Prop = Properties.pProperties[I];
+      UR_ASSERT(Prop.type == UR_DEVICE_PARTITION_BY_COUNTS,
+                UR_RESULT_ERROR_INVALID_VALUE);
+      const size_t Count = Prop.value.count;
+      if (Count == 0 || Begin + Count > NumThreads) {
+        return UR_RESULT_ERROR_INVALID_DEVICE_PARTITION_COUNT;
+      }
+      Groups.emplace_back(Threads.begin() + Begin,
+                          Threads.begin() + Begin + Count);
+      GroupProperties.push_back(Prop);
+      Begin += Count;
+    }
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN: {
+    UR_ASSERT(Properties.PropCount == 1, UR_RESULT_ERROR_INVALID_VALUE);
+    // NUMA nodes are the only affinity domain, and so the next partitionable
+    // one.
+    if (First.value.affinity_domain != UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA &&
+        First.value.affinity_domain !=
+            UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE) {
+      return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+    if (Placement.numNodes < 2) {
+      return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+    }
+    for (size_t Thread : Threads) {
+      if (Groups.empty() ||
+          Placement.threadCpus[Groups.back().front()].node !=
+              Placement.threadCpus[Thread].node) {
+        Groups.emplace_back();
+        GroupProperties.push_back(First);
+      }
+      Groups.back().push_back(Thread);
+    }
+    break;
+  }
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
+
+  std::vector<ur_device_handle_t> &Handles = SubDeviceHandles[Key];
+  for (size_t I = 0; I < Groups.size(); I++) {
+    SubDevices.push_back(std::make_unique<ur_device_handle_t_>(
+        this, Placement.select(Groups[I]), GroupProperties[I]));
+    Handles.push_back(SubDevices.back().get());
+  }
+  Result = &Handles;
+  return UR_RESULT_SUCCESS;
+}
@@ -10,13 +10,44 @@
 
 #pragma once
 
+#include "local_mem.hpp"
 #include "threadpool.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ur/ur.hpp>
+#include <utility>
+#include <vector>
 
 struct ur_device_handle_t_ {
   native_cpu::threadpool_t tp;
+  // Local memory of the work-groups run by the threads of tp.
+  native_cpu::local_mem_arena localMem;
   ur_device_handle_t_(ur_platform_handle_t ArgPlt);
 
+  // Creates a sub-device of Parent, running its own threads as placed.
+  ur_device_handle_t_(ur_device_handle_t Parent,
+                      native_cpu::thread_placement Placement,
+                      const ur_device_partition_property_t &PartitionProperty);
+
+  // Returns the sub-devices for the partition properties. They are created on
+  // the first request and owned by this device, so repeated requests return
+  // the same handles.
+  ur_result_t partition(const ur_device_partition_properties_t &Properties,
+                        const std::vector<ur_device_handle_t> *&SubDevices);
+
+  bool isSubDevice() const noexcept { return Parent != nullptr; }
+
   const uint64_t mem_size;
   ur_platform_handle_t Platform;
+  const ur_device_handle_t Parent = nullptr;
+  // How this sub-device was created from its parent.
+  const ur_device_partition_property_t PartitionProperty{};
+
+private:
+  using partition_key_t = std::vector<std::pair<ur_device_partition_t, uint32_t>>;
+
+  std::mutex SubDevicesMutex;
+  std::map<partition_key_t, std::vector<ur_device_handle_t>> SubDeviceHandles;
+  std::vector<std::unique_ptr<ur_device_handle_t_>> SubDevices;
 };
@@ -5,51 +5,32 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //===----------------------------------------------------------------------===//
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
 #include <vector>
 
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "enqueue.hpp"
+#include "event.hpp"
 #include "kernel.hpp"
+#include "memops.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
 #include "threadpool.hpp"
+#include "ur_util.hpp"
 
-namespace native_cpu {
-struct NDRDescT {
-  using RangeT = std::array<size_t, 3>;
-  uint32_t WorkDim;
-  RangeT GlobalOffset;
-  RangeT GlobalSize;
-  RangeT LocalSize;
-  NDRDescT(uint32_t WorkDim, const size_t *GlobalWorkOffset,
-           const size_t *GlobalWorkSize, const size_t *LocalWorkSize)
-      : WorkDim(WorkDim) {
-    for (uint32_t I = 0; I < WorkDim; I++) {
-      GlobalOffset[I] = GlobalWorkOffset[I];
-      GlobalSize[I] = GlobalWorkSize[I];
-      LocalSize[I] = LocalWorkSize ? LocalWorkSize[I] : 1;
-    }
-    for (uint32_t I = WorkDim; I < 3; I++) {
-      GlobalSize[I] = 1;
-      LocalSize[I] = LocalSize[0] ? 1 : 0;
-      GlobalOffset[I] = 0;
-    }
-  }
-
-  void dump(std::ostream &os) const {
-    os << "GlobalSize: " << GlobalSize[0] << " " << GlobalSize[1] << " "
-       << GlobalSize[2] << "\n";
-    os << "LocalSize: " << LocalSize[0] << " " << LocalSize[1] << " "
-       << LocalSize[2] << "\n";
-    os << "GlobalOffset: " << GlobalOffset[0] << " " << GlobalOffset[1] << " "
-       << GlobalOffset[2] << "\n";
-  }
-};
-} // namespace native_cpu
+#ifdef __linux__
+#include <unistd.h>
+#endif
 
 #ifdef NATIVECPU_USE_OCK
 static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
@@ -62,277 +43,612 @@ static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
 }
 #endif
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
-    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
-    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
-    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+static native_cpu::state getState(const native_cpu::NDRDescT &ndr) {
+  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
+                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
+                          ndr.LocalSize[2], ndr.GlobalOffset[0],
+                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
+  return state;
+}
 
-  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+namespace native_cpu {
+#ifdef NATIVECPU_USE_OCK
+namespace {
+// Rough estimate of the memory touched by a work-item, used to size the tiles
+// from the cache size.
+constexpr size_t bytesPerItem = 16;
+// Shortest run of work-items along dimension 0 in a tile, so that tiles cover
+// whole cache lines and leave room for vectorization.
+constexpr size_t minRowItems = 64;
+// Rows in each of dimensions 1 and 2 that a tile leaves room for, so that
+// stencils reuse the neighbouring rows from the cache.
+constexpr size_t minOuterExtent = 8;
+// Tiles per thread aimed for, so that threads finishing early can claim more.
+constexpr size_t minTilesPerThread = 4;
+
+struct partition_config {
+  partitioning policy = partitioning::tiled;
+  // Number of work-items aimed for in a tile.
+  size_t tileItems = 0;
+};
 
-  if (*pGlobalWorkSize == 0) {
-    DIE_NO_IMPLEMENTATION;
+size_t getCacheSize() {
+#if defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+  long size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (size > 0) {
+    return size;
   }
+#endif
+  return 1 << 20;
+}
 
-  // Check reqd_work_group_size
-  if (hKernel->hasReqdWGSize() && pLocalWorkSize != nullptr) {
-    const auto &Reqd = hKernel->getReqdWGSize();
-    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
-      if (pLocalWorkSize[Dim] != Reqd[Dim]) {
-        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
+const partition_config &getPartitionConfig() {
+  static const partition_config config = []() {
+    partition_config config;
+    if (auto policy = ur_getenv("SYCL_NATIVE_CPU_PARTITION")) {
+      if (*policy == "rows") {
+        config.policy = partitioning::rows;
+      } else if (*policy == "static") {
+        config.policy = partitioning::static_tiles;
+      } else if (*policy != "tiled") {
+        logger::warning("Ignoring unknown SYCL_NATIVE_CPU_PARTITION value "
+                        "\"{}\", expected tiled, rows or static",
+                        *policy);
       }
     }
+    // Aim for tiles using half of the cache, leaving the other half to the
+    // data that isn't indexed by the work-item.
+    config.tileItems =
+        getenv_to_unsigned("SYCL_NATIVE_CPU_TILE_ITEMS")
+            .value_or(std::max<size_t>(1, getCacheSize() / 2 / bytesPerItem));
+    return config;
+  }();
+  return config;
+}
+
+size_t countTiles(const NDRDescT::RangeT &numGroups,
+                  const NDRDescT::RangeT &shape) {
+  size_t count = 1;
+  for (size_t dim = 0; dim < 3; dim++) {
+    count *= (numGroups[dim] + shape[dim] - 1) / shape[dim];
   }
+  return count;
+}
 
-  // TODO: add proper error checking
-  // TODO: add proper event dep management
-  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
-                           pLocalWorkSize);
-  auto &tp = hQueue->device->tp;
-  const size_t numParallelThreads = tp.num_threads();
-  hKernel->updateMemPool(numParallelThreads);
-  std::vector<std::future<void>> futures;
-  std::vector<std::function<void(size_t, ur_kernel_handle_t_)>> groups;
-  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
-  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
-  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
-  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
-                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
-                          ndr.LocalSize[2], ndr.GlobalOffset[0],
-                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
-#ifndef NATIVECPU_USE_OCK
-  hKernel->handleLocalArgs(1, 0);
-  for (unsigned g2 = 0; g2 < numWG2; g2++) {
-    for (unsigned g1 = 0; g1 < numWG1; g1++) {
-      for (unsigned g0 = 0; g0 < numWG0; g0++) {
-        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
-          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
-            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
-              state.update(g0, g1, g2, local0, local1, local2);
-              hKernel->_subhandler(hKernel->_args.data(), &state);
-            }
-          }
-        }
+// Computes the shape, in work-groups of groupSize work-items, of the tiles
+// over a grid of numGroups work-groups.
+NDRDescT::RangeT computeTileShape(const NDRDescT::RangeT &numGroups,
+                                  const NDRDescT::RangeT &groupSize,
+                                  size_t numThreads,
+                                  const partition_config &config) {
+  NDRDescT::RangeT shape{1, 1, 1};
+  if (config.policy == partitioning::rows) {
+    shape[0] = numGroups[0];
+  } else {
+    // Rows along dimension 0 are contiguous in memory, so they get as much of
+    // the tile as leaves room for a few rows in each other dimension. The
+    // rest is shared between dimensions 1 and 2, smallest first so that what
+    // a small dimension can't use goes to the larger one.
+    const size_t numOuterDims = (numGroups[1] > 1) + (numGroups[2] > 1);
+    size_t rowItems = config.tileItems;
+    for (size_t dim = 0; dim < numOuterDims; dim++) {
+      rowItems /= minOuterExtent;
+    }
+    rowItems = std::max(rowItems, minRowItems);
+    shape[0] = std::clamp<size_t>((rowItems + groupSize[0] - 1) / groupSize[0],
+                                  1, numGroups[0]);
+    size_t budget =
+        std::max<size_t>(1, config.tileItems / (shape[0] * groupSize[0]));
+    size_t outerDims[] = {1, 2};
+    if (numGroups[2] * groupSize[2] < numGroups[1] * groupSize[1]) {
+      std::swap(outerDims[0], outerDims[1]);
+    }
+    size_t numDims = numOuterDims;
+    for (size_t dim : outerDims) {
+      if (numGroups[dim] <= 1) {
+        continue;
       }
+      size_t items = numDims == 1
+                         ? budget
+                         : size_t(std::sqrt(double(budget)));
+      shape[dim] = std::clamp<size_t>((items + groupSize[dim] - 1) /
+                                          groupSize[dim],
+                                      1, numGroups[dim]);
+      budget = std::max<size_t>(1, budget / (shape[dim] * groupSize[dim]));
+      numDims--;
     }
   }
-#else
+  // Split the tiles further while there are too few of them to balance the
+  // load between the threads. Dimension 0 is split last, to keep long runs of
+  // contiguous work-items.
+  while (countTiles(numGroups, shape) < numThreads * minTilesPerThread) {
+    size_t dim = shape[2] >= shape[1] ? 2 : 1;
+    if (shape[dim] == 1) {
+      dim = 0;
+    }
+    if (shape[dim] == 1) {
+      break;
+    }
+    shape[dim] = (shape[dim] + 1) / 2;
+  }
+  return shape;
+}
+} // namespace
+#endif // NATIVECPU_USE_OCK
+
+void launch_plan::reset(const NDRDescT &newNdr, size_t newNumParallelThreads) {
+  if (ndr.WorkDim && ndr == newNdr &&
+      numParallelThreads == newNumParallelThreads) {
+    return;
+  }
+  ndr = newNdr;
+  numParallelThreads = newNumParallelThreads;
+  itemsPerGroup = 0;
+  groups = {};
+  peeled = {};
+  for (size_t dim = 0; dim < 3; dim++) {
+    numGroups[dim] = ndr.GlobalSize[dim] / ndr.LocalSize[dim];
+  }
+#ifdef NATIVECPU_USE_OCK
+  const partition_config &config = getPartitionConfig();
+  policy = config.policy;
   bool isLocalSizeOne =
       ndr.LocalSize[0] == 1 && ndr.LocalSize[1] == 1 && ndr.LocalSize[2] == 1;
-  if (isLocalSizeOne && ndr.GlobalSize[0] > numParallelThreads) {
+  if (isLocalSizeOne) {
     // If the local size is one, we make the assumption that we are running a
     // parallel_for over a sycl::range.
     // Todo: we could add compiler checks and
     // kernel properties for this (e.g. check that no barriers are called, no
     // local memory args).
 
-    // Todo: this assumes that dim 0 is the best dimension over which we want to
-    // parallelize
-
     // Since we also vectorize the kernel, and vectorization happens within the
-    // work group loop, it's better to have a large-ish local size. We can
-    // divide the global range by the number of threads, set that as the local
-    // size and peel everything else.
-
-    size_t new_num_work_groups_0 = numParallelThreads;
-    size_t itemsPerThread = ndr.GlobalSize[0] / numParallelThreads;
-
-    for (unsigned g2 = 0; g2 < numWG2; g2++) {
-      for (unsigned g1 = 0; g1 < numWG1; g1++) {
-        for (unsigned g0 = 0; g0 < new_num_work_groups_0; g0 += 1) {
-          futures.emplace_back(
-              tp.schedule_task([&ndr = std::as_const(ndr), itemsPerThread,
-                                hKernel, g0, g1, g2](size_t) {
-                native_cpu::state resized_state =
-                    getResizedState(ndr, itemsPerThread);
-                resized_state.update(g0, g1, g2);
-                hKernel->_subhandler(hKernel->_args.data(), &resized_state);
-              }));
-        }
-        // Peel the remaining work items. Since the local size is 1, we iterate
-        // over the work groups.
-        for (unsigned g0 = new_num_work_groups_0 * itemsPerThread; g0 < numWG0;
-             g0++) {
-          state.update(g0, g1, g2);
-          hKernel->_subhandler(hKernel->_args.data(), &state);
-        }
+    // work group loop, it's better to have a large-ish local size. The tiles
+    // are computed over work-items, and the extent of a tile in dimension 0
+    // becomes the local size. The remaining work-items are peeled.
+    NDRDescT::RangeT shape =
+        computeTileShape(numGroups, {1, 1, 1}, numParallelThreads, config);
+    itemsPerGroup = shape[0];
+    groups.numGroups = {numGroups[0] / itemsPerGroup, numGroups[1],
+                        numGroups[2]};
+    groups.setTiles({1, shape[1], shape[2]});
+    if (size_t numPeeled = numGroups[0] % itemsPerGroup) {
+      peeled.firstGroup0 = groups.numGroups[0] * itemsPerGroup;
+      peeled.numGroups = {numPeeled, numGroups[1], numGroups[2]};
+      peeled.setTiles({numPeeled, shape[1], shape[2]});
+    }
+  } else {
+    // We are running a parallel_for over an nd_range.
+    groups.numGroups = numGroups;
+    groups.setTiles(computeTileShape(numGroups, ndr.LocalSize,
+                                     numParallelThreads, config));
+  }
+#endif // NATIVECPU_USE_OCK
+}
+
+void launch_desc::capture(ur_kernel_handle_t kernel,
+                          const kernel_args &args) {
+  kernel->incrementReferenceCount();
+  this->kernel = kernel;
+  this->args = args;
+}
+
+launch_desc *launch_desc_pool::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!freeDescs.empty()) {
+      launch_desc *desc = freeDescs.back().release();
+      freeDescs.pop_back();
+      return desc;
+    }
+  }
+  auto *desc = new launch_desc();
+  desc->pool = this;
+  return desc;
+}
+
+void launch_desc_pool::release(launch_desc *desc) {
+  decrementOrDelete(desc->kernel);
+  desc->kernel = nullptr;
+  std::lock_guard<std::mutex> lock(mutex);
+  freeDescs.emplace_back(desc);
+}
+
+// Releases the descriptor of a launch whose work-groups have all run, and
+// signals its completion.
+static void finishLaunch(launch_desc &desc) {
+  std::function<void()> done;
+  done.swap(desc.done);
+  desc.pool->release(&desc);
+  done();
+}
+
+#ifdef NATIVECPU_USE_OCK
+// Runs the work-groups of a tile of grid.
+static void runTile(native_cpu::state &state, const ur_kernel_handle_t_ &kernel,
+                    const NativeCPUArgDesc *args,
+                    const launch_plan::grid &grid, size_t tile) {
+  const size_t tile0 = tile % grid.numTiles[0];
+  const size_t tile1 = (tile / grid.numTiles[0]) % grid.numTiles[1];
+  const size_t tile2 = tile / (grid.numTiles[0] * grid.numTiles[1]);
+  const size_t begin0 = tile0 * grid.tileShape[0];
+  const size_t begin1 = tile1 * grid.tileShape[1];
+  const size_t begin2 = tile2 * grid.tileShape[2];
+  const size_t end0 = std::min(begin0 + grid.tileShape[0], grid.numGroups[0]);
+  const size_t end1 = std::min(begin1 + grid.tileShape[1], grid.numGroups[1]);
+  const size_t end2 = std::min(begin2 + grid.tileShape[2], grid.numGroups[2]);
+  for (size_t g2 = begin2; g2 < end2; g2++) {
+    for (size_t g1 = begin1; g1 < end1; g1++) {
+      for (size_t g0 = begin0; g0 < end0; g0++) {
+        state.update(grid.firstGroup0 + g0, g1, g2);
+        kernel._subhandler(args, &state);
       }
     }
+  }
+}
 
-  } else {
-    // We are running a parallel_for over an nd_range
-
-    if (numWG1 * numWG2 >= numParallelThreads) {
-      // Dimensions 1 and 2 have enough work, split them across the threadpool
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          futures.emplace_back(
-              tp.schedule_task([state, kernel = *hKernel, numWG0, g1, g2,
-                                numParallelThreads](size_t threadId) mutable {
-                for (unsigned g0 = 0; g0 < numWG0; g0++) {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                }
-              }));
-        }
+// Claims the next chunk of tiles of a launch, returns the number of tiles
+// claimed starting at first, or zero once all of them have been claimed.
+static size_t claimTiles(launch_desc &desc, size_t &first) {
+  const launch_plan &plan = *desc.plan;
+  const size_t numTiles = plan.numTiles();
+  size_t next = desc.nextTile.load(std::memory_order_relaxed);
+  size_t count;
+  do {
+    if (next >= numTiles) {
+      return 0;
+    }
+    count = std::min(plan.chunkSize(numTiles - next), numTiles - next);
+  } while (!desc.nextTile.compare_exchange_weak(next, next + count,
+                                                std::memory_order_relaxed));
+  first = next;
+  return count;
+}
+
+// Body of the workers of a launch, they claim chunks of tiles of the plan
+// until all of them have been claimed.
+static void runLaunchWorker(intrusive_task *task, size_t threadId) {
+  launch_desc &desc = *static_cast<launch_desc::worker *>(task)->desc;
+  const launch_plan &plan = *desc.plan;
+  const ur_kernel_handle_t_ &kernel = *desc.kernel;
+
+  const NativeCPUArgDesc *args = desc.args.data();
+  if (!desc.args.localArgs().empty()) {
+    // Point the local arguments to the memory of this thread, once for all
+    // the work-groups it runs.
+    NativeCPUArgDesc *threadArgs =
+        desc.threadArgs.data() + threadId * desc.args.size();
+    std::copy(args, args + desc.args.size(), threadArgs);
+    desc.args.bindLocalArgs(threadArgs, desc.localMem->get(threadId));
+    args = threadArgs;
+  }
+
+  // The tiles of the peeled grid are numbered after those of the main grid.
+  native_cpu::state groupState =
+      plan.itemsPerGroup ? getResizedState(plan.ndr, plan.itemsPerGroup)
+                         : getState(plan.ndr);
+  native_cpu::state peeledState = getState(plan.ndr);
+  const size_t numGroupTiles = plan.groups.totalTiles();
+  size_t first;
+  for (size_t count = claimTiles(desc, first); count;
+       count = claimTiles(desc, first)) {
+    for (size_t tile = first; tile < first + count; tile++) {
+      if (tile < numGroupTiles) {
+        runTile(groupState, kernel, args, plan.groups, tile);
+      } else {
+        runTile(peeledState, kernel, args, plan.peeled, tile - numGroupTiles);
       }
-    } else {
-      // Split dimension 0 across the threadpool
-      // Here we try to create groups of workgroups in order to reduce
-      // synchronization overhead
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          for (unsigned g0 = 0; g0 < numWG0; g0++) {
-            groups.push_back(
-                [state, g0, g1, g2, numParallelThreads](
-                    size_t threadId, ur_kernel_handle_t_ kernel) mutable {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                });
+    }
+  }
+
+  if (desc.pendingWorkers.count_down()) {
+    finishLaunch(desc);
+  }
+}
+#endif // NATIVECPU_USE_OCK
+
+ur_result_t reserveLocalMem(const kernel_args &args,
+                            local_mem_arena &localMem) {
+  if (args.localMemSize() == 0) {
+    return UR_RESULT_SUCCESS;
+  }
+  if (args.localMemSize() > maxLocalMemSize) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return localMem.reserve() ? UR_RESULT_SUCCESS
+                            : UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+void launchKernel(launch_desc &desc, threadpool_t &tp,
+                  local_mem_arena &localMem) {
+  const launch_plan &plan = *desc.plan;
+#ifndef NATIVECPU_USE_OCK
+  std::ignore = tp;
+  std::ignore = localMem;
+  const NDRDescT &ndr = plan.ndr;
+  native_cpu::state state = getState(ndr);
+  // The work-groups run on the calling thread, which may not be a worker.
+  if (!desc.args.localArgs().empty()) {
+    char *localMem = local_mem_arena::getForCallingThread();
+    if (!localMem) {
+      die("native_cpu: couldn't allocate the local memory of the calling "
+          "thread");
+    }
+    desc.args.bindLocalArgs(desc.args.data(), localMem);
+  }
+  for (unsigned g2 = 0; g2 < plan.numGroups[2]; g2++) {
+    for (unsigned g1 = 0; g1 < plan.numGroups[1]; g1++) {
+      for (unsigned g0 = 0; g0 < plan.numGroups[0]; g0++) {
+        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
+          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
+            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
+              state.update(g0, g1, g2, local0, local1, local2);
+              desc.kernel->_subhandler(desc.args.data(), &state);
+            }
           }
         }
       }
-      auto numGroups = groups.size();
-      auto groupsPerThread = numGroups / numParallelThreads;
-      auto remainder = numGroups % numParallelThreads;
-      for (unsigned thread = 0; thread < numParallelThreads; thread++) {
-        futures.emplace_back(tp.schedule_task(
-            [&groups, thread, groupsPerThread, hKernel](size_t threadId) {
-              for (unsigned i = 0; i < groupsPerThread; i++) {
-                auto index = thread * groupsPerThread + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
-      }
+    }
+  }
+  finishLaunch(desc);
+#else
+  // No more workers than threads are needed, as each of them runs tiles
+  // until there are none left.
+  const size_t numWorkers =
+      std::min(plan.numTiles(), plan.numParallelThreads);
+  desc.workers.resize(numWorkers);
+  desc.nextTile.store(0, std::memory_order_relaxed);
+  desc.localMem = &localMem;
+  if (!desc.args.localArgs().empty()) {
+    desc.threadArgs.resize(plan.numParallelThreads * desc.args.size(),
+                           NativeCPUArgDesc(nullptr));
+  }
+  // The launching thread holds one count until it has scheduled every worker.
+  desc.pendingWorkers.reset(numWorkers + 1);
+  for (auto &worker : desc.workers) {
+    worker.run = &runLaunchWorker;
+    worker.desc = &desc;
+    tp.schedule(&worker);
+  }
+
+  if (desc.pendingWorkers.count_down()) {
+    finishLaunch(desc);
+  }
+#endif // NATIVECPU_USE_OCK
+}
+} // namespace native_cpu
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
 
-      // schedule the remaining tasks
-      if (remainder) {
-        futures.emplace_back(
-            tp.schedule_task([&groups, remainder,
-                              scheduled = numParallelThreads * groupsPerThread,
-                              hKernel](size_t threadId) {
-              for (unsigned i = 0; i < remainder; i++) {
-                auto index = scheduled + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
+  if (*pGlobalWorkSize == 0) {
+    DIE_NO_IMPLEMENTATION;
+  }
+
+  // Check reqd_work_group_size
+  if (hKernel->hasReqdWGSize() && pLocalWorkSize != nullptr) {
+    const auto &Reqd = hKernel->getReqdWGSize();
+    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
+      if (pLocalWorkSize[Dim] != Reqd[Dim]) {
+        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
       }
     }
   }
 
-  for (auto &f : futures)
-    f.get();
-#endif // NATIVECPU_USE_OCK
-  // TODO: we should avoid calling clear here by avoiding using push_back
-  // in setKernelArgs.
-  hKernel->_args.clear();
-  hKernel->_localArgInfo.clear();
-  return UR_RESULT_SUCCESS;
+  // TODO: add proper error checking
+  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                           pLocalWorkSize);
+  auto &tp = hQueue->device->tp;
+  auto &localMem = hQueue->device->localMem;
+  if (auto result = native_cpu::reserveLocalMem(hKernel->_args, localMem);
+      result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  // The launch runs asynchronously, so it works on a copy of the kernel
+  // arguments as they were set at enqueue time. The descriptor is recycled
+  // from a previous launch of the queue, so this doesn't allocate.
+  native_cpu::launch_desc *desc = hQueue->getLaunchDescs().acquire();
+  desc->capture(hKernel, hKernel->_args);
+  desc->ownPlan.reset(ndr, tp.num_threads());
+  desc->plan = &desc->ownPlan;
+
+  // The device is taken from the event's queue, so that the command only
+  // captures the descriptor and is stored inline by command_start_t.
+  auto result = hQueue->enqueue(
+      UR_COMMAND_KERNEL_LAUNCH, numEventsInWaitList, phEventWaitList, phEvent,
+      [desc](ur_event_handle_t event) {
+        desc->done = [event]() { event->complete(); };
+        auto *device = event->getQueue()->device;
+        native_cpu::launchKernel(*desc, device->tp, device->localMem);
+      });
+  if (result != UR_RESULT_SUCCESS) {
+    hQueue->getLaunchDescs().release(desc);
+  }
+  return result;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  return hQueue->enqueueMarker(UR_COMMAND_EVENTS_WAIT, numEventsInWaitList,
+                               phEventWaitList, phEvent, false);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  return hQueue->enqueueMarker(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER,
+                               numEventsInWaitList, phEventWaitList, phEvent,
+                               true);
+}
+
+namespace {
+// References to the memory objects a command accesses, held until it has run
+// so that they can be released while the command is pending.
+class mem_refs {
+public:
+  mem_refs(std::initializer_list<ur_mem_handle_t> mems) {
+    for (auto mem : mems) {
+      if (mem) {
+        mem->_refCount++;
+        this->mems[numMems++] = mem;
+      }
+    }
+  }
+
+  mem_refs(const mem_refs &other) : mems(other.mems), numMems(other.numMems) {
+    for (size_t i = 0; i < numMems; i++) {
+      mems[i]->_refCount++;
+    }
+  }
+
+  mem_refs(mem_refs &&other) noexcept
+      : mems(other.mems), numMems(other.numMems) {
+    other.numMems = 0;
+  }
+
+  mem_refs &operator=(const mem_refs &) = delete;
+
+  ~mem_refs() { release(); }
+
+  void release() {
+    for (size_t i = 0; i < numMems; i++) {
+      urMemRelease(mems[i]);
+    }
+    numMems = 0;
+  }
+
+private:
+  std::array<ur_mem_handle_t, 2> mems;
+  size_t numMems = 0;
+};
+
+// A memory operation in flight, the last of its chunks to finish completes
+// the event.
+struct mem_op_state {
+  mem_op_state(native_cpu::mem_op &&op, mem_refs &&refs,
+               ur_event_handle_t event)
+      : op(std::move(op)), refs(std::move(refs)),
+        remaining(this->op.numChunks), event(event) {}
+
+  void run(size_t chunk) {
+    op.runChunk(chunk);
+    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      refs.release();
+      event->complete();
+    }
+  }
+
+  native_cpu::mem_op op;
+  mem_refs refs;
+  std::atomic<size_t> remaining;
+  ur_event_handle_t event;
+};
+} // namespace
+
+// Enqueues a memory operation, its chunks are spread over the device
+// threadpool. Blocking commands run a chunk on the calling thread rather than
+// leaving it idle. The memory objects in refs are retained until the
+// operation has run.
+static ur_result_t enqueueMemOp(ur_queue_handle_t hQueue,
+                                ur_command_t commandType, bool blocking,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent,
+                                native_cpu::mem_op &&op, mem_refs &&refs = {}) {
+  auto &tp = hQueue->device->tp;
+  return hQueue->enqueue(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [op = std::move(op), refs = std::move(refs), &tp,
+       blocking](ur_event_handle_t event) mutable {
+        if (blocking && op.numChunks == 1) {
+          op.runChunk(0);
+          refs.release();
+          event->complete();
+          return;
+        }
+        auto state = std::make_shared<mem_op_state>(std::move(op),
+                                                    std::move(refs), event);
+        for (size_t chunk = blocking ? 1 : 0; chunk < state->op.numChunks;
+             chunk++) {
+          tp.schedule([state, chunk](size_t) { state->run(chunk); });
+        }
+        if (blocking) {
+          state->run(0);
+        }
+      },
+      blocking);
 }
 
 template <bool IsRead>
 static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
-    ur_queue_handle_t, ur_mem_handle_t Buff, bool,
+    ur_queue_handle_t hQueue, ur_mem_handle_t Buff, bool blocking,
     ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
     ur_rect_region_t region, size_t BufferRowPitch, size_t BufferSlicePitch,
     size_t HostRowPitch, size_t HostSlicePitch,
     typename std::conditional<IsRead, void *, const void *>::type DstMem,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
-  // TODO: events, blocking, check other constraints, performance optimizations
-  //       More sharing with level_zero where possible
-
-  if (BufferRowPitch == 0)
-    BufferRowPitch = region.width;
-  if (BufferSlicePitch == 0)
-    BufferSlicePitch = BufferRowPitch * region.height;
-  if (HostRowPitch == 0)
-    HostRowPitch = region.width;
-  if (HostSlicePitch == 0)
-    HostSlicePitch = HostRowPitch * region.height;
-  for (size_t w = 0; w < region.width; w++)
-    for (size_t h = 0; h < region.height; h++)
-      for (size_t d = 0; d < region.depth; d++) {
-        size_t buff_orign = (d + BufferOffset.z) * BufferSlicePitch +
-                            (h + BufferOffset.y) * BufferRowPitch + w +
-                            BufferOffset.x;
-        size_t host_origin = (d + HostOffset.z) * HostSlicePitch +
-                             (h + HostOffset.y) * HostRowPitch + w +
-                             HostOffset.x;
-        int8_t &buff_mem = ur_cast<int8_t *>(Buff->_mem)[buff_orign];
-        if constexpr (IsRead)
-          ur_cast<int8_t *>(DstMem)[host_origin] = buff_mem;
-        else
-          buff_mem = ur_cast<const int8_t *>(DstMem)[host_origin];
-      }
-  return UR_RESULT_SUCCESS;
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent, ur_command_t commandType,
+    ur_mem_handle_t DstBuff = nullptr) {
+  // TODO: check other constraints
+  char *BuffMem = Buff->_mem;
+  char *HostMem = const_cast<char *>(static_cast<const char *>(DstMem));
+  const native_cpu::rect_desc buffRect{BuffMem, BufferOffset, BufferRowPitch,
+                                       BufferSlicePitch};
+  const native_cpu::rect_desc hostRect{HostMem, HostOffset, HostRowPitch,
+                                       HostSlicePitch};
+  return enqueueMemOp(
+      hQueue, commandType, blocking, numEventsInWaitList, phEventWaitList,
+      phEvent,
+      native_cpu::makeCopyRect(IsRead ? hostRect : buffRect,
+                               IsRead ? buffRect : hostRect, region,
+                               hQueue->device->tp.num_threads()),
+      {Buff, DstBuff});
 }
 
 static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
                                       const void *SrcPtr, size_t Size,
                                       uint32_t numEventsInWaitList,
                                       const ur_event_handle_t *EventWaitList,
-                                      ur_event_handle_t *Event) {
-  // todo: non-blocking, events, UR integration
-  std::ignore = EventWaitList;
-  std::ignore = Event;
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  if (SrcPtr != DstPtr && Size)
-    memmove(DstPtr, SrcPtr, Size);
-  return UR_RESULT_SUCCESS;
+                                      ur_event_handle_t *Event,
+                                      ur_command_t commandType, bool blocking,
+                                      mem_refs &&refs = {}) {
+  return enqueueMemOp(hQueue, commandType, blocking, numEventsInWaitList,
+                      EventWaitList, Event,
+                      native_cpu::makeCopy(DstPtr, SrcPtr, Size,
+                                           hQueue->device->tp.num_threads()),
+                      std::move(refs));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingRead;
-
   void *FromPtr = /*Src*/ hBuffer->_mem + offset;
   return doCopy_impl(hQueue, pDst, FromPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_READ,
+                     blockingRead, {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingWrite;
-
   void *ToPtr = hBuffer->_mem + offset;
   return doCopy_impl(hQueue, ToPtr, pSrc, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_WRITE,
+                     blockingWrite, {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
@@ -345,7 +661,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
       hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      numEventsInWaitList, phEventWaitList, phEvent,
+      UR_COMMAND_MEM_BUFFER_READ_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
@@ -358,7 +675,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   return enqueueMemBufferReadWriteRect_impl<false /*write*/>(
       hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      numEventsInWaitList, phEventWaitList, phEvent,
+      UR_COMMAND_MEM_BUFFER_WRITE_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
@@ -369,7 +687,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
   const void *SrcPtr = hBufferSrc->_mem + srcOffset;
   void *DstPtr = hBufferDst->_mem + dstOffset;
   return doCopy_impl(hQueue, DstPtr, SrcPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_COPY,
+                     false, {hBufferSrc, hBufferDst});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
@@ -383,7 +702,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
       hQueue, hBufferSrc, false /*todo: check blocking*/, srcOrigin,
       /*HostOffset*/ dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch,
       dstSlicePitch, hBufferDst->_mem, numEventsInWaitList, phEventWaitList,
-      phEvent);
+      phEvent, UR_COMMAND_MEM_BUFFER_COPY_RECT, hBufferDst);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
@@ -391,22 +710,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
     size_t patternSize, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   // TODO: error checking
-  // TODO: handle async
   void *startingPtr = hBuffer->_mem + offset;
-  unsigned steps = size / patternSize;
-  for (unsigned i = 0; i < steps; i++) {
-    memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize, pPattern,
-           patternSize);
-  }
-
-  return UR_RESULT_SUCCESS;
+  return enqueueMemOp(hQueue, UR_COMMAND_MEM_BUFFER_FILL, false,
+                      numEventsInWaitList, phEventWaitList, phEvent,
+                      native_cpu::makeFill(startingPtr, pPattern, patternSize,
+                                           size,
+                                           hQueue->device->tp.num_threads()),
+                      {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
@@ -473,16 +786,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
     ur_map_flags_t mapFlags, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent, void **ppRetMap) {
-  std::ignore = hQueue;
-  std::ignore = blockingMap;
   std::ignore = mapFlags;
-  std::ignore = size;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  *ppRetMap = hBuffer->_mem + offset;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer && !hBuffer->isImage(),
+            UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+  UR_ASSERT(ppRetMap, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(size <= hBuffer->_size && offset <= hBuffer->_size - size,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  // Mapping doesn't copy, so the command only has to order the map against
+  // the other commands and completes as soon as it starts.
+  ur_result_t result = hQueue->enqueue(
+      UR_COMMAND_MEM_BUFFER_MAP, numEventsInWaitList, phEventWaitList, phEvent,
+      [](ur_event_handle_t event) { event->complete(); }, blockingMap);
+  if (result != UR_RESULT_SUCCESS) {
+    return result;
+  }
 
+  auto *buffer = static_cast<_ur_buffer *>(hBuffer);
+  char *mapPtr = buffer->_mem + offset;
+  {
+    std::lock_guard<ur_shared_mutex> lock(buffer->Mutex);
+    buffer->Mappings[mapPtr]++;
+  }
+  *ppRetMap = mapPtr;
   return UR_RESULT_SUCCESS;
 }
 
@@ -490,25 +817,35 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
     ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = hMem;
-  std::ignore = pMappedPtr;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hMem && !hMem->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+  UR_ASSERT(pMappedPtr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(numEventsInWaitList == 0 || phEventWaitList,
+            UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+  auto *buffer = static_cast<_ur_buffer *>(hMem);
+  {
+    std::lock_guard<ur_shared_mutex> lock(buffer->Mutex);
+    auto it = buffer->Mappings.find(pMappedPtr);
+    if (it == buffer->Mappings.end()) {
+      logger::error("urEnqueueMemUnmap: unknown memory mapping");
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    if (--it->second == 0) {
+      buffer->Mappings.erase(it);
+    }
+  }
 
-  return UR_RESULT_SUCCESS;
+  return hQueue->enqueue(UR_COMMAND_MEM_UNMAP, numEventsInWaitList,
+                         phEventWaitList, phEvent,
+                         [](ur_event_handle_t event) { event->complete(); });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE)
@@ -517,91 +854,50 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE)
   // TODO: add check for allocation size once the query is supported
 
-  switch (patternSize) {
-  case 1:
-    memset(ptr, *static_cast<const uint8_t *>(pPattern), size * patternSize);
-    break;
-  case 2: {
-    const auto pattern = *static_cast<const uint16_t *>(pPattern);
-    auto *start = reinterpret_cast<uint16_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 4: {
-    const auto pattern = *static_cast<const uint32_t *>(pPattern);
-    auto *start = reinterpret_cast<uint32_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint32_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 8: {
-    const auto pattern = *static_cast<const uint64_t *>(pPattern);
-    auto *start = reinterpret_cast<uint64_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint64_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  default: {
-    for (unsigned int step{0}; step < size; step += patternSize) {
-      auto *dest =
-          reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(ptr) + step);
-      memcpy(dest, pPattern, patternSize);
-    }
-  }
-  }
-  return UR_RESULT_SUCCESS;
+  return enqueueMemOp(hQueue, UR_COMMAND_USM_FILL, false, numEventsInWaitList,
+                      phEventWaitList, phEvent,
+                      native_cpu::makeFill(ptr, pPattern, patternSize, size,
+                                           hQueue->device->tp.num_threads()));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
     size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
   UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  memcpy(pDst, pSrc, size);
-
-  return UR_RESULT_SUCCESS;
+  return enqueueMemOp(hQueue, UR_COMMAND_USM_MEMCPY, blocking,
+                      numEventsInWaitList, phEventWaitList, phEvent,
+                      native_cpu::makeCopy(pDst, pSrc, size,
+                                           hQueue->device->tp.num_threads()));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_queue_handle_t hQueue, const void *pMem, size_t size,
     ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = pMem;
   std::ignore = size;
   std::ignore = flags;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
   // TODO: properly implement USM prefetch
-  return UR_RESULT_SUCCESS;
+  return hQueue->enqueue(UR_COMMAND_USM_PREFETCH, numEventsInWaitList,
+                         phEventWaitList, phEvent,
+                         [](ur_event_handle_t event) { event->complete(); });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
                    ur_usm_advice_flags_t advice, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = pMem;
   std::ignore = size;
   std::ignore = advice;
-  std::ignore = phEvent;
 
   // TODO: properly implement USM advise
-  return UR_RESULT_SUCCESS;
+  return hQueue->enqueue(UR_COMMAND_USM_ADVISE, 0, nullptr, phEvent,
+                         [](ur_event_handle_t event) { event->complete(); });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
@@ -609,18 +905,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
     const void *pPattern, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = pMem;
-  std::ignore = pitch;
-  std::ignore = patternSize;
-  std::ignore = pPattern;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pitch != 0 && pitch >= width, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(width != 0 && height != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(patternSize != 0 && (patternSize & (patternSize - 1)) == 0,
+            UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(patternSize <= width * height, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(width * height % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE);
+
+  return enqueueMemOp(hQueue, UR_COMMAND_USM_FILL_2D, false,
+                      numEventsInWaitList, phEventWaitList, phEvent,
+                      native_cpu::makeFill2D(pMem, pitch, pPattern, patternSize,
+                                             width, height,
+                                             hQueue->device->tp.num_threads()));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
@@ -628,19 +927,24 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     const void *pSrc, size_t srcPitch, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = pDst;
-  std::ignore = dstPitch;
-  std::ignore = pSrc;
-  std::ignore = srcPitch;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(dstPitch >= width && srcPitch >= width,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  // A 2D copy is a rectangle copy of a single slice.
+  const ur_rect_region_t region{width, height, 1};
+  const native_cpu::rect_desc dstRect{static_cast<char *>(pDst), {0, 0, 0},
+                                      dstPitch, 0};
+  const native_cpu::rect_desc srcRect{
+      const_cast<char *>(static_cast<const char *>(pSrc)), {0, 0, 0},
+      srcPitch, 0};
+  return enqueueMemOp(hQueue, UR_COMMAND_USM_MEMCPY_2D, blocking,
+                      numEventsInWaitList, phEventWaitList, phEvent,
+                      native_cpu::makeCopyRect(
+                          dstRect, srcRect, region,
+                          hQueue->device->tp.num_threads()));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
@@ -0,0 +1,216 @@
+//===----------- enqueue.hpp - Native CPU Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include "kernel.hpp"
+#include "local_mem.hpp"
+#include "threadpool.hpp"
+#include "ur_api.h"
+
+namespace native_cpu {
+struct NDRDescT {
+  using RangeT = std::array<size_t, 3>;
+  uint32_t WorkDim;
+  RangeT GlobalOffset;
+  RangeT GlobalSize;
+  RangeT LocalSize;
+  NDRDescT() : WorkDim(0), GlobalOffset{}, GlobalSize{}, LocalSize{} {}
+  NDRDescT(uint32_t WorkDim, const size_t *GlobalWorkOffset,
+           const size_t *GlobalWorkSize, const size_t *LocalWorkSize)
+      : WorkDim(WorkDim) {
+    for (uint32_t I = 0; I < WorkDim; I++) {
+      GlobalOffset[I] = GlobalWorkOffset[I];
+      GlobalSize[I] = GlobalWorkSize[I];
+      LocalSize[I] = LocalWorkSize ? LocalWorkSize[I] : 1;
+    }
+    for (uint32_t I = WorkDim; I < 3; I++) {
+      GlobalSize[I] = 1;
+      LocalSize[I] = LocalSize[0] ? 1 : 0;
+      GlobalOffset[I] = 0;
+    }
+  }
+
+  bool operator==(const NDRDescT &Other) const noexcept {
+    return WorkDim == Other.WorkDim && GlobalOffset == Other.GlobalOffset &&
+           GlobalSize == Other.GlobalSize && LocalSize == Other.LocalSize;
+  }
+
+  void dump(std::ostream &os) const {
+    os << "GlobalSize: " << GlobalSize[0] << " " << GlobalSize[1] << " "
+       << GlobalSize[2] << "\n";
+    os << "LocalSize: " << LocalSize[0] << " " << LocalSize[1] << " "
+       << LocalSize[2] << "\n";
+    os << "GlobalOffset: " << GlobalOffset[0] << " " << GlobalOffset[1] << " "
+       << GlobalOffset[2] << "\n";
+  }
+};
+
+// How the work-groups of a launch are split between the threads of the pool,
+// selected with the SYCL_NATIVE_CPU_PARTITION environment variable.
+enum class partitioning {
+  // "tiled", the default: blocks of work-groups sized to fit in the cache,
+  // claimed by the threads in chunks that shrink as the launch progresses.
+  tiled,
+  // "rows": whole rows of work-groups along dimension 0, claimed as above.
+  rows,
+  // "static": blocks as with tiled, split evenly between the threads.
+  static_tiles,
+};
+
+// The work-groups of a kernel launch split into tiles for the threadpool.
+// It only depends on the ND-range and on the number of threads, so it can be
+// computed once and reused by every launch with the same shape.
+struct launch_plan {
+  // Work-groups of the same size, split into tiles of tileShape work-groups.
+  // Tiles are numbered with dimension 0 varying fastest.
+  struct grid {
+    void setTiles(const NDRDescT::RangeT &shape) noexcept {
+      for (size_t dim = 0; dim < 3; dim++) {
+        tileShape[dim] = shape[dim];
+        numTiles[dim] = (numGroups[dim] + shape[dim] - 1) / shape[dim];
+      }
+    }
+
+    size_t totalTiles() const noexcept {
+      return numTiles[0] * numTiles[1] * numTiles[2];
+    }
+
+    // Index of the first work-group of the grid in dimension 0.
+    size_t firstGroup0 = 0;
+    NDRDescT::RangeT numGroups{};
+    NDRDescT::RangeT tileShape{};
+    NDRDescT::RangeT numTiles{};
+  };
+
+  launch_plan() = default;
+  launch_plan(const NDRDescT &ndr, size_t numParallelThreads) {
+    reset(ndr, numParallelThreads);
+  }
+
+  // Computes the plan for ndr, unless it has already been computed for the
+  // same shape.
+  void reset(const NDRDescT &ndr, size_t numParallelThreads);
+
+  size_t numTiles() const noexcept {
+    return groups.totalTiles() + peeled.totalTiles();
+  }
+
+  // Number of tiles for a thread to claim at once, when remaining tiles are
+  // left to run.
+  size_t chunkSize(size_t remaining) const noexcept {
+    if (policy == partitioning::static_tiles) {
+      return (numTiles() + numParallelThreads - 1) / numParallelThreads;
+    }
+    return std::max<size_t>(1, remaining / (2 * numParallelThreads));
+  }
+
+  NDRDescT ndr;
+  size_t numParallelThreads = 0;
+  partitioning policy = partitioning::tiled;
+  NDRDescT::RangeT numGroups{};
+  // When the local size is one, the work-items of dimension 0 are coalesced
+  // into work-groups of itemsPerGroup work-items, the kernel is vectorized
+  // over those. Otherwise this is zero and groups are the work-groups of the
+  // ND-range.
+  size_t itemsPerGroup = 0;
+  grid groups;
+  // The work-items left over at the end of dimension 0 after coalescing, run
+  // as work-groups of one work-item.
+  grid peeled;
+};
+
+// Counts down the tasks of a launch, the call releasing the latch is told so
+// and carries on with the completion of the launch.
+class countdown_latch {
+public:
+  void reset(size_t count) noexcept {
+    pending.store(count, std::memory_order_relaxed);
+  }
+
+  // Returns true for the call that brings the count to zero.
+  bool count_down() noexcept {
+    return pending.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+private:
+  std::atomic<size_t> pending{0};
+};
+
+class launch_desc_pool;
+
+// A kernel launch in flight, along with the kernel arguments captured when it
+// was enqueued. Descriptors are recycled by a launch_desc_pool, so once their
+// vectors have grown to the size needed by the kernels, a launch doesn't
+// allocate.
+struct launch_desc {
+  // Captures the kernel and its arguments, the kernel is retained until the
+  // descriptor is released.
+  void capture(ur_kernel_handle_t kernel, const kernel_args &args);
+
+  ur_kernel_handle_t kernel = nullptr;
+  kernel_args args;
+  // The plan of the launch, either ownPlan or one computed ahead of time,
+  // which must outlive the launch.
+  const launch_plan *plan = nullptr;
+  launch_plan ownPlan;
+  // Called once all the work-groups have run, after the descriptor has been
+  // released.
+  std::function<void()> done;
+
+  // Execution state, managed by launchKernel. Each worker is a threadpool
+  // task claiming tiles of the plan until there are none left.
+  struct worker : intrusive_task {
+    launch_desc *desc = nullptr;
+  };
+  std::vector<worker> workers;
+  std::atomic<size_t> nextTile{0};
+  countdown_latch pendingWorkers;
+  local_mem_arena *localMem = nullptr;
+  // Copies of args for each thread of the pool, with the local arguments
+  // pointing to the local memory of the thread.
+  std::vector<NativeCPUArgDesc> threadArgs;
+  launch_desc_pool *pool = nullptr;
+};
+
+// Recycles the descriptors of the kernel launches of a queue.
+class launch_desc_pool {
+public:
+  launch_desc *acquire();
+
+  // Releases the kernel retained by desc and returns it to the pool.
+  void release(launch_desc *desc);
+
+private:
+  std::mutex mutex;
+  std::vector<std::unique_ptr<launch_desc>> freeDescs;
+};
+
+// Checks that the local memory of the kernel arguments fits in the local
+// memory of a work-group, and reserves the local memory of the threads.
+ur_result_t reserveLocalMem(const kernel_args &args,
+                            local_mem_arena &localMem);
+
+// Runs a kernel launch following desc.plan on the threads of tp, whose local
+// memory is localMem. desc.done is called once all of its work-groups have
+// completed.
+void launchKernel(launch_desc &desc, threadpool_t &tp,
+                  local_mem_arena &localMem);
+} // namespace native_cpu
@@ -11,50 +11,250 @@
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "context.hpp"
+#include "event.hpp"
+#include "queue.hpp"
+
+ur_event_handle_t_::ur_event_handle_t_(ur_queue_handle_t queue,
+                                       ur_command_t command_type,
+                                       bool profiling)
+    : queue(queue), context(queue->getContext()), command_type(command_type),
+      status(UR_EVENT_STATUS_QUEUED), profiling(profiling) {
+  queue->retainForEvent();
+  context->incrementReferenceCount();
+  recordTimestamp(UR_PROFILING_INFO_COMMAND_QUEUED);
+}
+
+ur_event_handle_t_::~ur_event_handle_t_() {
+  decrementOrDelete(context);
+  queue->releaseForEvent();
+}
+
+namespace {
+// Commands made ready on a thread which is already starting one. Completing a
+// command starts the commands waiting on it, which can complete right away,
+// e.g. markers, and start the next ones in turn. Queuing them here rather
+// than starting them from the call that made them ready keeps the stack depth
+// constant on long chains of commands.
+struct ready_commands {
+  bool isStarting = false;
+  std::vector<ur_event_handle_t> events;
+};
+
+thread_local ready_commands readyCommands;
+
+// Starts the commands queued on the calling thread.
+void startReadyCommands(ready_commands &ready) {
+  const bool wasStarting = ready.isStarting;
+  ready.isStarting = true;
+  while (!ready.events.empty()) {
+    ur_event_handle_t event = ready.events.back();
+    ready.events.pop_back();
+    event->start();
+  }
+  ready.isStarting = wasStarting;
+}
+} // namespace
+
+void ur_event_handle_t_::wait() {
+  if (isComplete()) {
+    return;
+  }
+  // The command may be one of those queued on this thread, e.g. when waiting
+  // from a callback.
+  startReadyCommands(readyCommands);
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [this]() { return isComplete(); });
+}
+
+namespace {
+// Storage of the destroyed events, reused by the next ones. It is never
+// destroyed, so that events released during shutdown can still return to it.
+struct event_storage_cache {
+  // Bounds the memory kept by the cache after a burst of events.
+  static constexpr size_t maxCached = 4096;
+
+  std::mutex mutex;
+  std::vector<void *> blocks;
+};
+
+event_storage_cache &getEventStorageCache() {
+  static auto *cache = new event_storage_cache();
+  return *cache;
+}
+} // namespace
+
+void *ur_event_handle_t_::operator new(size_t size) {
+  auto &cache = getEventStorageCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (!cache.blocks.empty()) {
+      void *ptr = cache.blocks.back();
+      cache.blocks.pop_back();
+      return ptr;
+    }
+  }
+  return ::operator new(size);
+}
+
+void ur_event_handle_t_::operator delete(void *ptr) noexcept {
+  auto &cache = getEventStorageCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.blocks.size() < event_storage_cache::maxCached) {
+      cache.blocks.push_back(ptr);
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+void ur_event_handle_t_::dependencyComplete() {
+  if (numPendingDeps.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  auto &ready = readyCommands;
+  ready.events.push_back(this);
+  if (!ready.isStarting) {
+    startReadyCommands(ready);
+  }
+}
+
+void ur_event_handle_t_::start() {
+  setRunning();
+  // The command may complete the event, and release it, before returning.
+  command_start_t start = std::move(pendingStart);
+  start(this);
+}
+
+void ur_event_handle_t_::complete() {
+  recordTimestamp(UR_PROFILING_INFO_COMMAND_END);
+  std::function<void()> first;
+  std::vector<std::function<void()>> toRun;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    status.store(UR_EVENT_STATUS_COMPLETE, std::memory_order_release);
+    first.swap(firstContinuation);
+    toRun.swap(continuations);
+  }
+  cv.notify_all();
+  if (first) {
+    first();
+  }
+  for (auto &f : toRun) {
+    f();
+  }
+  queue->commandComplete();
+  decrementOrDelete(this);
+}
+
+uint64_t
+ur_event_handle_t_::getTimestamp(ur_profiling_info_t info) const noexcept {
+  // The timestamps of the later states may still be written by the thread
+  // running the command.
+  const ur_event_status_t current = getExecutionStatus();
+  switch (info) {
+  case UR_PROFILING_INFO_COMMAND_START:
+    if (current == UR_EVENT_STATUS_QUEUED) {
+      return 0;
+    }
+    break;
+  case UR_PROFILING_INFO_COMMAND_END:
+  case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    if (current != UR_EVENT_STATUS_COMPLETE) {
+      return 0;
+    }
+    // Commands don't have child commands, they are complete when they end.
+    info = UR_PROFILING_INFO_COMMAND_END;
+    break;
+  default:
+    break;
+  }
+  return timestamps[info];
+}
+
+void ur_event_handle_t_::onComplete(std::function<void()> &&f) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!isComplete()) {
+      if (!firstContinuation) {
+        firstContinuation = std::move(f);
+      } else {
+        continuations.push_back(std::move(f));
+      }
+      return;
+    }
+  }
+  f();
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    ur_event_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  switch (propName) {
+  case UR_EVENT_INFO_COMMAND_QUEUE:
+    return ReturnValue(hEvent->getQueue());
+  case UR_EVENT_INFO_CONTEXT:
+    return ReturnValue(hEvent->getContext());
+  case UR_EVENT_INFO_COMMAND_TYPE:
+    return ReturnValue(hEvent->getCommandType());
+  case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
+    return ReturnValue(hEvent->getExecutionStatus());
+  case UR_EVENT_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hEvent->getReferenceCount()});
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(propName <= UR_PROFILING_INFO_COMMAND_COMPLETE,
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
 
-  DIE_NO_IMPLEMENTATION;
+  if (!hEvent->isProfiling()) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+  const uint64_t timestamp = hEvent->getTimestamp(propName);
+  if (!timestamp) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  return ReturnValue(timestamp);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
-  std::ignore = numEvents;
-  std::ignore = phEventWaitList;
-  // TODO: currently we do everything synchronously so this is a no-op
+  UR_ASSERT(numEvents == 0 || phEventWaitList,
+            UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  for (uint32_t i = 0; i < numEvents; i++) {
+    phEventWaitList[i]->wait();
+  }
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  hEvent->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  decrementOrDelete(hEvent);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
@@ -80,22 +280,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
                    ur_event_callback_t pfnNotify, void *pUserData) {
-  std::ignore = hEvent;
-  std::ignore = execStatus;
-  std::ignore = pfnNotify;
-  std::ignore = pUserData;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pfnNotify, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  if (execStatus != UR_EXECUTION_INFO_COMPLETE) {
+    DIE_NO_IMPLEMENTATION;
+  }
+  hEvent->onComplete([hEvent, pfnNotify, pUserData]() {
+    pfnNotify(hEvent, UR_EXECUTION_INFO_COMPLETE, pUserData);
+  });
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phEvent, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  // The timestamp is the time at which the command runs, once the commands
+  // it depends on have completed.
+  return hQueue->enqueueTimestampRecording(numEventsInWaitList,
+                                           phEventWaitList, phEvent, blocking);
 }
@@ -0,0 +1,144 @@
+//===----------- event.hpp - Native CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "common.hpp"
+#include "threadpool.hpp"
+#include "ur_api.h"
+
+struct ur_event_handle_t_ : RefCounted {
+  // Starts a command, gets the event to complete once the work is done.
+  using command_start_t = std::function<void(ur_event_handle_t)>;
+
+  // The event is created with one reference owned by the command in flight,
+  // which is dropped when the command completes. If profiling is set the
+  // event records when its command goes through each of its states, which
+  // otherwise costs nothing. The queue and its context are kept alive until
+  // the event is destroyed.
+  ur_event_handle_t_(ur_queue_handle_t queue, ur_command_t command_type,
+                     bool profiling);
+
+  ~ur_event_handle_t_();
+
+  // An event is created for every command, their storage is recycled rather
+  // than going back to the heap.
+  static void *operator new(size_t size);
+  static void operator delete(void *ptr) noexcept;
+
+  // Sets the command of the event, started once numDeps calls to
+  // dependencyComplete have been made.
+  void setPendingCommand(command_start_t &&start, size_t numDeps) noexcept {
+    pendingStart = std::move(start);
+    numPendingDeps.store(numDeps, std::memory_order_relaxed);
+  }
+
+  // Called when a dependency of the command has completed, the last one
+  // starts the command on the calling thread. If that thread is already
+  // starting a command, this one is started once it returns.
+  void dependencyComplete();
+
+  // Starts the command, once all its dependencies have completed.
+  void start();
+
+  // Blocks until the command associated with the event has completed.
+  void wait();
+
+  bool isComplete() const noexcept {
+    return status.load(std::memory_order_acquire) == UR_EVENT_STATUS_COMPLETE;
+  }
+
+  // Called once the command has been handed over to the queue, which starts
+  // it when its dependencies are satisfied.
+  void setSubmitted() noexcept {
+    recordTimestamp(UR_PROFILING_INFO_COMMAND_SUBMIT);
+  }
+
+  // Timestamp recordings take no time, they are submitted when they are
+  // enqueued and end when they start.
+  bool isTimestampRecording() const noexcept {
+    return command_type == UR_COMMAND_TIMESTAMP_RECORDING_EXP;
+  }
+
+  // Called when all the dependencies of the command are satisfied and it
+  // starts executing.
+  void setRunning() noexcept {
+    recordTimestamp(UR_PROFILING_INFO_COMMAND_START);
+    status.store(UR_EVENT_STATUS_RUNNING, std::memory_order_release);
+  }
+
+  // Marks the command as complete, runs the continuations registered with
+  // onComplete and wakes up the threads waiting on the event. This drops the
+  // reference owned by the command, so the event must not be used by the
+  // caller afterwards unless it holds its own reference.
+  void complete();
+
+  // Runs f once the event has completed. If the event has already completed
+  // f runs immediately on the calling thread, otherwise it runs on the
+  // thread that completes the event.
+  void onComplete(std::function<void()> &&f);
+
+  ur_queue_handle_t getQueue() const noexcept { return queue; }
+
+  ur_context_handle_t getContext() const noexcept { return context; }
+
+  ur_command_t getCommandType() const noexcept { return command_type; }
+
+  ur_event_status_t getExecutionStatus() const noexcept {
+    return status.load(std::memory_order_acquire);
+  }
+
+  bool isProfiling() const noexcept { return profiling; }
+
+  // Returns the time of a state of the command, in nanoseconds of the device
+  // clock, or 0 if the command hasn't reached it yet.
+  uint64_t getTimestamp(ur_profiling_info_t info) const noexcept;
+
+private:
+  void recordTimestamp(ur_profiling_info_t info) noexcept {
+    if (!profiling) {
+      return;
+    }
+    const bool instant = isTimestampRecording();
+    if (instant && info == UR_PROFILING_INFO_COMMAND_SUBMIT) {
+      timestamps[info] = timestamps[UR_PROFILING_INFO_COMMAND_QUEUED];
+    } else if (instant && info == UR_PROFILING_INFO_COMMAND_END) {
+      timestamps[info] = timestamps[UR_PROFILING_INFO_COMMAND_START];
+    } else {
+      timestamps[info] = native_cpu::getTimestamp();
+    }
+  }
+
+  const ur_queue_handle_t queue;
+  const ur_context_handle_t context;
+  const ur_command_t command_type;
+  std::atomic<ur_event_status_t> status;
+
+  const bool profiling;
+  // Indexed by ur_profiling_info_t, the timestamps of the states the command
+  // is past are published by the release of its status.
+  std::array<uint64_t, UR_PROFILING_INFO_COMMAND_COMPLETE + 1> timestamps{};
+
+  command_start_t pendingStart;
+  std::atomic<size_t> numPendingDeps{0};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  // Most events have at most one continuation, the command enqueued after
+  // them on an in-order queue, so the first one is stored inline.
+  std::function<void()> firstContinuation;
+  std::vector<std::function<void()>> continuations;
+};
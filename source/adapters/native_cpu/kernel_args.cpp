@@ -0,0 +1,126 @@
+//===--------- kernel_args.cpp - Native CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "kernel_args.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace native_cpu {
+
+namespace {
+
+// Values are aligned to their size rounded up to a power of two, at most
+// maxAlign, which is enough for any argument type.
+size_t valueAlignment(size_t size, size_t maxAlign) {
+  size_t align = 1;
+  while (align < size && align < maxAlign) {
+    align *= 2;
+  }
+  return align;
+}
+
+} // namespace
+
+kernel_args &kernel_args::operator=(const kernel_args &other) {
+  if (this == &other) {
+    return *this;
+  }
+  Args = other.Args;
+  Slots = other.Slots;
+  LocalArgs = other.LocalArgs;
+  LocalMemSize = other.LocalMemSize;
+  ValuesSize = 0;
+  reserveValues(other.ValuesSize);
+  std::memcpy(Values, other.Values, other.ValuesSize);
+  ValuesSize = other.ValuesSize;
+  rebaseValues();
+  return *this;
+}
+
+void kernel_args::reset(uint32_t index) {
+  if (index >= Args.size()) {
+    Args.resize(index + 1, nullptr);
+    Slots.resize(index + 1);
+  }
+  Slots[index].isValue = false;
+  auto local = std::find_if(LocalArgs.begin(), LocalArgs.end(),
+                            [index](const local_arg_info_t &info) {
+                              return info.argIndex == index;
+                            });
+  if (local != LocalArgs.end()) {
+    LocalArgs.erase(local);
+    layoutLocalArgs();
+  }
+}
+
+void kernel_args::reserveValues(size_t size) {
+  if (ValuesSize + size <= ValuesCapacity) {
+    return;
+  }
+  const size_t capacity = std::max(2 * ValuesCapacity, ValuesSize + size);
+  // The heap storage is aligned by hand, new only guarantees the alignment
+  // of the fundamental types.
+  std::unique_ptr<char[]> storage(new char[capacity + maxValueAlign]);
+  const auto base = reinterpret_cast<uintptr_t>(storage.get());
+  char *values = storage.get() + (-base & (maxValueAlign - 1));
+  std::memcpy(values, Values, ValuesSize);
+  HeapValues = std::move(storage);
+  Values = values;
+  ValuesCapacity = capacity;
+  rebaseValues();
+}
+
+void kernel_args::rebaseValues() {
+  for (size_t i = 0; i < Args.size(); i++) {
+    if (Slots[i].isValue) {
+      Args[i].MPtr = Values + Slots[i].offset;
+    }
+  }
+}
+
+void kernel_args::layoutLocalArgs() {
+  LocalMemSize = 0;
+  for (auto &entry : LocalArgs) {
+    entry.offset = LocalMemSize;
+    LocalMemSize += (entry.argSize + localArgAlign - 1) & ~(localArgAlign - 1);
+  }
+}
+
+void kernel_args::setValue(uint32_t index, const void *value, size_t size) {
+  reset(index);
+  value_slot &slot = Slots[index];
+  if (slot.offset == noValue || slot.size < size) {
+    // Values don't move once stored, unless the storage grows, so a value
+    // which doesn't fit its slot gets a new one at the end.
+    const size_t align = valueAlignment(size, maxValueAlign);
+    const size_t padding = -ValuesSize & (align - 1);
+    reserveValues(padding + size);
+    slot = {ValuesSize + padding, size};
+    ValuesSize += padding + size;
+  }
+  slot.isValue = true;
+  Args[index].MPtr = Values + slot.offset;
+  std::memcpy(Args[index].MPtr, value, size);
+}
+
+void kernel_args::setPointer(uint32_t index, void *ptr) {
+  reset(index);
+  Args[index].MPtr = ptr;
+}
+
+void kernel_args::setLocal(uint32_t index, size_t size) {
+  reset(index);
+  Args[index].MPtr = nullptr;
+  LocalArgs.emplace_back(index, size);
+  layoutLocalArgs();
+}
+
+} // namespace native_cpu
@@ -0,0 +1,121 @@
+//===--------- kernel_args.hpp - Native CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace native_cpu {
+
+struct NativeCPUArgDesc {
+  void *MPtr;
+
+  NativeCPUArgDesc(void *Ptr) : MPtr(Ptr){};
+};
+
+} // namespace native_cpu
+
+struct local_arg_info_t {
+  uint32_t argIndex;
+  size_t argSize;
+  // Where the argument starts in the local memory of a work-group.
+  size_t offset = 0;
+  local_arg_info_t(uint32_t argIndex, size_t argSize)
+      : argIndex(argIndex), argSize(argSize) {}
+};
+
+namespace native_cpu {
+
+// The arguments of a kernel, indexed by their position in the kernel
+// signature. Values are copied into storage owned by the arguments, so the
+// caller may reuse its memory as soon as an argument is set, and arguments
+// stay set for the following launches until they are set again.
+//
+// Copying the arguments snapshots them, for a launch running after they have
+// been changed. Assigning to arguments reuses their storage, and small values
+// are stored inline, so that arguments recycled between launches don't
+// allocate.
+class kernel_args {
+public:
+  kernel_args() = default;
+  kernel_args(const kernel_args &other) { *this = other; }
+  kernel_args &operator=(const kernel_args &other);
+
+  // Copies size bytes at value as the argument at index.
+  void setValue(uint32_t index, const void *value, size_t size);
+
+  // Passes ptr as the argument at index, used for USM pointers and buffers.
+  void setPointer(uint32_t index, void *ptr);
+
+  // Makes the argument at index point to size bytes of local memory, which
+  // is allocated for each thread when the kernel runs.
+  void setLocal(uint32_t index, size_t size);
+
+  // The arguments in the layout the kernels expect, arguments that haven't
+  // been set are null.
+  NativeCPUArgDesc *data() noexcept { return Args.data(); }
+  const NativeCPUArgDesc *data() const noexcept { return Args.data(); }
+  size_t size() const noexcept { return Args.size(); }
+
+  const std::vector<local_arg_info_t> &localArgs() const noexcept {
+    return LocalArgs;
+  }
+
+  // The local memory a work-group needs for the local arguments, each of
+  // them starts on a cache line so that vectorized kernels get aligned
+  // accesses.
+  size_t localMemSize() const noexcept { return LocalMemSize; }
+
+  // Points the local arguments of args, a copy of data(), to localMem.
+  void bindLocalArgs(NativeCPUArgDesc *args, char *localMem) const noexcept {
+    for (const auto &entry : LocalArgs) {
+      args[entry.argIndex].MPtr = localMem + entry.offset;
+    }
+  }
+
+private:
+  static constexpr size_t noValue = SIZE_MAX;
+  static constexpr size_t maxValueAlign = 64;
+  static constexpr size_t localArgAlign = 64;
+  static constexpr size_t inlineCapacity = 256;
+
+  // Where the value of an argument is stored. The slot is kept when the
+  // argument is set to something else than a value, so that setting values
+  // again at the same index reuses its size bytes.
+  struct value_slot {
+    size_t offset = noValue;
+    size_t size = 0;
+    bool isValue = false;
+  };
+
+  // Makes room for the argument at index, and forgets what it was.
+  void reset(uint32_t index);
+  // Makes room for size more bytes of values, keeping the current ones.
+  void reserveValues(size_t size);
+  // Points the value arguments to the value storage, once it has moved.
+  void rebaseValues();
+  // Computes the offsets of the local arguments.
+  void layoutLocalArgs();
+
+  std::vector<NativeCPUArgDesc> Args;
+  std::vector<value_slot> Slots;
+  std::vector<local_arg_info_t> LocalArgs;
+  size_t LocalMemSize = 0;
+
+  alignas(maxValueAlign) char InlineValues[inlineCapacity];
+  std::unique_ptr<char[]> HeapValues;
+  char *Values = InlineValues;
+  size_t ValuesCapacity = inlineCapacity;
+  size_t ValuesSize = 0;
+};
+
+} // namespace native_cpu
@@ -0,0 +1,39 @@
+//===--------- kernel_table.cpp - Native CPU Adapter ----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "kernel_table.hpp"
+
+namespace native_cpu {
+
+kernel_table::kernel_table(const nativecpu_entry *entries) {
+  size_t count = 0;
+  while (entries[count].kernel_ptr != nullptr) {
+    count++;
+  }
+  Kernels.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    // The first entry wins for a duplicated name, as it did with the map.
+    Kernels.try_emplace(entries[i].kernelname,
+                        kernel_template{entries[i].kernelname,
+                                        entries[i].kernel_ptr});
+  }
+}
+
+void kernel_table::setReqdWGSize(std::string_view name,
+                                 const ReqdWGSize_t &size) {
+  auto it = Kernels.find(name);
+  if (it == Kernels.end()) {
+    return;
+  }
+  it->second.hasReqdWGSize = true;
+  it->second.reqdWGSize = size;
+}
+
+} // namespace native_cpu
@@ -0,0 +1,68 @@
+//===--------- kernel_table.hpp - Native CPU Adapter ----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+// The nativecpu_entry struct is also defined as LLVM-IR in the
+// clang-offload-wrapper tool. The two definitions need to match,
+// therefore any change to this struct needs to be reflected in the
+// offload-wrapper.
+struct nativecpu_entry {
+  const char *kernelname;
+  const unsigned char *kernel_ptr;
+};
+
+namespace native_cpu {
+using ReqdWGSize_t = std::array<uint32_t, 3>;
+
+// Everything urKernelCreate needs to create a kernel, resolved once for all
+// the kernels of the same name. The name points into the program binary.
+struct kernel_template {
+  const char *name;
+  const unsigned char *kernelPtr;
+  bool hasReqdWGSize = false;
+  ReqdWGSize_t reqdWGSize{1, 1, 1};
+};
+
+// The kernels of a program binary indexed by name, built when the program is
+// created so that looking a kernel up is a hash of its name. The templates
+// don't move once the table is built, kernels keep a reference to theirs.
+class kernel_table {
+public:
+  kernel_table() = default;
+  // Indexes the entries of a binary, up to the one without a kernel.
+  explicit kernel_table(const nativecpu_entry *entries);
+
+  kernel_table(const kernel_table &) = delete;
+  kernel_table &operator=(const kernel_table &) = delete;
+
+  // Attaches the reqd_work_group_size metadata to the kernel called name,
+  // metadata for kernels the binary doesn't have is ignored.
+  void setReqdWGSize(std::string_view name, const ReqdWGSize_t &size);
+
+  // Returns the template of the kernel called name, or null.
+  const kernel_template *find(std::string_view name) const noexcept {
+    auto it = Kernels.find(name);
+    return it != Kernels.end() ? &it->second : nullptr;
+  }
+
+  size_t size() const noexcept { return Kernels.size(); }
+
+private:
+  // Keyed by views of the names in the binary, which outlives the table.
+  std::unordered_map<std::string_view, kernel_template> Kernels;
+};
+
+} // namespace native_cpu
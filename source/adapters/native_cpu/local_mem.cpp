@@ -0,0 +1,65 @@
+//===--------- local_mem.cpp - Native CPU Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "local_mem.hpp"
+#include "topology.hpp"
+
+#include <memory>
+#include <new>
+
+namespace native_cpu {
+
+namespace {
+
+size_t getSliceSize() {
+  const size_t pageSize = getPageSize();
+  return (maxLocalMemSize + pageSize - 1) / pageSize * pageSize;
+}
+
+} // namespace
+
+local_mem_arena::~local_mem_arena() {
+  freeFirstTouch(base, sliceSize * numWorkers);
+}
+
+bool local_mem_arena::reserve() {
+  std::call_once(reserved, [this]() {
+    sliceSize = getSliceSize();
+    base = static_cast<char *>(allocFirstTouch(sliceSize * numWorkers));
+  });
+  return base != nullptr;
+}
+
+char *local_mem_arena::getForCallingThread() noexcept {
+  // Taken from the heap when the pages can't be mapped, the slice is then
+  // only aligned as much as the local arguments need.
+  struct alignas(64) heap_slice {
+    char bytes[maxLocalMemSize];
+  };
+  struct thread_slice {
+    thread_slice() {
+      if (!mem) {
+        heap.reset(new (std::nothrow) heap_slice);
+        mem = heap ? heap->bytes : nullptr;
+      }
+    }
+    ~thread_slice() {
+      if (!heap) {
+        freeFirstTouch(mem, getSliceSize());
+      }
+    }
+    char *mem = static_cast<char *>(allocFirstTouch(getSliceSize()));
+    std::unique_ptr<heap_slice> heap;
+  };
+  static thread_local thread_slice slice;
+  return slice.mem;
+}
+
+} // namespace native_cpu
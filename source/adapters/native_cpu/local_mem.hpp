@@ -0,0 +1,54 @@
+//===--------- local_mem.hpp - Native CPU Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+namespace native_cpu {
+
+// The local memory available to a work-group, reported as the local memory
+// size of the device.
+constexpr size_t maxLocalMemSize = 32 * 1024;
+
+// Scratch memory holding the local arguments of the work-groups run by the
+// threads of a device. Each worker thread gets its own slice of
+// maxLocalMemSize bytes, page aligned so that no cache line or page is shared
+// with another worker. A worker runs one work-group at a time, so its slice
+// is reused by all the kernels and launches it runs.
+class local_mem_arena {
+public:
+  explicit local_mem_arena(size_t numWorkers) : numWorkers(numWorkers) {}
+  ~local_mem_arena();
+
+  local_mem_arena(const local_mem_arena &) = delete;
+  local_mem_arena &operator=(const local_mem_arena &) = delete;
+
+  // Maps the slices, when a kernel first needs local memory. Returns false if
+  // they can't be allocated. Their pages are only touched by the workers
+  // owning them, so that they end up on the NUMA node of their worker.
+  bool reserve();
+
+  // Returns the slice of a worker, once the slices have been reserved.
+  char *get(size_t worker) const noexcept { return base + worker * sliceSize; }
+
+  // Returns a slice owned by the calling thread, for work-groups run outside
+  // of the workers. It comes from the heap if the pages can't be mapped, and
+  // is null only if neither can be allocated.
+  static char *getForCallingThread() noexcept;
+
+private:
+  const size_t numWorkers;
+  size_t sliceSize = 0;
+  char *base = nullptr;
+  std::once_flag reserved;
+};
+
+} // namespace native_cpu
@@ -0,0 +1,218 @@
+//===--------- memops.cpp - Native CPU Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "memops.hpp"
+
+namespace native_cpu {
+namespace {
+constexpr size_t lineSize = 64;
+// Largest block of replicated pattern built on the stack by fill.
+constexpr size_t maxBlockSize = 4096;
+// Smallest amount of memory worth handing to another thread.
+constexpr size_t minChunkSize = 256 * 1024;
+
+// Splits numItems items of itemSize bytes in at most maxChunks chunks of at
+// least minChunkSize bytes, returns the number of items per chunk.
+size_t itemsPerChunk(size_t numItems, size_t itemSize, size_t maxChunks) {
+  const size_t numChunks = std::clamp<size_t>(
+      numItems * itemSize / minChunkSize, 1, std::max<size_t>(maxChunks, 1));
+  return std::max<size_t>((numItems + numChunks - 1) / numChunks, 1);
+}
+
+size_t divRoundUp(size_t lhs, size_t rhs) { return (lhs + rhs - 1) / rhs; }
+
+rect_desc withDefaultPitches(rect_desc rect, const ur_rect_region_t &region) {
+  if (rect.rowPitch == 0)
+    rect.rowPitch = region.width;
+  if (rect.slicePitch == 0)
+    rect.slicePitch = rect.rowPitch * region.height;
+  return rect;
+}
+
+char *rowBegin(const rect_desc &rect, size_t row, size_t height) {
+  return rect.mem + (rect.offset.z + row / height) * rect.slicePitch +
+         (rect.offset.y + row % height) * rect.rowPitch + rect.offset.x;
+}
+
+// Copies the rows [begin, end) of the region, numbered through all its slices.
+// The pitches must have been defaulted.
+void copyRows(const rect_desc &dst, const rect_desc &src,
+              const ur_rect_region_t &region, size_t begin, size_t end) {
+  for (size_t row = begin; row < end; row++) {
+    std::memmove(rowBegin(dst, row, region.height),
+                 rowBegin(src, row, region.height), region.width);
+  }
+}
+
+bool isContiguous(const rect_desc &rect, const ur_rect_region_t &region) {
+  return rect.rowPitch == region.width &&
+         (region.depth == 1 || rect.slicePitch == region.width * region.height);
+}
+} // namespace
+
+void fill(void *ptr, const void *pattern, size_t patternSize, size_t size) {
+  auto *dst = static_cast<char *>(ptr);
+  if (patternSize == 1) {
+    std::memset(dst, *static_cast<const uint8_t *>(pattern), size);
+    return;
+  }
+  if (patternSize > maxBlockSize / 4 || size <= patternSize) {
+    for (size_t i = 0; i < size; i += patternSize) {
+      std::memcpy(dst + i, pattern, std::min(patternSize, size - i));
+    }
+    return;
+  }
+
+  // Replicate the pattern into a block holding a whole number of copies of
+  // it, and store the block repeatedly. Patterns dividing a cache line are
+  // stored a line at a time with a fixed size copy, which the compiler turns
+  // into vector stores. Other patterns use a larger block so that the
+  // copies are long enough for memcpy to use vector stores.
+  alignas(lineSize) char block[maxBlockSize];
+  const bool lineFill = lineSize % patternSize == 0;
+  const size_t blockSize =
+      lineFill ? lineSize
+               : std::min(maxBlockSize / patternSize,
+                          divRoundUp(size, patternSize)) *
+                     patternSize;
+  for (size_t i = 0; i < blockSize; i += patternSize) {
+    std::memcpy(block + i, pattern, patternSize);
+  }
+  size_t i = 0;
+  if (lineFill) {
+    for (; i + lineSize <= size; i += lineSize) {
+      std::memcpy(dst + i, block, lineSize);
+    }
+  } else {
+    for (; i + blockSize <= size; i += blockSize) {
+      std::memcpy(dst + i, block, blockSize);
+    }
+  }
+  // i is a multiple of the pattern size, the block lines up with the rest.
+  std::memcpy(dst + i, block, size - i);
+}
+
+void copyRect(const rect_desc &dst, const rect_desc &src,
+              ur_rect_region_t region) {
+  makeCopyRect(dst, src, region, 1)();
+}
+
+mem_op makeCopy(void *dst, const void *src, size_t size, size_t numChunks) {
+  auto *dstMem = static_cast<char *>(dst);
+  auto *srcMem = static_cast<const char *>(src);
+  mem_op op;
+  if (size == 0 || dstMem == srcMem) {
+    op.runChunk = [](size_t) {};
+    return op;
+  }
+  // Overlapping copies depend on the order the bytes are copied in.
+  if (dstMem < srcMem + size && srcMem < dstMem + size) {
+    op.runChunk = [=](size_t) { std::memmove(dstMem, srcMem, size); };
+    return op;
+  }
+  const size_t chunkSize =
+      itemsPerChunk(divRoundUp(size, lineSize), lineSize, numChunks) *
+      lineSize;
+  op.numChunks = divRoundUp(size, chunkSize);
+  op.runChunk = [=](size_t chunk) {
+    const size_t begin = chunk * chunkSize;
+    std::memcpy(dstMem + begin, srcMem + begin,
+                std::min(chunkSize, size - begin));
+  };
+  return op;
+}
+
+mem_op makeFill(void *ptr, const void *pattern, size_t patternSize,
+                size_t size, size_t numChunks) {
+  auto *mem = static_cast<char *>(ptr);
+  std::vector<uint8_t> patternCopy(static_cast<const uint8_t *>(pattern),
+                                   static_cast<const uint8_t *>(pattern) +
+                                       patternSize);
+  // Chunks start on a whole pattern, and on a cache line when possible.
+  const size_t unit = std::lcm(patternSize, lineSize);
+  const size_t chunkSize =
+      itemsPerChunk(divRoundUp(size, unit), unit, numChunks) * unit;
+  mem_op op;
+  op.numChunks = std::max<size_t>(divRoundUp(size, chunkSize), 1);
+  op.runChunk = [=, bytes = std::move(patternCopy)](size_t chunk) {
+    const size_t begin = chunk * chunkSize;
+    fill(mem + begin, bytes.data(), bytes.size(),
+         std::min(chunkSize, size - begin));
+  };
+  return op;
+}
+
+mem_op makeCopyRect(const rect_desc &dst, const rect_desc &src,
+                    ur_rect_region_t region, size_t numChunks) {
+  const rect_desc dstRect = withDefaultPitches(dst, region);
+  const rect_desc srcRect = withDefaultPitches(src, region);
+  const size_t numRows = region.height * region.depth;
+  if (region.width == 0 || numRows == 0) {
+    mem_op op;
+    op.runChunk = [](size_t) {};
+    return op;
+  }
+  if (isContiguous(dstRect, region) && isContiguous(srcRect, region)) {
+    return makeCopy(rowBegin(dstRect, 0, region.height),
+                    rowBegin(srcRect, 0, region.height),
+                    region.width * numRows, numChunks);
+  }
+  // A copy within an allocation may overlap itself, keep it on one thread so
+  // that the rows are copied in order.
+  if (dstRect.mem == srcRect.mem) {
+    numChunks = 1;
+  }
+  const size_t rowsPerChunk = itemsPerChunk(numRows, region.width, numChunks);
+  mem_op op;
+  op.numChunks = divRoundUp(numRows, rowsPerChunk);
+  op.runChunk = [=](size_t chunk) {
+    const size_t begin = chunk * rowsPerChunk;
+    copyRows(dstRect, srcRect, region, begin,
+             std::min(begin + rowsPerChunk, numRows));
+  };
+  return op;
+}
+
+mem_op makeFill2D(void *ptr, size_t pitch, const void *pattern,
+                  size_t patternSize, size_t width, size_t height,
+                  size_t numChunks) {
+  if (pitch == width) {
+    return makeFill(ptr, pattern, patternSize, width * height, numChunks);
+  }
+  auto *mem = static_cast<char *>(ptr);
+  std::vector<uint8_t> patternCopy(static_cast<const uint8_t *>(pattern),
+                                   static_cast<const uint8_t *>(pattern) +
+                                       patternSize);
+  const size_t rowsPerChunk =
+      itemsPerChunk(std::max<size_t>(height, 1), width, numChunks);
+  mem_op op;
+  op.numChunks = std::max<size_t>(divRoundUp(height, rowsPerChunk), 1);
+  op.runChunk = [=, bytes = std::move(patternCopy)](size_t chunk) {
+    const size_t end = std::min((chunk + 1) * rowsPerChunk, height);
+    for (size_t row = chunk * rowsPerChunk; row < end; row++) {
+      // The pattern carries on from the end of the previous row, the row
+      // starts with the rest of the pattern before repeating it whole.
+      char *rowMem = mem + row * pitch;
+      const size_t phase = row * width % patternSize;
+      const size_t head = std::min(width, (patternSize - phase) % patternSize);
+      std::memcpy(rowMem, bytes.data() + phase, head);
+      fill(rowMem + head, bytes.data(), bytes.size(), width - head);
+    }
+  };
+  return op;
+}
+
+} // namespace native_cpu
@@ -0,0 +1,68 @@
+//===--------- memops.hpp - Native CPU Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ur_api.h"
+
+namespace native_cpu {
+
+// A memory operation split into chunks touching disjoint memory, so that they
+// can run in parallel and in any order.
+struct mem_op {
+  size_t numChunks = 1;
+  std::function<void(size_t chunk)> runChunk;
+
+  // Runs all the chunks on the calling thread.
+  void operator()() const {
+    for (size_t chunk = 0; chunk < numChunks; chunk++) {
+      runChunk(chunk);
+    }
+  }
+};
+
+// A rectangular region of an allocation, pitches of zero are computed from
+// the region copied.
+struct rect_desc {
+  char *mem;
+  ur_rect_offset_t offset;
+  size_t rowPitch;
+  size_t slicePitch;
+};
+
+// Fills size bytes at ptr with copies of a pattern of patternSize bytes. If
+// size isn't a multiple of patternSize the last copy is truncated.
+void fill(void *ptr, const void *pattern, size_t patternSize, size_t size);
+
+// Copies a rectangular region, one row at a time.
+void copyRect(const rect_desc &dst, const rect_desc &src,
+              ur_rect_region_t region);
+
+// The operations below are split in up to numChunks chunks, fewer if they
+// are too small for it to pay off. The pattern of fills is copied.
+
+// Copies size bytes from src to dst, which may overlap.
+mem_op makeCopy(void *dst, const void *src, size_t size, size_t numChunks);
+
+mem_op makeFill(void *ptr, const void *pattern, size_t patternSize,
+                size_t size, size_t numChunks);
+
+mem_op makeCopyRect(const rect_desc &dst, const rect_desc &src,
+                    ur_rect_region_t region, size_t numChunks);
+
+// Fills height rows of width bytes, pitch bytes apart, as if they were
+// contiguous: a row continues the pattern where the previous one ended.
+mem_op makeFill2D(void *ptr, size_t pitch, const void *pattern,
+                  size_t patternSize, size_t width, size_t height,
+                  size_t numChunks);
+
+} // namespace native_cpu
@@ -8,10 +8,70 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "memory.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
 #include "common.hpp"
+#include "memops.hpp"
+#include "memory.hpp"
 #include "ur_api.h"
 
+namespace {
+// A copy run by the calling thread together with the device threads. Chunks
+// are claimed rather than assigned, so the caller never waits for a chunk
+// that no thread has started, even when it is itself one of the device
+// threads.
+struct parallel_copy {
+  parallel_copy(native_cpu::mem_op &&op)
+      : op(std::move(op)), remaining(this->op.numChunks) {}
+
+  void runChunks() {
+    for (size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+         chunk < op.numChunks;
+         chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+      op.runChunk(chunk);
+      if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Notifying under the lock ensures the waiter can't miss it
+        std::lock_guard<std::mutex> lock(mutex);
+        done.notify_all();
+      }
+    }
+  }
+
+  // Blocks until the chunks claimed by the other threads have run.
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]() {
+      return remaining.load(std::memory_order_acquire) == 0;
+    });
+  }
+
+  native_cpu::mem_op op;
+  std::atomic<size_t> nextChunk{0};
+  std::atomic<size_t> remaining;
+  std::mutex mutex;
+  std::condition_variable done;
+};
+
+// Copies the host data of a new buffer. Large copies are shared with the
+// device threads, which is faster and spreads the pages of the buffer over
+// the NUMA nodes the threads run on.
+void copyHostData(char *dst, const void *src, size_t size,
+                  native_cpu::threadpool_t &tp) {
+  auto copy = std::make_shared<parallel_copy>(
+      native_cpu::makeCopy(dst, src, size, tp.num_threads()));
+  for (size_t i = 1; i < copy->op.numChunks; i++) {
+    tp.schedule([copy](size_t) { copy->runChunks(); });
+  }
+  copy->runChunks();
+  // Once there are no more chunks to claim, the ones left are run by busy
+  // threads, so the caller sleeps rather than burning a core.
+  copy->wait();
+}
+} // namespace
+
 UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreate(
     ur_context_handle_t hContext, ur_mem_flags_t flags,
     const ur_image_format_t *pImageFormat, const ur_image_desc_t *pImageDesc,
@@ -31,7 +91,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
     const ur_buffer_properties_t *pProperties, ur_mem_handle_t *phBuffer) {
 
   // TODO: add proper error checking and double check flag semantics
-  // TODO: support UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER flag
 
   UR_ASSERT(phBuffer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
@@ -46,16 +105,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
   UR_ASSERT(size != 0, UR_RESULT_ERROR_INVALID_BUFFER_SIZE);
 
   const bool useHostPtr = flags & UR_MEM_FLAG_USE_HOST_POINTER;
-  const bool copyHostPtr = flags & UR_MEM_FLAG_USE_HOST_POINTER;
+  const bool copyHostPtr = flags & UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER;
 
   ur_mem_handle_t_ *retMem;
 
   if (useHostPtr) {
-    retMem = new _ur_buffer(hContext, pProperties->pHost);
-  } else if (copyHostPtr) {
     retMem = new _ur_buffer(hContext, pProperties->pHost, size);
   } else {
     retMem = new _ur_buffer(hContext, size);
+    if (!retMem->_mem) {
+      delete retMem;
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    if (copyHostPtr) {
+      copyHostData(retMem->_mem, pProperties->pHost, size,
+                   hContext->_device->tp);
+    }
   }
 
   *phBuffer = retMem;
@@ -71,8 +136,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemRetain(ur_mem_handle_t hMem) {
 UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
   UR_ASSERT(hMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  hMem->decrementRefCount();
-  if (hMem->_refCount > 0) {
+  if (--hMem->_refCount > 0) {
     return UR_RESULT_SUCCESS;
   }
 
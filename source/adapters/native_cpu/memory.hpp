@@ -13,37 +13,32 @@
 #include <atomic>
 #include <cstdlib>
 #include <cstring>
+#include <unordered_map>
 
 #include "common.hpp"
 #include "context.hpp"
 
 struct ur_mem_handle_t_ : _ur_object {
   ur_mem_handle_t_(size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true},
+      : _mem{static_cast<char *>(malloc(Size))}, _size{Size}, _ownsMem{true},
         IsImage{_IsImage} {}
 
   ur_mem_handle_t_(void *HostPtr, size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true}, IsImage{
-                                                                     _IsImage} {
-    memcpy(_mem, HostPtr, Size);
-  }
-
-  ur_mem_handle_t_(void *HostPtr, bool _IsImage)
-      : _mem{static_cast<char *>(HostPtr)}, _ownsMem{false}, IsImage{_IsImage} {
-  }
+      : _mem{static_cast<char *>(HostPtr)}, _size{Size}, _ownsMem{false},
+        IsImage{_IsImage} {}
 
-  ~ur_mem_handle_t_() {
+  // Memory objects are released through ur_mem_handle_t.
+  virtual ~ur_mem_handle_t_() {
     if (_ownsMem) {
       free(_mem);
     }
   }
 
-  void decrementRefCount() noexcept { _refCount--; }
-
   // Method to get type of the derived object (image or buffer)
   bool isImage() const { return this->IsImage; }
 
   char *_mem;
+  size_t _size;
   bool _ownsMem;
   std::atomic_uint32_t _refCount = {1};
 
@@ -52,16 +47,13 @@ private:
 };
 
 struct _ur_buffer final : ur_mem_handle_t_ {
-  // Buffer constructor
-  _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr)
-      : ur_mem_handle_t_(HostPtr, false) {}
+  // Buffer constructors, the first one uses the host memory directly.
   _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr, size_t Size)
       : ur_mem_handle_t_(HostPtr, Size, false) {}
   _ur_buffer(ur_context_handle_t /* Context*/, size_t Size)
       : ur_mem_handle_t_(Size, false) {}
   _ur_buffer(_ur_buffer *b, size_t Offset, size_t Size)
-      : ur_mem_handle_t_(b->_mem + Offset, false), SubBuffer(b) {
-    std::ignore = Size;
+      : ur_mem_handle_t_(b->_mem + Offset, Size, false), SubBuffer(b) {
     SubBuffer.Origin = Offset;
   }
 
@@ -73,4 +65,10 @@ struct _ur_buffer final : ur_mem_handle_t_ {
     _ur_buffer *const Parent;
     size_t Origin; // only valid if Parent != nullptr
   } SubBuffer;
+
+  // The buffer memory is directly accessible on the host, so mapping a region
+  // returns a pointer into it and never copies. Mappings are only counted
+  // by pointer, to reject unmapping a pointer that isn't mapped. Protected
+  // by Mutex.
+  std::unordered_map<void *, size_t> Mappings;
 };
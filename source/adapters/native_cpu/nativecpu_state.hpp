@@ -8,6 +8,7 @@
 //
 //===----------------------------------------------------------------------===//
 #pragma once
+#include <cstdint>
 #include <cstdlib>
 namespace native_cpu {
 
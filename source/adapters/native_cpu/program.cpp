@@ -64,6 +64,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
   UR_ASSERT(phProgram, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pBinary != nullptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
+  // The kernel table is built first, the metadata is attached to it.
   auto hProgram = std::make_unique<ur_program_handle_t_>(
       hContext, reinterpret_cast<const unsigned char *>(pBinary));
   if (pProperties != nullptr) {
@@ -77,19 +78,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
         if (res != UR_RESULT_SUCCESS) {
           return res;
         }
-        hProgram->KernelReqdWorkGroupSizeMD[Prefix] = std::move(reqdWGSize);
+        hProgram->_kernels.setReqdWGSize(Prefix, reqdWGSize);
       }
     }
   }
 
-  const nativecpu_entry *nativecpu_it =
-      reinterpret_cast<const nativecpu_entry *>(pBinary);
-  while (nativecpu_it->kernel_ptr != nullptr) {
-    hProgram->_kernels.insert(
-        std::make_pair(nativecpu_it->kernelname, nativecpu_it->kernel_ptr));
-    nativecpu_it++;
-  }
-
   *phProgram = hProgram.release();
 
   return UR_RESULT_SUCCESS;
@@ -13,38 +13,17 @@
 #include <ur_api.h>
 
 #include "context.hpp"
-
-#include <array>
-#include <map>
-
-namespace native_cpu {
-using ReqdWGSize_t = std::array<uint32_t, 3>;
-}
+#include "kernel_table.hpp"
 
 struct ur_program_handle_t_ : RefCounted {
   ur_program_handle_t_(ur_context_handle_t ctx, const unsigned char *pBinary)
-      : _ctx{ctx}, _ptr{pBinary} {}
+      : _ctx{ctx}, _ptr{pBinary},
+        _kernels{reinterpret_cast<const nativecpu_entry *>(pBinary)} {}
 
   uint32_t getReferenceCount() const noexcept { return _refCount; }
 
   ur_context_handle_t _ctx;
   const unsigned char *_ptr;
-  struct _compare {
-    bool operator()(char const *a, char const *b) const {
-      return std::strcmp(a, b) < 0;
-    }
-  };
-
-  std::map<const char *, const unsigned char *, _compare> _kernels;
-  std::unordered_map<std::string, native_cpu::ReqdWGSize_t>
-      KernelReqdWorkGroupSizeMD;
-};
-
-// The nativecpu_entry struct is also defined as LLVM-IR in the
-// clang-offload-wrapper tool. The two definitions need to match,
-// therefore any change to this struct needs to be reflected in the
-// offload-wrapper.
-struct nativecpu_entry {
-  const char *kernelname;
-  const unsigned char *kernel_ptr;
+  // The kernels of the binary, with the metadata of the program attached.
+  native_cpu::kernel_table _kernels;
 };
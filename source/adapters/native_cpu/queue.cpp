@@ -8,34 +8,274 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "queue.hpp"
 #include "common.hpp"
+#include "event.hpp"
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
 
+ur_queue_handle_t_::ur_queue_handle_t_(ur_device_handle_t_ *device,
+                                       ur_context_handle_t context,
+                                       ur_queue_flags_t flags)
+    : device(device), context(context), flags(flags) {
+  if (isProfiling()) {
+    device->tp.enable_profiling();
+  }
+}
+
+ur_queue_handle_t_::~ur_queue_handle_t_() {
+  if (isProfiling()) {
+    // The busy time of the workers shows how evenly the commands of the
+    // device, not only of this queue, are spread over them.
+    for (size_t i = 0; i < device->tp.num_threads(); i++) {
+      const auto busy = device->tp.busy_time(i);
+      logger::info("native_cpu: worker {} busy for {} us running {} tasks", i,
+                   busy.busyNs / 1000, busy.numTasks);
+    }
+  }
+}
+
+void ur_queue_handle_t_::release() {
+  if (decrementReferenceCount() != 0) {
+    return;
+  }
+  // The events tracked by the queue keep it alive, they are dropped to break
+  // the cycle. The commands in flight still complete, after which their
+  // events release the queue.
+  std::vector<ur_event_handle_t> tracked;
+  {
+    std::lock_guard<std::mutex> lock(enqueueMutex);
+    if (lastEvent) {
+      tracked.push_back(lastEvent);
+      lastEvent = nullptr;
+    }
+    if (barrierEvent) {
+      tracked.push_back(barrierEvent);
+      barrierEvent = nullptr;
+    }
+    tracked.insert(tracked.end(), submitted.begin(), submitted.end());
+    submitted.clear();
+  }
+  for (auto event : tracked) {
+    decrementOrDelete(event);
+  }
+  releaseForEvent();
+}
+
+void ur_queue_handle_t_::releaseForEvent() {
+  if (numLifetimeRefs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+ur_result_t ur_queue_handle_t_::enqueue(ur_command_t commandType,
+                                        uint32_t numEventsInWaitList,
+                                        const ur_event_handle_t *phEventWaitList,
+                                        ur_event_handle_t *phEvent,
+                                        command_start_t &&start,
+                                        bool blocking) {
+  return submit(commandType, numEventsInWaitList, phEventWaitList, phEvent,
+                std::move(start), blocking, command_kind::regular,
+                isProfiling());
+}
+
+ur_result_t ur_queue_handle_t_::enqueueMarker(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    bool isBarrier) {
+  return submit(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [](ur_event_handle_t event) { event->complete(); }, false,
+      isBarrier ? command_kind::barrier : command_kind::marker, isProfiling());
+}
+
+ur_result_t ur_queue_handle_t_::enqueueTimestampRecording(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent, bool blocking) {
+  return submit(
+      UR_COMMAND_TIMESTAMP_RECORDING_EXP, numEventsInWaitList,
+      phEventWaitList, phEvent,
+      [](ur_event_handle_t event) { event->complete(); }, blocking,
+      command_kind::regular, true);
+}
+
+void ur_queue_handle_t_::trackOutOfOrder(ur_event_handle_t event,
+                                         command_kind kind, bool waitsForAll,
+                                         dependency_list &deps) {
+  // The dependencies taken from the queue are retained, as they may be
+  // released by another enqueue before the continuations are registered.
+  auto addDep = [&deps](ur_event_handle_t dep) {
+    if (!dep->isComplete()) {
+      dep->incrementReferenceCount();
+      deps.push_back(dep);
+    }
+  };
+  if (barrierEvent) {
+    addDep(barrierEvent);
+  }
+  if (kind != command_kind::regular && waitsForAll) {
+    for (auto dep : submitted) {
+      addDep(dep);
+      decrementOrDelete(dep);
+    }
+    submitted.clear();
+  }
+
+  if (kind == command_kind::barrier) {
+    // The commands enqueued afterwards wait for the barrier, and so does any
+    // marker waiting for all the previous commands.
+    event->incrementReferenceCount();
+    if (barrierEvent) {
+      decrementOrDelete(barrierEvent);
+    }
+    barrierEvent = event;
+    return;
+  }
+
+  if (submitted.size() >= pruneThreshold) {
+    auto it = std::remove_if(submitted.begin(), submitted.end(),
+                             [](ur_event_handle_t submittedEvent) {
+                               if (!submittedEvent->isComplete()) {
+                                 return false;
+                               }
+                               decrementOrDelete(submittedEvent);
+                               return true;
+                             });
+    submitted.erase(it, submitted.end());
+    pruneThreshold = std::max(pruneThreshold, 2 * submitted.size());
+  }
+  event->incrementReferenceCount();
+  submitted.push_back(event);
+}
+
+ur_result_t ur_queue_handle_t_::submit(ur_command_t commandType,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       ur_event_handle_t *phEvent,
+                                       command_start_t &&start, bool blocking,
+                                       command_kind kind, bool profiling) {
+  UR_ASSERT(numEventsInWaitList == 0 || phEventWaitList,
+            UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+  auto *event = new ur_event_handle_t_(this, commandType, profiling);
+  if (phEvent) {
+    event->incrementReferenceCount();
+    *phEvent = event;
+  }
+  if (blocking) {
+    event->incrementReferenceCount();
+  }
+  {
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    numPending++;
+  }
+
+  dependency_list deps;
+  for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+    if (!phEventWaitList[i]->isComplete()) {
+      deps.push_back(phEventWaitList[i]);
+    }
+  }
+  // The dependencies added past this point hold a reference owned by this
+  // function.
+  const size_t numWaitListDeps = deps.size();
+
+  {
+    std::lock_guard<std::mutex> lock(enqueueMutex);
+    if (isInOrder()) {
+      // The previous command already waits for every command before it, so
+      // it is the only dependency needed from the queue. The queue's
+      // reference to it is handed over to deps.
+      if (lastEvent && !lastEvent->isComplete()) {
+        deps.push_back(lastEvent);
+      } else if (lastEvent) {
+        decrementOrDelete(lastEvent);
+      }
+      event->incrementReferenceCount();
+      lastEvent = event;
+    } else {
+      trackOutOfOrder(event, kind, numEventsInWaitList == 0, deps);
+    }
+  }
+
+  // Each command is a node of the dependency graph, it is started by the
+  // completion of its last incomplete dependency. One extra count is held
+  // while the continuations are being registered, so the command can't start
+  // before this is done. The command is stored in its event, so that the
+  // continuations only capture the event and don't need to allocate.
+  event->setSubmitted();
+  event->setPendingCommand(std::move(start), deps.size() + 1);
+  for (size_t i = 0; i < deps.size(); i++) {
+    deps[i]->onComplete([event]() { event->dependencyComplete(); });
+  }
+  event->dependencyComplete();
+
+  for (size_t i = numWaitListDeps; i < deps.size(); i++) {
+    decrementOrDelete(deps[i]);
+  }
+
+  if (blocking) {
+    event->wait();
+    decrementOrDelete(event);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_queue_handle_t_::finish() {
+  std::unique_lock<std::mutex> lock(pendingMutex);
+  pendingCv.wait(lock, [this]() { return numPending == 0; });
+}
+
+void ur_queue_handle_t_::commandComplete() {
+  // Notifying under the lock ensures the queue can't be destroyed by a thread
+  // returning from finish() while this is still using it.
+  std::lock_guard<std::mutex> lock(pendingMutex);
+  if (--numPending == 0) {
+    pendingCv.notify_all();
+  }
+}
+
+bool ur_queue_handle_t_::isEmpty() {
+  std::lock_guard<std::mutex> lock(pendingMutex);
+  return numPending == 0;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
                                                    ur_queue_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hQueue;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  switch (propName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hQueue->getContext());
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(static_cast<ur_device_handle_t>(hQueue->device));
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(hQueue->getFlags());
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hQueue->getReferenceCount()});
+  case UR_QUEUE_INFO_EMPTY:
+    return ReturnValue(static_cast<ur_bool_t>(hQueue->isEmpty()));
+  default:
+    DIE_NO_IMPLEMENTATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pProperties;
+  UR_ASSERT(phQueue, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  auto Queue = new ur_queue_handle_t_(hDevice);
+  ur_queue_flags_t flags = pProperties ? pProperties->flags : 0;
+  auto Queue = new ur_queue_handle_t_(hDevice, hContext, flags);
   *phQueue = Queue;
 
   return UR_RESULT_SUCCESS;
@@ -49,7 +289,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
-  decrementOrDelete(hQueue);
+  hQueue->release();
 
   return UR_RESULT_SUCCESS;
 }
@@ -78,13 +318,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
-  // TODO: is this fine as no-op?
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hQueue->finish();
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
   std::ignore = hQueue;
-
-  DIE_NO_IMPLEMENTATION;
+  // Commands are submitted as soon as their dependencies are satisfied, there
+  // is nothing to flush.
+  return UR_RESULT_SUCCESS;
 }
@@ -8,11 +8,154 @@
 //
 //===----------------------------------------------------------------------===//
 #pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
 #include "common.hpp"
 #include "device.hpp"
+#include "enqueue.hpp"
+#include "event.hpp"
 
 struct ur_queue_handle_t_ : RefCounted {
   ur_device_handle_t_ *const device;
 
-  ur_queue_handle_t_(ur_device_handle_t_ *device) : device(device) {}
+  ur_queue_handle_t_(ur_device_handle_t_ *device, ur_context_handle_t context,
+                     ur_queue_flags_t flags);
+
+  ~ur_queue_handle_t_();
+
+  // Drops a reference to the queue. Once the last one is dropped the queue
+  // releases the events it tracks, and is destroyed with the last of its
+  // events, which may still refer to it.
+  void release();
+
+  // Called by the events of this queue when they are created and destroyed.
+  void retainForEvent() noexcept {
+    numLifetimeRefs.fetch_add(1, std::memory_order_relaxed);
+  }
+  void releaseForEvent();
+
+  // Starts a command, gets the event to complete once the work is done.
+  using command_start_t = ur_event_handle_t_::command_start_t;
+
+  // Enqueues a command on the queue. The command is started once all the
+  // events in the wait list have completed, as well as the previously enqueued
+  // command for in-order queues, or the last barrier for out-of-order queues.
+  // If blocking is set this only returns once the command has completed.
+  ur_result_t enqueue(ur_command_t commandType, uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent, command_start_t &&start,
+                      bool blocking = false);
+
+  // Enqueues a command that completes once the events in the wait list have
+  // completed, or all the commands previously enqueued if the wait list is
+  // empty. If isBarrier is set, the commands enqueued afterwards also wait for
+  // it to complete.
+  ur_result_t enqueueMarker(ur_command_t commandType,
+                            uint32_t numEventsInWaitList,
+                            const ur_event_handle_t *phEventWaitList,
+                            ur_event_handle_t *phEvent, bool isBarrier);
+
+  // Enqueues a command recording the time at which it runs in its event,
+  // whether or not profiling is enabled on the queue.
+  ur_result_t
+  enqueueTimestampRecording(uint32_t numEventsInWaitList,
+                            const ur_event_handle_t *phEventWaitList,
+                            ur_event_handle_t *phEvent, bool blocking);
+
+  // Blocks until all the commands enqueued so far have completed.
+  void finish();
+
+  // Called by the events of this queue when their command completes.
+  void commandComplete();
+
+  bool isEmpty();
+
+  ur_context_handle_t getContext() const noexcept { return context; }
+
+  ur_queue_flags_t getFlags() const noexcept { return flags; }
+
+  bool isInOrder() const noexcept {
+    return !(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+  }
+
+  bool isProfiling() const noexcept {
+    return flags & UR_QUEUE_FLAG_PROFILING_ENABLE;
+  }
+
+  // Descriptors of the kernel launches enqueued on the queue.
+  native_cpu::launch_desc_pool &getLaunchDescs() noexcept {
+    return launchDescs;
+  }
+
+private:
+  enum class command_kind { regular, marker, barrier };
+
+  // The events a command depends on. Commands rarely have more than a few
+  // dependencies, those are stored inline so that enqueuing doesn't allocate.
+  class dependency_list {
+  public:
+    void push_back(ur_event_handle_t event) {
+      if (numDeps < inlineDeps.size()) {
+        inlineDeps[numDeps] = event;
+      } else {
+        overflowDeps.push_back(event);
+      }
+      numDeps++;
+    }
+
+    ur_event_handle_t operator[](size_t i) const noexcept {
+      return i < inlineDeps.size() ? inlineDeps[i]
+                                   : overflowDeps[i - inlineDeps.size()];
+    }
+
+    size_t size() const noexcept { return numDeps; }
+
+  private:
+    std::array<ur_event_handle_t, 8> inlineDeps;
+    std::vector<ur_event_handle_t> overflowDeps;
+    size_t numDeps = 0;
+  };
+
+  ur_result_t submit(ur_command_t commandType, uint32_t numEventsInWaitList,
+                     const ur_event_handle_t *phEventWaitList,
+                     ur_event_handle_t *phEvent, command_start_t &&start,
+                     bool blocking, command_kind kind, bool profiling);
+
+  // Adds the commands an out-of-order command depends on in the queue to deps,
+  // and records it for the markers enqueued later. Called with enqueueMutex
+  // held.
+  void trackOutOfOrder(ur_event_handle_t event, command_kind kind,
+                       bool waitsForAll, dependency_list &deps);
+
+  const ur_context_handle_t context;
+  const ur_queue_flags_t flags;
+
+  // One for each live event of the queue, and one held until the queue is
+  // released.
+  std::atomic<size_t> numLifetimeRefs{1};
+
+  // Serialises enqueues, so that commands are chained in submission order.
+  std::mutex enqueueMutex;
+  // Event of the last command enqueued on an in-order queue, the queue holds
+  // a reference to it.
+  ur_event_handle_t lastEvent = nullptr;
+  // Event of the last barrier enqueued on an out-of-order queue, every
+  // command enqueued after it depends on it.
+  ur_event_handle_t barrierEvent = nullptr;
+  // Events of the commands enqueued on an out-of-order queue since the last
+  // barrier that waited for all the previous commands. Completed events are
+  // pruned lazily, once the list reaches pruneThreshold entries.
+  std::vector<ur_event_handle_t> submitted;
+  size_t pruneThreshold = 64;
+
+  std::mutex pendingMutex;
+  std::condition_variable pendingCv;
+  size_t numPending = 0;
+
+  native_cpu::launch_desc_pool launchDescs;
 };
@@ -9,12 +9,15 @@
 #pragma once
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <cstdlib>
 #include <forward_list>
 #include <functional>
 #include <future>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <queue>
@@ -22,12 +25,45 @@
 #include <thread>
 #include <vector>
 
+#include "topology.hpp"
+
 namespace native_cpu {
 
 using worker_task_t = std::function<void(size_t)>;
 
+// Nanoseconds of the monotonic clock used for the profiling of the device.
+inline uint64_t getTimestamp() noexcept {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Time spent running tasks by a worker, while profiling was enabled.
+struct worker_busy_time {
+  uint64_t busyNs;
+  uint64_t numTasks;
+};
+
+// A task that can be scheduled without allocating. The caller owns its
+// storage, which must stay valid until run has been called; run may reuse or
+// free the task.
+struct intrusive_task {
+  void (*run)(intrusive_task *task, size_t threadId);
+};
+
 namespace detail {
 
+inline size_t get_num_threads() {
+  size_t numThreads;
+  char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_THREADS");
+  if (envVar) {
+    numThreads = std::stoul(envVar);
+  } else {
+    numThreads = std::thread::hardware_concurrency();
+  }
+  return numThreads;
+}
+
 class worker_thread {
 public:
   // Initializes state, but does not start the worker thread
@@ -174,22 +210,381 @@ protected:
   }
 
 private:
-  static size_t get_num_threads() {
-    size_t numThreads;
-    char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_THREADS");
-    if (envVar) {
-      numThreads = std::stoul(envVar);
+  std::forward_list<worker_thread> m_workers;
+
+  std::atomic<bool> m_isRunning;
+
+  const size_t m_numThreads;
+};
+
+// Lock-free work-stealing deque (Chase-Lev), using the memory orderings from
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al.).
+// Only the owning worker may push() and pop(), any thread may steal().
+template <typename T> class work_stealing_deque {
+  static_assert(std::is_pointer_v<T>, "deque elements must be pointers");
+
+  struct ring_buffer {
+    explicit ring_buffer(size_t capacity)
+        : m_mask(capacity - 1),
+          m_elements(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+    size_t capacity() const noexcept { return m_mask + 1; }
+
+    T load(int64_t i) const noexcept {
+      return m_elements[i & m_mask].load(std::memory_order_relaxed);
+    }
+
+    void store(int64_t i, T x) noexcept {
+      m_elements[i & m_mask].store(x, std::memory_order_relaxed);
+    }
+
+    const size_t m_mask;
+    std::unique_ptr<std::atomic<T>[]> m_elements;
+  };
+
+public:
+  explicit work_stealing_deque(size_t capacity = 256)
+      : m_top(0), m_bottom(0) {
+    m_buffers.push_back(std::make_unique<ring_buffer>(capacity));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+  }
+
+  void push(T x) {
+    int64_t b = m_bottom.load(std::memory_order_relaxed);
+    int64_t t = m_top.load(std::memory_order_acquire);
+    ring_buffer *a = m_buffer.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(a->capacity()) - 1) {
+      a = grow(a, b, t);
+    }
+    a->store(b, x);
+    // Publishes the element to thieves
+    m_bottom.store(b + 1, std::memory_order_release);
+  }
+
+  T pop() {
+    int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    ring_buffer *a = m_buffer.load(std::memory_order_relaxed);
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = m_top.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T x = a->load(b);
+    if (t == b) {
+      // Last element, race against thieves for it
+      if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+        x = nullptr;
+      }
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return x;
+  }
+
+  T steal() {
+    int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = m_bottom.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    ring_buffer *a = m_buffer.load(std::memory_order_acquire);
+    T x = a->load(t);
+    if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+      // Lost the race against another thief or the owner
+      return nullptr;
+    }
+    return x;
+  }
+
+  // Approximation of the number of elements, only used for heuristics
+  size_t size() const noexcept {
+    int64_t b = m_bottom.load(std::memory_order_relaxed);
+    int64_t t = m_top.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+  }
+
+private:
+  ring_buffer *grow(ring_buffer *a, int64_t b, int64_t t) {
+    auto grown = std::make_unique<ring_buffer>(a->capacity() * 2);
+    for (int64_t i = t; i < b; i++) {
+      grown->store(i, a->load(i));
+    }
+    // Thieves may still be reading from the old buffer, so it is only
+    // released when the deque is destroyed.
+    m_buffers.push_back(std::move(grown));
+    ring_buffer *newBuffer = m_buffers.back().get();
+    m_buffer.store(newBuffer, std::memory_order_release);
+    return newBuffer;
+  }
+
+  alignas(64) std::atomic<int64_t> m_top;
+  alignas(64) std::atomic<int64_t> m_bottom;
+  std::atomic<ring_buffer *> m_buffer;
+  std::vector<std::unique_ptr<ring_buffer>> m_buffers;
+};
+
+// Thread pool where every worker owns a work-stealing deque. Tasks scheduled
+// from outside the pool go through a shared injection queue, from which
+// workers grab batches into their own deque. Idle workers steal from the
+// deques of busy workers, and park on a condition variable when there is no
+// work left anywhere.
+class work_stealing_thread_pool {
+  struct alignas(64) worker_state {
+    work_stealing_deque<intrusive_task *> m_deque;
+    std::thread m_thread;
+    // Only written by the worker, read by busy_time().
+    std::atomic<uint64_t> m_busyNs{0};
+    std::atomic<uint64_t> m_numTasksRun{0};
+  };
+
+  // Wraps a std::function task, deleted once it has run.
+  struct function_task : intrusive_task {
+    function_task(const worker_task_t &task)
+        : intrusive_task{&function_task::run_and_delete}, m_task(task) {}
+
+    static void run_and_delete(intrusive_task *task, size_t threadId) {
+      auto *self = static_cast<function_task *>(task);
+      self->m_task(threadId);
+      delete self;
+    }
+
+    worker_task_t m_task;
+  };
+
+public:
+  work_stealing_thread_pool()
+      : work_stealing_thread_pool(thread_placement{get_num_threads()}) {}
+
+  // Creates the threads of placement, each of them pinning itself to its CPU
+  // before running tasks.
+  explicit work_stealing_thread_pool(thread_placement placement)
+      : m_placement(std::move(placement)), m_isRunning(true),
+        m_numThreads(m_placement.numThreads), m_numQueued(0), m_numTasks(0),
+        m_numSleeping(0), m_numWaiting(0), m_workers(m_numThreads) {
+    for (size_t i = 0; i < m_numThreads; i++) {
+      m_workers[i].m_thread = std::thread([this, i]() { this->run(i); });
+    }
+  }
+
+  ~work_stealing_thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(m_sleepMutex);
+      m_isRunning.store(false, std::memory_order_release);
+    }
+    m_sleepCondition.notify_all();
+    for (auto &w : m_workers) {
+      if (w.m_thread.joinable()) {
+        w.m_thread.join();
+      }
+    }
+  }
+
+  inline void schedule(const worker_task_t &task) {
+    schedule(new function_task(task));
+  }
+
+  inline void schedule(intrusive_task *task) {
+    m_numTasks.fetch_add(1, std::memory_order_relaxed);
+    // Counted before it's published, so that the worker popping the task
+    // never takes the counter below zero
+    m_numQueued.fetch_add(1, std::memory_order_seq_cst);
+    if (t_currentPool == this) {
+      // Tasks spawned by a worker go to its own deque
+      m_workers[t_currentWorker].m_deque.push(task);
     } else {
-      numThreads = std::thread::hardware_concurrency();
+      std::lock_guard<std::mutex> lock(m_injectMutex);
+      m_injected.push_back(task);
     }
-    return numThreads;
+    wake_one();
   }
 
-  std::forward_list<worker_thread> m_workers;
+  inline bool is_running() const noexcept {
+    return m_isRunning.load(std::memory_order_acquire);
+  }
+
+  inline size_t num_threads() const noexcept { return m_numThreads; }
+
+  inline const thread_placement &placement() const noexcept {
+    return m_placement;
+  }
+
+  inline size_t num_pending_tasks() const noexcept {
+    return m_numTasks.load(std::memory_order_acquire);
+  }
+
+  // Makes the workers measure the time they spend running tasks, which costs
+  // two reads of the clock per task.
+  void enable_profiling() noexcept {
+    m_profiling.store(true, std::memory_order_relaxed);
+  }
+
+  worker_busy_time busy_time(size_t workerId) const noexcept {
+    const worker_state &w = m_workers[workerId];
+    return {w.m_busyNs.load(std::memory_order_relaxed),
+            w.m_numTasksRun.load(std::memory_order_relaxed)};
+  }
+
+  void wait_for_all_pending_tasks() {
+    if (num_pending_tasks() == 0) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_doneMutex);
+    m_numWaiting.fetch_add(1, std::memory_order_seq_cst);
+    m_doneCondition.wait(lock, [this]() { return num_pending_tasks() == 0; });
+    m_numWaiting.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+private:
+  void wake_one() {
+    if (m_numSleeping.load(std::memory_order_seq_cst) > 0) {
+      // Taking the lock orders this notification after the sleeper has
+      // checked its wait predicate, so the wakeup cannot be lost.
+      { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+      m_sleepCondition.notify_one();
+    }
+  }
+
+  // Moves a batch of tasks from the injection queue to the worker's deque and
+  // returns one of them to run.
+  intrusive_task *take_injected(size_t workerId) {
+    std::lock_guard<std::mutex> lock(m_injectMutex);
+    const size_t numInjected = m_injected.size() - m_injectedHead;
+    if (numInjected == 0) {
+      return nullptr;
+    }
+    size_t batch = std::min({numInjected, numInjected / m_numThreads + 1,
+                             m_maxInjectedBatch});
+    intrusive_task *task = m_injected[m_injectedHead++];
+    for (size_t i = 1; i < batch; i++) {
+      m_workers[workerId].m_deque.push(m_injected[m_injectedHead++]);
+    }
+    // The queue is a vector consumed from the front, it is compacted rather
+    // than shrunk so that its storage is reused by later schedules.
+    if (m_injectedHead == m_injected.size()) {
+      m_injected.clear();
+      m_injectedHead = 0;
+    } else if (m_injectedHead > m_injected.size() / 2) {
+      m_injected.erase(m_injected.begin(),
+                       m_injected.begin() + m_injectedHead);
+      m_injectedHead = 0;
+    }
+    return task;
+  }
+
+  intrusive_task *steal(size_t workerId, uint64_t &seed) {
+    // xorshift to pick a random first victim
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    size_t start = seed % m_numThreads;
+    for (size_t i = 0; i < m_numThreads; i++) {
+      size_t victim = (start + i) % m_numThreads;
+      if (victim == workerId) {
+        continue;
+      }
+      if (intrusive_task *task = m_workers[victim].m_deque.steal()) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  intrusive_task *find_task(size_t workerId, uint64_t &seed) {
+    if (intrusive_task *task = m_workers[workerId].m_deque.pop()) {
+      return task;
+    }
+    if (intrusive_task *task = take_injected(workerId)) {
+      return task;
+    }
+    return steal(workerId, seed);
+  }
+
+  void run(size_t workerId) {
+    m_placement.pin(workerId);
+    t_currentPool = this;
+    t_currentWorker = workerId;
+    uint64_t seed = workerId + 1;
+    while (true) {
+      intrusive_task *task = find_task(workerId, seed);
+      if (!task) {
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_numSleeping.fetch_add(1, std::memory_order_seq_cst);
+        m_sleepCondition.wait(lock, [this]() {
+          return !is_running() ||
+                 m_numQueued.load(std::memory_order_seq_cst) > 0;
+        });
+        m_numSleeping.fetch_sub(1, std::memory_order_relaxed);
+        if (!is_running() && m_numQueued.load(std::memory_order_acquire) == 0) {
+          // Can only break if there is no more work to be done
+          break;
+        }
+        continue;
+      }
+      m_numQueued.fetch_sub(1, std::memory_order_relaxed);
+      if (m_profiling.load(std::memory_order_relaxed)) {
+        run_profiled(task, workerId);
+      } else {
+        task->run(task, workerId);
+      }
+      if (m_numTasks.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+          m_numWaiting.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard<std::mutex> lock(m_doneMutex); }
+        m_doneCondition.notify_all();
+      }
+    }
+    t_currentPool = nullptr;
+  }
+
+  void run_profiled(intrusive_task *task, size_t workerId) {
+    worker_state &w = m_workers[workerId];
+    const uint64_t start = getTimestamp();
+    task->run(task, workerId);
+    w.m_busyNs.store(w.m_busyNs.load(std::memory_order_relaxed) +
+                         (getTimestamp() - start),
+                     std::memory_order_relaxed);
+    w.m_numTasksRun.store(w.m_numTasksRun.load(std::memory_order_relaxed) + 1,
+                          std::memory_order_relaxed);
+  }
+
+  static constexpr size_t m_maxInjectedBatch = 32;
+
+  static inline thread_local work_stealing_thread_pool *t_currentPool = nullptr;
+  static inline thread_local size_t t_currentWorker = 0;
+
+  const thread_placement m_placement;
 
   std::atomic<bool> m_isRunning;
 
   const size_t m_numThreads;
+
+  // Tasks scheduled but not yet picked up by a worker
+  std::atomic<size_t> m_numQueued;
+
+  // Tasks scheduled but not yet completed
+  std::atomic<size_t> m_numTasks;
+
+  std::atomic<size_t> m_numSleeping;
+
+  std::atomic<size_t> m_numWaiting;
+
+  std::atomic<bool> m_profiling{false};
+
+  std::vector<worker_state> m_workers;
+
+  std::mutex m_injectMutex;
+  std::vector<intrusive_task *> m_injected;
+  size_t m_injectedHead = 0;
+
+  std::mutex m_sleepMutex;
+  std::condition_variable m_sleepCondition;
+
+  std::mutex m_doneMutex;
+  std::condition_variable m_doneCondition;
 };
 } // namespace detail
 
@@ -199,8 +594,29 @@ template <typename ThreadPoolT> class threadpool_interface {
 public:
   size_t num_threads() const noexcept { return threadpool.num_threads(); }
 
+  const thread_placement &placement() const noexcept {
+    return threadpool.placement();
+  }
+
   threadpool_interface() : threadpool() {}
 
+  explicit threadpool_interface(thread_placement placement)
+      : threadpool(std::move(placement)) {}
+
+  // Schedules a task without tracking its completion, the task is
+  // responsible for signalling when it is done.
+  void schedule(worker_task_t &&task) { threadpool.schedule(task); }
+
+  // Same as above, but doesn't allocate.
+  void schedule(intrusive_task *task) { threadpool.schedule(task); }
+
+  // Starts measuring the busy time of the workers, it can't be stopped.
+  void enable_profiling() noexcept { threadpool.enable_profiling(); }
+
+  worker_busy_time busy_time(size_t threadId) const noexcept {
+    return threadpool.busy_time(threadId);
+  }
+
   auto schedule_task(worker_task_t &&task) {
     auto workerTask = std::make_shared<std::packaged_task<void(size_t)>>(
         [task](auto &&PH1) { return task(std::forward<decltype(PH1)>(PH1)); });
@@ -209,6 +625,6 @@ public:
   }
 };
 
-using threadpool_t = threadpool_interface<detail::simple_thread_pool>;
+using threadpool_t = threadpool_interface<detail::work_stealing_thread_pool>;
 
 } // namespace native_cpu
@@ -0,0 +1,215 @@
+//===--------- topology.cpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "common.hpp"
+#include "topology.hpp"
+#include "ur_util.hpp"
+
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+namespace native_cpu {
+namespace {
+// Parses a list of CPU ids and ranges in the format used by sysfs and taskset,
+// e.g. "0-3,8,10-11".
+std::optional<std::vector<unsigned>> parseCpuList(const std::string &list) {
+  std::vector<unsigned> ids;
+  size_t pos = 0;
+  while (pos < list.size()) {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    const std::string item = list.substr(pos, end - pos);
+    pos = end + 1;
+    if (item.empty() || item.find_first_not_of("0123456789-\n") !=
+                            std::string::npos) {
+      return std::nullopt;
+    }
+    try {
+      size_t dash = item.find('-');
+      unsigned first = std::stoul(item.substr(0, dash));
+      unsigned last =
+          dash == std::string::npos ? first : std::stoul(item.substr(dash + 1));
+      if (last < first) {
+        return std::nullopt;
+      }
+      for (unsigned id = first; id <= last; id++) {
+        ids.push_back(id);
+      }
+    } catch (...) {
+      return std::nullopt;
+    }
+  }
+  if (ids.empty()) {
+    return std::nullopt;
+  }
+  return ids;
+}
+
+#ifdef __linux__
+// Assigns the CPUs to the NUMA nodes listed in sysfs, CPUs are left on node 0
+// when there is no NUMA information.
+void readNumaNodes(std::vector<cpu_t> &cpus) {
+  DIR *dir = opendir("/sys/devices/system/node");
+  if (!dir) {
+    return;
+  }
+  while (dirent *entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if (name.rfind("node", 0) != 0 ||
+        name.find_first_not_of("0123456789", 4) != std::string::npos ||
+        name.size() == 4) {
+      continue;
+    }
+    const unsigned node = std::stoul(name.substr(4));
+    std::ifstream file("/sys/devices/system/node/" + name + "/cpulist");
+    std::string list;
+    if (!std::getline(file, list)) {
+      continue;
+    }
+    if (auto ids = parseCpuList(list)) {
+      for (auto &cpu : cpus) {
+        if (std::find(ids->begin(), ids->end(), cpu.id) != ids->end()) {
+          cpu.node = node;
+        }
+      }
+    }
+  }
+  closedir(dir);
+}
+#endif
+
+// Orders the CPUs so that threads taking them in order fill a NUMA node before
+// moving to the next one.
+std::vector<cpu_t> compactOrder(std::vector<cpu_t> cpus) {
+  std::stable_sort(cpus.begin(), cpus.end(),
+                   [](const cpu_t &lhs, const cpu_t &rhs) {
+                     return lhs.node < rhs.node;
+                   });
+  return cpus;
+}
+
+// Orders the CPUs so that threads taking them in order alternate between the
+// NUMA nodes.
+std::vector<cpu_t> scatterOrder(const std::vector<cpu_t> &cpus) {
+  std::vector<std::vector<cpu_t>> nodes;
+  for (const cpu_t &cpu : compactOrder(cpus)) {
+    if (nodes.empty() || nodes.back().front().node != cpu.node) {
+      nodes.emplace_back();
+    }
+    nodes.back().push_back(cpu);
+  }
+  std::vector<cpu_t> order;
+  for (size_t i = 0; order.size() < cpus.size(); i++) {
+    for (const auto &node : nodes) {
+      if (i < node.size()) {
+        order.push_back(node[i]);
+      }
+    }
+  }
+  return order;
+}
+} // namespace
+
+std::vector<cpu_t> getAvailableCpus() {
+  std::vector<cpu_t> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (unsigned id = 0; id < CPU_SETSIZE; id++) {
+      if (CPU_ISSET(id, &set)) {
+        cpus.push_back({id, 0});
+      }
+    }
+  }
+  readNumaNodes(cpus);
+#endif
+  if (cpus.empty()) {
+    const unsigned numCpus = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned id = 0; id < numCpus; id++) {
+      cpus.push_back({id, 0});
+    }
+  }
+  return cpus;
+}
+
+thread_placement getThreadPlacement() {
+  const std::vector<cpu_t> cpus = getAvailableCpus();
+  std::vector<cpu_t> order;
+  if (auto affinity = ur_getenv("SYCL_NATIVE_CPU_AFFINITY")) {
+    if (*affinity == "compact") {
+      order = compactOrder(cpus);
+    } else if (*affinity == "scatter") {
+      order = scatterOrder(cpus);
+    } else if (auto ids = parseCpuList(*affinity)) {
+      for (unsigned id : *ids) {
+        auto cpu = std::find_if(cpus.begin(), cpus.end(),
+                                [id](const cpu_t &cpu) { return cpu.id == id; });
+        if (cpu == cpus.end()) {
+          logger::warning("SYCL_NATIVE_CPU_AFFINITY: CPU {} isn't available "
+                          "to the process, ignoring it",
+                          id);
+          continue;
+        }
+        order.push_back(*cpu);
+      }
+    } else {
+      logger::warning("Ignoring unknown SYCL_NATIVE_CPU_AFFINITY value \"{}\", "
+                      "expected compact, scatter or a list of CPUs",
+                      *affinity);
+    }
+  }
+
+  thread_placement placement;
+  // Threads pinned to an explicit list default to one per listed CPU.
+  const size_t defaultNumThreads = order.empty() ? cpus.size() : order.size();
+  placement.numThreads =
+      getenv_to_unsigned("SYCL_NATIVE_CPU_HOST_THREADS")
+          .value_or(defaultNumThreads);
+  if (placement.numThreads == 0) {
+    placement.numThreads = defaultNumThreads;
+  }
+  placement.isPinned = !order.empty();
+  if (order.empty()) {
+    order = compactOrder(cpus);
+  }
+  std::set<unsigned> nodes;
+  for (size_t thread = 0; thread < placement.numThreads; thread++) {
+    placement.threadCpus.push_back(order[thread % order.size()]);
+    nodes.insert(placement.threadCpus.back().node);
+  }
+  placement.numNodes = nodes.size();
+  return placement;
+}
+
+thread_placement
+thread_placement::select(const std::vector<size_t> &threads) const {
+  thread_placement placement;
+  placement.numThreads = threads.size();
+  placement.isPinned = true;
+  std::set<unsigned> nodes;
+  for (size_t thread : threads) {
+    placement.threadCpus.push_back(threadCpus[thread]);
+    nodes.insert(threadCpus[thread].node);
+  }
+  placement.numNodes = nodes.size();
+  return placement;
+}
+
+} // namespace native_cpu
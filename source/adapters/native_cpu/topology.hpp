@@ -0,0 +1,109 @@
+//===--------- topology.hpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace native_cpu {
+
+// A CPU of the host, with the NUMA node it belongs to.
+struct cpu_t {
+  unsigned id;
+  unsigned node;
+};
+
+// How the threads of a threadpool are placed on the CPUs of the host.
+struct thread_placement {
+  size_t numThreads = 0;
+  // The CPU of each thread. When threads aren't pinned, this is the CPU they
+  // are accounted to, e.g. when partitioning the device, or empty if unknown.
+  std::vector<cpu_t> threadCpus;
+  bool isPinned = false;
+  // Number of NUMA nodes the threads run on.
+  size_t numNodes = 1;
+
+  // Returns the placement of the threads listed, pinned to their CPUs.
+  thread_placement select(const std::vector<size_t> &threads) const;
+
+  // Pins the calling thread to the CPU of thread threadId, if threads are
+  // pinned. Pinning is best effort, the thread keeps running if it fails.
+  void pin(size_t threadId) const noexcept {
+#ifdef __linux__
+    if (!isPinned) {
+      return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(threadCpus[threadId].id, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)threadId;
+#endif
+  }
+};
+
+// Returns the CPUs the process may run on, ordered by id.
+std::vector<cpu_t> getAvailableCpus();
+
+// Computes the placement of the threads of the device from the environment.
+// SYCL_NATIVE_CPU_HOST_THREADS sets the number of threads, by default one per
+// available CPU. SYCL_NATIVE_CPU_AFFINITY pins them:
+//   compact   threads fill the CPUs of a NUMA node before moving to the next
+//   scatter   threads are spread round-robin over the NUMA nodes
+//   <list>    threads are pinned in order to a list of CPUs, e.g. "0-3,8,10"
+// Threads aren't pinned when it is unset. With more threads than CPUs, the
+// CPUs are reused in the same order.
+thread_placement getThreadPlacement();
+
+// Allocates memory whose pages are placed on the NUMA node of the thread that
+// first writes to them, rather than of the allocating thread. Each thread
+// should only touch pages of its own, so sizes are best rounded up to
+// getPageSize().
+inline void *allocFirstTouch(size_t size) {
+#ifdef __linux__
+  void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  return ptr == MAP_FAILED ? nullptr : ptr;
+#else
+  return std::malloc(size);
+#endif
+}
+
+inline void freeFirstTouch(void *ptr, size_t size) {
+#ifdef __linux__
+  if (ptr) {
+    munmap(ptr, size);
+  }
+#else
+  (void)size;
+  std::free(ptr);
+#endif
+}
+
+inline size_t getPageSize() {
+#ifdef __linux__
+  long size = sysconf(_SC_PAGESIZE);
+  if (size > 0) {
+    return size;
+  }
+#endif
+  return 4096;
+}
+
+} // namespace native_cpu
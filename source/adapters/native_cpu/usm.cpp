@@ -13,12 +13,160 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "usm.hpp"
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include <umf/pools/pool_disjoint.h>
+#include <umf/pools/pool_proxy.h>
 
 namespace native_cpu {
 
+static usm::DisjointPoolAllConfigs initializeDisjointPoolConfig() {
+  const char *PoolTraceVal = std::getenv("UR_NATIVE_CPU_USM_ALLOCATOR_TRACE");
+
+  int PoolTrace = 0;
+  if (PoolTraceVal != nullptr) {
+    PoolTrace = std::atoi(PoolTraceVal);
+  }
+
+  const char *PoolConfigVal = std::getenv("UR_NATIVE_CPU_USM_ALLOCATOR");
+  if (PoolConfigVal != nullptr) {
+    return usm::parseDisjointPoolConfig(PoolConfigVal, PoolTrace);
+  }
+
+  // The defaults keep shared allocations out of the pools and use larger
+  // buckets for them and for device allocations, which only matters for
+  // GPUs. All the memory of the native CPU device is host memory, so it is
+  // all pooled like host memory.
+  usm::DisjointPoolAllConfigs Configs(PoolTrace);
+  const auto &HostConfig = Configs.Configs[usm::DisjointPoolMemType::Host];
+  for (auto &Config : Configs.Configs) {
+    Config.MaxPoolableSize = HostConfig.MaxPoolableSize;
+    Config.Capacity = HostConfig.Capacity;
+    Config.SlabMinSize = HostConfig.SlabMinSize;
+    Config.MinBucketSize = HostConfig.MinBucketSize;
+  }
+  return Configs;
+}
+
+static usm::DisjointPoolMemType getMemType(ur_usm_type_t Type,
+                                           bool DeviceReadOnly) {
+  switch (Type) {
+  case UR_USM_TYPE_DEVICE:
+    return usm::DisjointPoolMemType::Device;
+  case UR_USM_TYPE_SHARED:
+    return DeviceReadOnly ? usm::DisjointPoolMemType::SharedReadOnly
+                          : usm::DisjointPoolMemType::Shared;
+  default:
+    return usm::DisjointPoolMemType::Host;
+  }
+}
+
+static umf::pool_unique_handle_t
+makePool(umf_disjoint_pool_params_t *PoolParams) {
+  auto [Ret, Provider] = umf::memoryProviderMakeUnique<USMMemoryProvider>();
+  if (Ret != UMF_RESULT_SUCCESS) {
+    throw umf::umf2urResult(Ret);
+  }
+
+  auto [PoolRet, Pool] =
+      PoolParams ? umf::poolMakeUniqueFromOps(umfDisjointPoolOps(),
+                                              std::move(Provider), PoolParams)
+                 : umf::poolMakeUniqueFromOps(umfProxyPoolOps(),
+                                              std::move(Provider), nullptr);
+  if (PoolRet != UMF_RESULT_SUCCESS) {
+    throw umf::umf2urResult(PoolRet);
+  }
+  return std::move(Pool);
+}
+
+// Returns the size class of a block that may be kept in a thread cache, or 0.
+static size_t getCachedSize(size_t Size, size_t Alignment, size_t MinSize,
+                            size_t NumClasses, size_t MaxAlignment) {
+  const size_t MaxSize = MinSize << (NumClasses - 1);
+  if (Size > MaxSize || Alignment > MaxAlignment) {
+    return 0;
+  }
+  size_t Class = MinSize;
+  while (Class < Size) {
+    Class *= 2;
+  }
+  return Class;
+}
+
+static size_t getSizeClassIndex(size_t CachedSize, size_t MinSize) {
+  size_t Index = 0;
+  for (size_t Class = MinSize; Class < CachedSize; Class *= 2) {
+    Index++;
+  }
+  return Index;
+}
+
+umf_result_t USMMemoryProvider::alloc(size_t Size, size_t Align, void **Ptr) {
+  Align = std::max<size_t>(Align, alignof(std::max_align_t));
+  // aligned_alloc needs the size to be a multiple of the alignment, rounding
+  // it up must not wrap around to a tiny allocation.
+  if (Size > std::numeric_limits<size_t>::max() - (Align - 1)) {
+    *Ptr = nullptr;
+    return UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  Size = (Size + Align - 1) / Align * Align;
+#ifdef _MSC_VER
+  *Ptr = _aligned_malloc(Size, Align);
+#else
+  *Ptr = std::aligned_alloc(Align, Size);
+#endif
+  return *Ptr ? UMF_RESULT_SUCCESS : UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+umf_result_t USMMemoryProvider::free(void *Ptr, size_t Size) {
+  std::ignore = Size;
+#ifdef _MSC_VER
+  _aligned_free(Ptr);
+#else
+  std::free(Ptr);
+#endif
+  return UMF_RESULT_SUCCESS;
+}
+
+void usm_alloc_table::insert(const usm_alloc_info &info) {
+  std::lock_guard<ur_shared_mutex> Lock(Mutex);
+  Allocations.emplace(reinterpret_cast<uintptr_t>(info.base_ptr), info);
+}
+
+std::optional<usm_alloc_info> usm_alloc_table::find(const void *ptr) {
+  const auto Addr = reinterpret_cast<uintptr_t>(ptr);
+  std::shared_lock<ur_shared_mutex> Lock(Mutex);
+  // The allocation holding ptr is the last one starting at or before it.
+  auto It = Allocations.upper_bound(Addr);
+  if (It == Allocations.begin()) {
+    return std::nullopt;
+  }
+  --It;
+  if (Addr - It->first >= It->second.size) {
+    return std::nullopt;
+  }
+  return It->second;
+}
+
+std::optional<usm_alloc_info> usm_alloc_table::erase(const void *ptr) {
+  std::lock_guard<ur_shared_mutex> Lock(Mutex);
+  auto It = Allocations.find(reinterpret_cast<uintptr_t>(ptr));
+  if (It == Allocations.end()) {
+    return std::nullopt;
+  }
+  usm_alloc_info Info = It->second;
+  Allocations.erase(It);
+  return Info;
+}
+
 static ur_result_t alloc_helper(ur_context_handle_t hContext,
-                                const ur_usm_desc_t *pUSMDesc, size_t size,
+                                ur_device_handle_t hDevice,
+                                const ur_usm_desc_t *pUSMDesc,
+                                ur_usm_pool_handle_t pool, size_t size,
                                 void **ppMem, ur_usm_type_t type) {
   auto alignment = pUSMDesc ? pUSMDesc->align : 1u;
   UR_ASSERT((alignment & (alignment - 1)) == 0, UR_RESULT_ERROR_INVALID_VALUE);
@@ -26,44 +174,189 @@ static ur_result_t alloc_helper(ur_context_handle_t hContext,
   // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
   UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
 
-  auto *ptr = hContext->add_alloc(alignment, type, size, nullptr);
-  UR_ASSERT(ptr != nullptr, UR_RESULT_ERROR_OUT_OF_RESOURCES);
-  *ppMem = ptr;
+  ur_usm_pool_handle_t owner = pool ? pool : hContext->getDefaultUSMPool();
+  return owner->allocate(hDevice, pUSMDesc, type, size, ppMem, pool);
+}
+
+} // namespace native_cpu
+
+ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
+                                             const ur_usm_pool_desc_t *PoolDesc)
+    : Context(Context),
+      DisjointPoolConfigs(native_cpu::initializeDisjointPoolConfig()) {
+  if (PoolDesc) {
+    ZeroInitialize = PoolDesc->flags & UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK;
+    if (auto Limits = find_stype_node<ur_usm_pool_limits_desc_t>(PoolDesc)) {
+      for (auto &Config : DisjointPoolConfigs.Configs) {
+        Config.MaxPoolableSize = Limits->maxPoolableSize;
+        Config.SlabMinSize = Limits->minDriverAllocSize;
+      }
+    }
+  }
+
+  // The memory is the same for a device and its sub-devices, the pools are
+  // those of the root device.
+  std::vector<usm::pool_descriptor> Descriptors;
+  Descriptors.push_back({this, Context, nullptr, UR_USM_TYPE_HOST, false});
+  Descriptors.push_back(
+      {this, Context, Context->_device, UR_USM_TYPE_DEVICE, false});
+  Descriptors.push_back(
+      {this, Context, Context->_device, UR_USM_TYPE_SHARED, false});
+  Descriptors.push_back(
+      {this, Context, Context->_device, UR_USM_TYPE_SHARED, true});
+  for (auto &Desc : Descriptors) {
+    auto &PoolConfig =
+        DisjointPoolConfigs
+            .Configs[native_cpu::getMemType(Desc.type, Desc.deviceReadOnly)];
+    auto Result = PoolManager.addPool(
+        Desc, native_cpu::makePool(
+                  DisjointPoolConfigs.EnableBuffers ? &PoolConfig : nullptr));
+    if (Result != UR_RESULT_SUCCESS) {
+      throw Result;
+    }
+  }
+}
+
+ur_usm_pool_handle_t_::~ur_usm_pool_handle_t_() {
+  // The cached blocks go back to the UMF pools before these are destroyed.
+  for (auto &Cache : ThreadCaches) {
+    for (auto &Classes : Cache.Blocks) {
+      for (auto &Blocks : Classes) {
+        for (void *Block : Blocks) {
+          umfFree(Block);
+        }
+      }
+    }
+  }
+}
+
+ur_usm_pool_handle_t_::thread_cache &ur_usm_pool_handle_t_::getThreadCache() {
+  static std::atomic<size_t> NextThreadIndex{0};
+  static thread_local const size_t ThreadIndex = NextThreadIndex++;
+  return ThreadCaches[ThreadIndex % NumThreadCaches];
+}
+
+umf_memory_pool_handle_t
+ur_usm_pool_handle_t_::getPool(const usm::pool_descriptor &Desc) {
+  auto Pool = PoolManager.getPool(Desc);
+  return Pool ? *Pool : nullptr;
+}
 
+ur_result_t ur_usm_pool_handle_t_::allocate(ur_device_handle_t Device,
+                                            const ur_usm_desc_t *USMDesc,
+                                            ur_usm_type_t Type, size_t Size,
+                                            void **Ptr,
+                                            ur_usm_pool_handle_t UserPool) {
+  const size_t Alignment = USMDesc ? USMDesc->align : 0;
+  bool DeviceReadOnly = false;
+  if (auto DeviceDesc = find_stype_node<ur_usm_device_desc_t>(USMDesc)) {
+    DeviceReadOnly =
+        DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY;
+  }
+
+  native_cpu::usm_alloc_info Info{};
+  Info.type = Type;
+  Info.size = Size;
+  Info.device = Device ? Device : Context->_device;
+  Info.pool = UserPool;
+  Info.owner = this;
+  Info.memType = native_cpu::getMemType(Type, DeviceReadOnly);
+  Info.cachedSize =
+      native_cpu::getCachedSize(Size, Alignment, MinCachedSize, NumSizeClasses,
+                                MaxCachedAlignment);
+  ur_device_handle_t PoolDevice = nullptr;
+  if (Type != UR_USM_TYPE_HOST) {
+    PoolDevice = Info.device;
+    while (PoolDevice->isSubDevice()) {
+      PoolDevice = PoolDevice->Parent;
+    }
+  }
+  Info.umfPool = getPool({this, Context, PoolDevice, Type, DeviceReadOnly});
+  UR_ASSERT(Info.umfPool, UR_RESULT_ERROR_INVALID_ARGUMENT);
+
+  void *Mem = nullptr;
+  if (Info.cachedSize) {
+    auto &Cache = getThreadCache();
+    std::lock_guard<std::mutex> Lock(Cache.Mutex);
+    auto &Blocks = Cache.Blocks[Info.memType][native_cpu::getSizeClassIndex(
+        Info.cachedSize, MinCachedSize)];
+    if (!Blocks.empty()) {
+      Mem = Blocks.back();
+      Blocks.pop_back();
+    }
+  }
+  if (!Mem) {
+    Mem = Info.cachedSize ? umfPoolMalloc(Info.umfPool, Info.cachedSize)
+                          : umfPoolAlignedMalloc(Info.umfPool, Size, Alignment);
+    if (!Mem) {
+      return umf::umf2urResult(umfPoolGetLastAllocationError(Info.umfPool));
+    }
+  }
+  if (ZeroInitialize) {
+    std::memset(Mem, 0, Size);
+  }
+
+  Info.base_ptr = Mem;
+  NumLifetimeRefs.fetch_add(1, std::memory_order_relaxed);
+  Context->Allocations.insert(Info);
+  *Ptr = Mem;
   return UR_RESULT_SUCCESS;
 }
 
-} // namespace native_cpu
+ur_result_t ur_usm_pool_handle_t_::free(void *Ptr,
+                                        const native_cpu::usm_alloc_info &Info) {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  bool Cached = false;
+  if (Info.cachedSize) {
+    auto &Cache = getThreadCache();
+    std::lock_guard<std::mutex> Lock(Cache.Mutex);
+    auto &Blocks = Cache.Blocks[Info.memType][native_cpu::getSizeClassIndex(
+        Info.cachedSize, MinCachedSize)];
+    if (Blocks.size() < MaxCachedBlocks) {
+      Blocks.push_back(Ptr);
+      Cached = true;
+    }
+  }
+  if (!Cached) {
+    Result = umf::umf2urResult(umfPoolFree(Info.umfPool, Ptr));
+  }
+  releaseLifetimeRef();
+  return Result;
+}
+
+void ur_usm_pool_handle_t_::release() {
+  if (decrementReferenceCount() == 0) {
+    releaseLifetimeRef();
+  }
+}
+
+void ur_usm_pool_handle_t_::releaseLifetimeRef() {
+  if (NumLifetimeRefs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
                ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
-  std::ignore = pool;
-
-  return native_cpu::alloc_helper(hContext, pUSMDesc, size, ppMem,
-                                  UR_USM_TYPE_HOST);
+  return native_cpu::alloc_helper(hContext, nullptr, pUSMDesc, pool, size,
+                                  ppMem, UR_USM_TYPE_HOST);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hDevice;
-  std::ignore = pool;
-
-  return native_cpu::alloc_helper(hContext, pUSMDesc, size, ppMem,
-                                  UR_USM_TYPE_DEVICE);
+  return native_cpu::alloc_helper(hContext, hDevice, pUSMDesc, pool, size,
+                                  ppMem, UR_USM_TYPE_DEVICE);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hDevice;
-  std::ignore = pool;
-
-  return native_cpu::alloc_helper(hContext, pUSMDesc, size, ppMem,
-                                  UR_USM_TYPE_SHARED);
+  return native_cpu::alloc_helper(hContext, hDevice, pUSMDesc, pool, size,
+                                  ppMem, UR_USM_TYPE_SHARED);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
@@ -72,9 +365,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
   UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  auto res = hContext->remove_alloc(pMem);
+  auto Info = hContext->Allocations.erase(pMem);
+  UR_ASSERT(Info, UR_RESULT_ERROR_INVALID_MEM_OBJECT);
 
-  return res;
+  return Info->owner->free(pMem, *Info);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
@@ -84,22 +378,27 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
 
   UR_ASSERT(pMem != nullptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
-  if (propName == UR_USM_ALLOC_INFO_BASE_PTR) {
-    // TODO: logic to compute base ptr given ptr
-    DIE_NO_IMPLEMENTATION;
+
+  const auto alloc_info = hContext->Allocations.find(pMem);
+  if (!alloc_info) {
+    // Memory that isn't USM is reported as such, it has no other properties.
+    if (propName == UR_USM_ALLOC_INFO_TYPE) {
+      return ReturnValue(UR_USM_TYPE_UNKNOWN);
+    }
+    return UR_RESULT_ERROR_INVALID_VALUE;
   }
 
-  const native_cpu::usm_alloc_info &alloc_info =
-      hContext->get_alloc_info_entry(pMem);
   switch (propName) {
   case UR_USM_ALLOC_INFO_TYPE:
-    return ReturnValue(alloc_info.type);
+    return ReturnValue(alloc_info->type);
+  case UR_USM_ALLOC_INFO_BASE_PTR:
+    return ReturnValue(const_cast<void *>(alloc_info->base_ptr));
   case UR_USM_ALLOC_INFO_SIZE:
-    return ReturnValue(alloc_info.size);
+    return ReturnValue(alloc_info->size);
   case UR_USM_ALLOC_INFO_DEVICE:
-    return ReturnValue(alloc_info.device);
+    return ReturnValue(alloc_info->device);
   case UR_USM_ALLOC_INFO_POOL:
-    return ReturnValue(alloc_info.pool);
+    return ReturnValue(alloc_info->pool);
   default:
     DIE_NO_IMPLEMENTATION;
   }
@@ -109,37 +408,44 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolCreate(ur_context_handle_t hContext, ur_usm_pool_desc_t *pPoolDesc,
                 ur_usm_pool_handle_t *ppPool) {
-  std::ignore = hContext;
-  std::ignore = pPoolDesc;
-  std::ignore = ppPool;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pPoolDesc && ppPool, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  try {
+    *ppPool = new ur_usm_pool_handle_t_(hContext, pPoolDesc);
+  } catch (ur_result_t Result) {
+    return Result;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolRetain(ur_usm_pool_handle_t pPool) {
-  std::ignore = pPool;
-
-  DIE_NO_IMPLEMENTATION;
+  pPool->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolRelease(ur_usm_pool_handle_t pPool) {
-  std::ignore = pPool;
-
-  DIE_NO_IMPLEMENTATION;
+  pPool->release();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolGetInfo(ur_usm_pool_handle_t hPool, ur_usm_pool_info_t propName,
                  size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hPool;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  switch (propName) {
+  case UR_USM_POOL_INFO_REFERENCE_COUNT:
+    return ReturnValue(hPool->getReferenceCount());
+  case UR_USM_POOL_INFO_CONTEXT:
+    return ReturnValue(hPool->Context);
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMImportExp(ur_context_handle_t Context,
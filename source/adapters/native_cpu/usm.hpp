@@ -0,0 +1,147 @@
+//===--------- usm.hpp - Native CPU Adapter -------------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <umf_helpers.hpp>
+#include <umf_pools/disjoint_pool_config_parser.hpp>
+#include <ur_pool_manager.hpp>
+
+#include "common.hpp"
+
+namespace native_cpu {
+
+// Describes a USM allocation, to answer urUSMGetMemAllocInfo and to return
+// the memory to the pool it came from.
+struct usm_alloc_info {
+  ur_usm_type_t type;
+  const void *base_ptr;
+  size_t size;
+  ur_device_handle_t device;
+  // The pool passed to the allocation, null for the default pool.
+  ur_usm_pool_handle_t pool;
+  // The pools that allocated the memory.
+  ur_usm_pool_handle_t owner;
+  umf_memory_pool_handle_t umfPool;
+  usm::DisjointPoolMemType memType;
+  // Size class of the block if it can be kept in a thread cache, otherwise 0.
+  size_t cachedSize;
+};
+
+// The USM allocations of a context ordered by address, so that the allocation
+// holding any pointer can be found.
+class usm_alloc_table {
+public:
+  void insert(const usm_alloc_info &info);
+
+  // Returns the allocation ptr points into.
+  std::optional<usm_alloc_info> find(const void *ptr);
+
+  // Removes the allocation starting at ptr.
+  std::optional<usm_alloc_info> erase(const void *ptr);
+
+private:
+  ur_shared_mutex Mutex;
+  std::map<uintptr_t, usm_alloc_info> Allocations;
+};
+
+// Provides the memory of the UMF pools from the system allocator, all USM
+// memory of the native CPU device is host memory.
+class USMMemoryProvider {
+public:
+  umf_result_t initialize() { return UMF_RESULT_SUCCESS; }
+  umf_result_t alloc(size_t Size, size_t Align, void **Ptr);
+  umf_result_t free(void *Ptr, size_t Size);
+  void get_last_native_error(const char **ErrMsg, int32_t *ErrCode) {
+    std::ignore = ErrMsg;
+    *ErrCode = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  umf_result_t get_min_page_size(void *, size_t *PageSize) {
+    *PageSize = 0;
+    return UMF_RESULT_SUCCESS;
+  }
+  umf_result_t get_recommended_page_size(size_t, size_t *) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t purge_lazy(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t purge_force(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t allocation_merge(void *, void *, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  umf_result_t allocation_split(void *, size_t, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  const char *get_name() { return "NativeCPUMemoryProvider"; }
+};
+
+} // namespace native_cpu
+
+struct ur_usm_pool_handle_t_ : RefCounted {
+  // Throws a ur_result_t if the pool can't be created.
+  ur_usm_pool_handle_t_(ur_context_handle_t Context,
+                        const ur_usm_pool_desc_t *PoolDesc);
+  ~ur_usm_pool_handle_t_();
+
+  // Allocates from the pool and records the allocation in the context.
+  ur_result_t allocate(ur_device_handle_t Device, const ur_usm_desc_t *USMDesc,
+                       ur_usm_type_t Type, size_t Size, void **Ptr,
+                       ur_usm_pool_handle_t UserPool);
+
+  // Returns an allocation to the pool, it has been removed from the context.
+  // This may destroy the pool, if it was released before.
+  ur_result_t free(void *Ptr, const native_cpu::usm_alloc_info &Info);
+
+  // Drops a reference to the pool. The pool is destroyed once the last
+  // reference has been dropped and the last of its allocations freed.
+  void release();
+
+  const ur_context_handle_t Context;
+
+private:
+  // Small blocks are kept by the thread freeing them for the next allocations
+  // of their size class, instead of going back to the UMF pool. Threads are
+  // spread over the caches, so that they rarely share one.
+  static constexpr size_t NumThreadCaches = 16;
+  static constexpr size_t MinCachedSize = 64;
+  static constexpr size_t NumSizeClasses = 7; // 64 bytes to 4 KiB
+  static constexpr size_t MaxCachedBlocks = 16;
+  static constexpr size_t MaxCachedAlignment = 16;
+
+  struct thread_cache {
+    std::mutex Mutex;
+    std::array<std::array<std::vector<void *>, NumSizeClasses>,
+               usm::DisjointPoolMemType::All>
+        Blocks;
+  };
+
+  thread_cache &getThreadCache();
+  umf_memory_pool_handle_t getPool(const usm::pool_descriptor &Desc);
+  void releaseLifetimeRef();
+
+  // One for each live allocation, and one held until the pool is released.
+  std::atomic<size_t> NumLifetimeRefs{1};
+
+  usm::DisjointPoolAllConfigs DisjointPoolConfigs;
+  bool ZeroInitialize = false;
+  usm::pool_manager<usm::pool_descriptor> PoolManager;
+  std::array<thread_cache, NumThreadCaches> ThreadCaches;
+};
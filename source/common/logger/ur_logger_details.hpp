@@ -30,6 +30,12 @@ class Logger {
 
     void setLevel(logger::Level level) { this->level = level; }
 
+    // Whether messages at level are written, so that callers can skip
+    // preparing them otherwise.
+    bool isLevelEnabled(logger::Level level) const {
+        return sink && (isLegacySink || level >= this->level);
+    }
+
     void setFlushLevel(logger::Level level) {
         if (sink) {
             this->sink->setFlushLevel(level);
@@ -11,23 +11,73 @@
 #ifndef UR_SINGLETON_H
 #define UR_SINGLETON_H 1
 
+#include <array>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// the instances are spread over shards by the hash of their key, each shard
+/// with its own lock, so that threads creating instances of different keys
+/// rarely contend. the storage of the instances and the nodes of the maps are
+/// recycled on release, so a shard stops allocating once it has grown to the
+/// number of instances alive at once
 template <typename singleton_tn, typename key_tn> class singleton_factory_t {
   protected:
     using singleton_t = singleton_tn;
     using key_t = typename std::conditional<std::is_pointer<key_tn>::value,
                                             size_t, key_tn>::type;
 
-    using ptr_t = std::unique_ptr<singleton_t>;
-    using map_t = std::unordered_map<key_t, ptr_t>;
+    /// number of shards, a power of two
+    static constexpr size_t shardBits = 5;
+    static constexpr size_t numShards = size_t(1) << shardBits;
+    /// number of instances a shard allocates storage for at once
+    static constexpr size_t chunkSize = 32;
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    /// uninitialized storage for an instance
+    struct alignas(singleton_t) storage_t {
+        unsigned char bytes[sizeof(singleton_t)];
+    };
+
+    /// the map of a shard, mapping keys to the storage of their instance
+    using map_t = std::unordered_map<key_t, storage_t *>;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// the instances of the keys hashed to a shard, on their own cache line
+    struct alignas(64) shard_t {
+        std::mutex mut; ///< lock for thread-safety
+        map_t map;      ///< single instance of singleton for each unique key
+        /// map nodes released along with their storage, ready for reuse
+        std::vector<typename map_t::node_type> freeNodes;
+        /// storage never used yet, taken from the end of the last chunk
+        std::vector<std::unique_ptr<storage_t[]>> chunks;
+        size_t chunkUsed = chunkSize;
+
+        storage_t *allocate() {
+            if (chunkUsed == chunkSize) {
+                chunks.emplace_back(new storage_t[chunkSize]);
+                chunkUsed = 0;
+            }
+            return &chunks.back()[chunkUsed++];
+        }
+
+        void destroyAll() {
+            for (auto &entry : map) {
+                get(entry.second)->~singleton_t();
+            }
+        }
+
+        ~shard_t() { destroyAll(); }
+    };
+
+    std::array<shard_t, numShards> shards;
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -36,6 +86,19 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
         return reinterpret_cast<key_t>(key);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// the shard of key, handles being aligned the low bits of the hash are
+    /// mixed into the high ones, which select the shard
+    shard_t &getShard(const key_t &key) {
+        size_t hash = std::hash<key_t>{}(key);
+        hash *= static_cast<size_t>(0x9E3779B97F4A7C15ull);
+        return shards[hash >> (sizeof(size_t) * 8 - shardBits)];
+    }
+
+    static singleton_t *get(storage_t *storage) {
+        return std::launder(reinterpret_cast<singleton_t *>(storage));
+    }
+
   public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -54,27 +117,63 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
             return static_cast<singleton_tn *>(0);
         }
 
-        std::lock_guard<std::mutex> lk(mut);
-        auto iter = map.find(key);
+        auto &shard = getShard(key);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(key);
+        if (shard.map.end() != iter) {
+            return get(iter->second);
+        }
 
-        if (map.end() == iter) {
-            auto ptr =
-                std::make_unique<singleton_t>(std::forward<Ts>(params)...);
-            iter = map.emplace(key, std::move(ptr)).first;
+        if (shard.freeNodes.empty()) {
+            auto *storage = shard.allocate();
+            auto *instance =
+                new (storage) singleton_t(std::forward<Ts>(params)...);
+            try {
+                shard.map.emplace(key, storage);
+            } catch (...) {
+                instance->~singleton_t();
+                throw;
+            }
+            return instance;
         }
-        return iter->second.get();
+
+        auto node = std::move(shard.freeNodes.back());
+        shard.freeNodes.pop_back();
+        auto *instance =
+            new (node.mapped()) singleton_t(std::forward<Ts>(params)...);
+        node.key() = key;
+        try {
+            shard.map.insert(std::move(node));
+        } catch (...) {
+            instance->~singleton_t();
+            throw;
+        }
+        return instance;
     }
 
     //////////////////////////////////////////////////////////////////////////
     /// once the key is no longer valid, release the singleton
     void release(key_tn key) {
-        std::lock_guard<std::mutex> lk(mut);
-        map.erase(getKey(key));
+        auto k = getKey(key);
+        auto &shard = getShard(k);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(k);
+        if (shard.map.end() == iter) {
+            return;
+        }
+        get(iter->second)->~singleton_t();
+        shard.freeNodes.push_back(shard.map.extract(iter));
     }
 
     void clear() {
-        std::lock_guard<std::mutex> lk(mut);
-        map.clear();
+        for (auto &shard : shards) {
+            std::lock_guard<std::mutex> lk(shard.mut);
+            shard.destroyAll();
+            while (!shard.map.empty()) {
+                shard.freeNodes.push_back(
+                    shard.map.extract(shard.map.begin()));
+            }
+        }
     }
 };
 
@@ -0,0 +1,370 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_allocation_index.cpp
+ *
+ */
+
+#include "asan_allocation_index.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+
+namespace ur_sanitizer_layer {
+
+namespace {
+
+///
+/// Epoch-based reclamation
+///
+/// Each reading thread publishes the global epoch it started reading in. The
+/// writers only advance the global epoch once every active reader is in the
+/// current one, so an object retired in epoch E can't be seen by any reader
+/// once the global epoch reaches E + 2.
+///
+
+struct ThreadRecord {
+    // (Epoch << 1) | 1 while reading, 0 otherwise
+    std::atomic<uint64_t> State{0};
+    std::atomic<bool> InUse{true};
+    ThreadRecord *Next = nullptr;
+};
+
+std::atomic<uint64_t> GlobalEpoch{1};
+std::atomic<ThreadRecord *> ThreadRecords{nullptr};
+
+ThreadRecord *AcquireThreadRecord() {
+    // Reuse the record of a thread which exited
+    for (auto *R = ThreadRecords.load(std::memory_order_acquire); R;
+         R = R->Next) {
+        bool InUse = false;
+        if (!R->InUse.load(std::memory_order_relaxed) &&
+            R->InUse.compare_exchange_strong(InUse, true)) {
+            return R;
+        }
+    }
+    // Records are never freed, the writers walk the list without a lock
+    auto *R = new ThreadRecord();
+    R->Next = ThreadRecords.load(std::memory_order_relaxed);
+    while (!ThreadRecords.compare_exchange_weak(R->Next, R,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+    }
+    return R;
+}
+
+struct ThreadState {
+    ThreadRecord *Record = nullptr;
+    unsigned Depth = 0;
+
+    ~ThreadState() {
+        if (Record) {
+            Record->State.store(0, std::memory_order_release);
+            Record->InUse.store(false, std::memory_order_release);
+            Record = nullptr;
+        }
+    }
+};
+
+thread_local ThreadState CurrentThread;
+
+void TryAdvanceEpoch() {
+    uint64_t Epoch = GlobalEpoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (auto *R = ThreadRecords.load(std::memory_order_acquire); R;
+         R = R->Next) {
+        uint64_t State = R->State.load(std::memory_order_acquire);
+        if ((State & 1) && (State >> 1) != Epoch) {
+            return;
+        }
+    }
+    GlobalEpoch.compare_exchange_strong(Epoch, Epoch + 1);
+}
+
+} // namespace
+
+AllocationIndex::ReadGuard::ReadGuard() {
+    auto &T = CurrentThread;
+    if (T.Depth++ == 0) {
+        if (!T.Record) {
+            T.Record = AcquireThreadRecord();
+        }
+        T.Record->State.store(
+            (GlobalEpoch.load(std::memory_order_relaxed) << 1) | 1,
+            std::memory_order_relaxed);
+        // The announcement must be visible before the index is read
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+AllocationIndex::ReadGuard::~ReadGuard() {
+    auto &T = CurrentThread;
+    if (--T.Depth == 0) {
+        T.Record->State.store(0, std::memory_order_release);
+    }
+}
+
+AllocationIndex::AllocationIndex() : m_Root(new Node()) {}
+
+AllocationIndex::~AllocationIndex() {
+    clear();
+    delete m_Root;
+}
+
+void AllocationIndex::clear() {
+    std::scoped_lock<ur_mutex> Guard(m_WriteMutex);
+
+    std::unordered_set<Bucket *> Buckets;
+    std::vector<Node *> Stack{m_Root};
+    while (!Stack.empty()) {
+        auto *N = Stack.back();
+        Stack.pop_back();
+        for (auto &Slot : N->Slots) {
+            auto *Value = Slot.exchange(nullptr, std::memory_order_relaxed);
+            if (isBucket(Value)) {
+                Buckets.insert(asBucket(Value));
+            } else if (Value) {
+                Stack.push_back(static_cast<Node *>(Value));
+            }
+        }
+        if (N != m_Root) {
+            delete N;
+        }
+    }
+    m_Root->Used = 0;
+
+    for (auto *B : Buckets) {
+        delete B;
+    }
+    for (auto &[Epoch, Value] : m_Retired) {
+        release(Value);
+    }
+    m_Retired.clear();
+}
+
+AllocationIndex::PageRange
+AllocationIndex::getPageRange(const std::shared_ptr<AllocInfo> &AI) {
+    uptr Begin = AI->AllocBegin;
+    uptr End = Begin + std::max<size_t>(AI->AllocSize, 1);
+    uptr PageSize = uptr(1) << kPageShift;
+    uptr CoveredBegin = RoundUpTo(Begin, PageSize) >> kPageShift;
+    uptr CoveredEnd = RoundDownTo(End, PageSize) >> kPageShift;
+    return PageRange{AI,
+                     Begin >> kPageShift,
+                     ((End - 1) >> kPageShift) + 1,
+                     CoveredBegin,
+                     std::max(CoveredBegin, CoveredEnd)};
+}
+
+AllocationIndex::Node &AllocationIndex::getOrSplitChild(Node &N,
+                                                        size_t Index) {
+    auto *Value = N.Slots[Index].load(std::memory_order_relaxed);
+    if (Value && !isBucket(Value)) {
+        return *static_cast<Node *>(Value);
+    }
+
+    // A bucket covering the pages of the slot is pushed down to all the
+    // slots of the new node
+    auto *Child = new Node();
+    if (Value) {
+        for (auto &Slot : Child->Slots) {
+            Slot.store(Value, std::memory_order_relaxed);
+        }
+        Child->Used = kFanout;
+        asBucket(Value)->Refs += kFanout - 1;
+    }
+    setSlot(N, Index, Child);
+    return *Child;
+}
+
+void AllocationIndex::setSlot(Node &N, size_t Index, void *Value) {
+    auto &Slot = N.Slots[Index];
+    bool WasUsed = Slot.load(std::memory_order_relaxed) != nullptr;
+    if (!WasUsed && Value) {
+        N.Used++;
+    } else if (WasUsed && !Value) {
+        N.Used--;
+    }
+    Slot.store(Value, std::memory_order_release);
+}
+
+void AllocationIndex::replaceBucket(Node &N, size_t Index, Bucket *Old,
+                                    Bucket *New) {
+    if (New) {
+        New->Refs++;
+    }
+    setSlot(N, Index, New ? tagBucket(New) : nullptr);
+    if (Old && --Old->Refs == 0) {
+        retire(tagBucket(Old));
+    }
+}
+
+void AllocationIndex::retire(void *Slot) {
+    // The slot is unlinked before the epoch is read
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    m_Retired.emplace_back(GlobalEpoch.load(std::memory_order_relaxed), Slot);
+}
+
+void AllocationIndex::release(void *Slot) {
+    if (isBucket(Slot)) {
+        delete asBucket(Slot);
+    } else {
+        delete static_cast<Node *>(Slot);
+    }
+}
+
+void AllocationIndex::reclaim() {
+    if (m_Retired.empty()) {
+        return;
+    }
+    TryAdvanceEpoch();
+    uint64_t Epoch = GlobalEpoch.load(std::memory_order_acquire);
+    auto It = std::partition(m_Retired.begin(), m_Retired.end(),
+                             [&](const std::pair<uint64_t, void *> &R) {
+                                 return R.first + 2 > Epoch;
+                             });
+    for (auto Reclaimed = It; Reclaimed != m_Retired.end(); ++Reclaimed) {
+        release(Reclaimed->second);
+    }
+    m_Retired.erase(It, m_Retired.end());
+}
+
+void AllocationIndex::insertRange(Node &N, unsigned Level, uptr Base,
+                                  PageRange &R) {
+    uptr Span = pagesPerSlot(Level);
+    size_t First = (std::max(R.Begin, Base) - Base) / Span;
+    size_t Last = (std::min(R.End, Base + kFanout * Span) - 1 - Base) / Span;
+
+    for (size_t Index = First; Index <= Last; Index++) {
+        uptr SlotBegin = Base + Index * Span;
+        auto *Value = N.Slots[Index].load(std::memory_order_relaxed);
+
+        if (!Value && SlotBegin >= R.CoveredBegin &&
+            SlotBegin + Span <= R.CoveredEnd) {
+            if (!R.Covering) {
+                R.Covering = new Bucket();
+                R.Covering->Entries.push_back(R.AI);
+            }
+            replaceBucket(N, Index, nullptr, R.Covering);
+            continue;
+        }
+
+        if (Level + 1 < kLevels) {
+            insertRange(getOrSplitChild(N, Index), Level + 1, SlotBegin, R);
+            continue;
+        }
+
+        auto *Old = asBucket(Value);
+        auto *New = new Bucket();
+        if (Old) {
+            New->Entries = Old->Entries;
+        }
+        New->Entries.insert(
+            std::upper_bound(New->Entries.begin(), New->Entries.end(), R.AI,
+                             [](const std::shared_ptr<AllocInfo> &Lhs,
+                                const std::shared_ptr<AllocInfo> &Rhs) {
+                                 return Lhs->AllocBegin < Rhs->AllocBegin;
+                             }),
+            R.AI);
+        replaceBucket(N, Index, Old, New);
+    }
+}
+
+void AllocationIndex::eraseRange(Node &N, unsigned Level, uptr Base,
+                                 PageRange &R) {
+    uptr Span = pagesPerSlot(Level);
+    size_t First = (std::max(R.Begin, Base) - Base) / Span;
+    size_t Last = (std::min(R.End, Base + kFanout * Span) - 1 - Base) / Span;
+
+    for (size_t Index = First; Index <= Last; Index++) {
+        uptr SlotBegin = Base + Index * Span;
+        auto *Value = N.Slots[Index].load(std::memory_order_relaxed);
+        if (!Value) {
+            continue;
+        }
+
+        if (isBucket(Value)) {
+            auto *Old = asBucket(Value);
+            if (std::find(Old->Entries.begin(), Old->Entries.end(), R.AI) ==
+                Old->Entries.end()) {
+                continue;
+            }
+            if (SlotBegin >= R.Begin && SlotBegin + Span <= R.End) {
+                Bucket *New = nullptr;
+                if (Old->Entries.size() != 1) {
+                    New = new Bucket();
+                    for (auto &Entry : Old->Entries) {
+                        if (Entry != R.AI) {
+                            New->Entries.push_back(Entry);
+                        }
+                    }
+                }
+                replaceBucket(N, Index, Old, New);
+                continue;
+            }
+            // The bucket also covers pages outside of the allocation, it's
+            // pushed down to the pages of the child
+        }
+
+        auto &Child = getOrSplitChild(N, Index);
+        eraseRange(Child, Level + 1, SlotBegin, R);
+        if (Child.Used == 0) {
+            setSlot(N, Index, nullptr);
+            retire(&Child);
+        }
+    }
+}
+
+void AllocationIndex::insert(const std::shared_ptr<AllocInfo> &AI) {
+    std::scoped_lock<ur_mutex> Guard(m_WriteMutex);
+
+    auto Range = getPageRange(AI);
+    insertRange(*m_Root, 0, 0, Range);
+
+    reclaim();
+}
+
+void AllocationIndex::erase(const std::shared_ptr<AllocInfo> &AI) {
+    std::scoped_lock<ur_mutex> Guard(m_WriteMutex);
+
+    auto Range = getPageRange(AI);
+    eraseRange(*m_Root, 0, 0, Range);
+
+    reclaim();
+}
+
+const std::shared_ptr<AllocInfo> *AllocationIndex::find(uptr Address) const {
+    uptr Page = Address >> kPageShift;
+    void *Value = m_Root;
+    for (unsigned Level = 0; Level < kLevels && Value && !isBucket(Value);
+         Level++) {
+        Value = static_cast<Node *>(Value)
+                    ->Slots[slotIndex(Page, Level)]
+                    .load(std::memory_order_acquire);
+    }
+    if (!Value) {
+        return nullptr;
+    }
+    auto *B = asBucket(Value);
+
+    auto It = std::upper_bound(B->Entries.begin(), B->Entries.end(), Address,
+                               [](uptr Address, const auto &AI) {
+                                   return Address < AI->AllocBegin;
+                               });
+    if (It == B->Entries.begin()) {
+        return nullptr;
+    }
+    --It;
+    if (Address >= (*It)->AllocBegin + std::max<size_t>((*It)->AllocSize, 1)) {
+        return nullptr;
+    }
+    return &*It;
+}
+
+} // namespace ur_sanitizer_layer
@@ -0,0 +1,131 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_allocation_index.hpp
+ *
+ */
+
+#pragma once
+
+#include "asan_allocator.hpp"
+#include "common.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+/// Finds the allocation containing an address without taking a lock.
+///
+/// The index is a radix tree over the page numbers whose slots point either
+/// to a child node or to an immutable bucket of the allocations overlapping
+/// the pages of the slot, sorted by address. A slot whose pages are entirely
+/// covered by an allocation holds a bucket shared by all such slots, as high
+/// in the tree as the pages allow, so that a large allocation only takes a
+/// few slots. Writers are serialized; they replace the buckets and retire the
+/// old ones, and the nodes left empty, which are released with epoch-based
+/// reclamation once no reader can still see them. Readers only announce the
+/// epoch they run in.
+class AllocationIndex {
+  public:
+    /// Marks the current thread as reading the index: the buckets, and so the
+    /// AllocInfo, found until the guard is destroyed stay alive. Guards may
+    /// be nested.
+    class ReadGuard {
+      public:
+        ReadGuard();
+        ~ReadGuard();
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+    };
+
+    AllocationIndex();
+    ~AllocationIndex();
+    AllocationIndex(const AllocationIndex &) = delete;
+    AllocationIndex &operator=(const AllocationIndex &) = delete;
+
+    void insert(const std::shared_ptr<AllocInfo> &AI);
+    void erase(const std::shared_ptr<AllocInfo> &AI);
+
+    /// Releases everything, there must be no reader left
+    void clear();
+
+    /// Finds the allocation containing Address, or returns nullptr. The
+    /// result may only be used while a ReadGuard is held, copy it to keep it.
+    const std::shared_ptr<AllocInfo> *find(uptr Address) const;
+
+  private:
+    static constexpr unsigned kPageShift = 12;
+    static constexpr unsigned kLevelBits = 13;
+    static constexpr unsigned kLevels = 4;
+    static constexpr size_t kFanout = size_t(1) << kLevelBits;
+
+    struct Bucket {
+        // Number of slots pointing at the bucket, only used by the writers
+        size_t Refs = 0;
+        std::vector<std::shared_ptr<AllocInfo>> Entries;
+    };
+
+    // The slots of the last level only hold buckets, the others nodes or
+    // buckets, which are told apart by the lowest bit of the pointer
+    struct Node {
+        // Number of non-null slots, only used by the writers
+        size_t Used = 0;
+        std::atomic<void *> Slots[kFanout];
+    };
+
+    // The pages touched by a write, as half-open ranges of page numbers
+    struct PageRange {
+        const std::shared_ptr<AllocInfo> &AI;
+        uptr Begin;
+        uptr End;
+        // The pages entirely covered by the allocation
+        uptr CoveredBegin;
+        uptr CoveredEnd;
+        // Shared by the covered slots which hold no other allocation
+        Bucket *Covering = nullptr;
+    };
+
+    static bool isBucket(void *Slot) {
+        return reinterpret_cast<uptr>(Slot) & 1;
+    }
+    static Bucket *asBucket(void *Slot) {
+        return reinterpret_cast<Bucket *>(reinterpret_cast<uptr>(Slot) &
+                                          ~uptr(1));
+    }
+    static void *tagBucket(Bucket *B) {
+        return reinterpret_cast<void *>(reinterpret_cast<uptr>(B) | 1);
+    }
+
+    static uptr pagesPerSlot(unsigned Level) {
+        return uptr(1) << ((kLevels - 1 - Level) * kLevelBits);
+    }
+    static size_t slotIndex(uptr Page, unsigned Level) {
+        return (Page >> ((kLevels - 1 - Level) * kLevelBits)) & (kFanout - 1);
+    }
+
+    static PageRange getPageRange(const std::shared_ptr<AllocInfo> &AI);
+
+    void insertRange(Node &N, unsigned Level, uptr Base, PageRange &R);
+    void eraseRange(Node &N, unsigned Level, uptr Base, PageRange &R);
+    Node &getOrSplitChild(Node &N, size_t Index);
+    void setSlot(Node &N, size_t Index, void *Value);
+    void replaceBucket(Node &N, size_t Index, Bucket *Old, Bucket *New);
+    void retire(void *Slot);
+    static void release(void *Slot);
+    void reclaim();
+
+    Node *m_Root;
+
+    ur_mutex m_WriteMutex;
+    // Tagged like the slots
+    std::vector<std::pair<uint64_t, void *>> m_Retired;
+};
+
+} // namespace ur_sanitizer_layer
@@ -13,9 +13,8 @@
 #pragma once
 
 #include "common.hpp"
-#include "stacktrace.hpp"
+#include "stack_depot.hpp"
 
-#include <map>
 #include <memory>
 
 namespace ur_sanitizer_layer {
@@ -37,19 +36,18 @@ struct AllocInfo {
 
     AllocType Type = AllocType::UNKNOWN;
     bool IsReleased = false;
+    // Carved out of a slab of the Suballocator
+    bool IsSuballocated = false;
 
     ur_context_handle_t Context = nullptr;
     ur_device_handle_t Device = nullptr;
 
-    StackTrace AllocStack;
-    StackTrace ReleaseStack;
+    StackId AllocStack = 0;
+    StackId ReleaseStack = 0;
 
     void print();
 };
 
-using AllocationMap = std::map<uptr, std::shared_ptr<AllocInfo>>;
-using AllocationIterator = AllocationMap::iterator;
-
 inline const char *ToString(AllocType Type) {
     switch (Type) {
     case AllocType::DEVICE_USM:
@@ -12,10 +12,12 @@
  */
 
 #include "asan_interceptor.hpp"
+#include "asan_object_pool.hpp"
 #include "asan_options.hpp"
 #include "asan_quarantine.hpp"
 #include "asan_report.hpp"
 #include "asan_shadow_setup.hpp"
+#include "asan_shadow_update.hpp"
 #include "asan_validator.hpp"
 #include "stacktrace.hpp"
 #include "ur_sanitizer_utils.hpp"
@@ -58,20 +60,83 @@ ur_result_t urEnqueueUSMSet(ur_queue_handle_t Queue, void *Ptr, char Value,
         Queue, Ptr, 1, &Value, Size, NumEvents, EventWaitList, OutEvent);
 }
 
-ur_result_t enqueueMemSetShadow(ur_context_handle_t Context,
-                                std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                ur_queue_handle_t Queue, uptr Ptr, uptr Size,
-                                u8 Value) {
-    if (Size == 0) {
-        return UR_RESULT_SUCCESS;
+uptr MemToShadow(const DeviceInfo &DeviceInfo, uptr Ptr) {
+    switch (DeviceInfo.Type) {
+    case DeviceType::CPU:
+        return MemToShadow_CPU(DeviceInfo.ShadowOffset, Ptr);
+    case DeviceType::GPU_PVC:
+        return MemToShadow_PVC(DeviceInfo.ShadowOffset, Ptr);
+    case DeviceType::GPU_DG2:
+        return MemToShadow_DG2(DeviceInfo.ShadowOffset, Ptr);
+    default:
+        return 0;
     }
+}
+
+/// GPU needs to manually map physical memory to the shadow memory before
+/// writing it
+ur_result_t mapShadowMemory(ur_context_handle_t Context,
+                            std::shared_ptr<DeviceInfo> &DeviceInfo,
+                            ur_queue_handle_t Queue, uptr ShadowBegin,
+                            uptr ShadowEnd) {
+    assert(ShadowBegin <= ShadowEnd);
+
+    static const size_t PageSize =
+        GetVirtualMemGranularity(Context, DeviceInfo->Handle);
+
+    ur_physical_mem_properties_t Desc{UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES,
+                                      nullptr, 0};
+    static ur_physical_mem_handle_t PhysicalMem{};
+
+    // Make sure [ShadowBegin, ShadowEnd] is mapped to physical memory
+    for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
+         MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
+        if (!PhysicalMem) {
+            auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
+                Context, DeviceInfo->Handle, PageSize, &Desc, &PhysicalMem);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urPhysicalMemCreate(): {}", URes);
+                return URes;
+            }
+        }
+
+        getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
+                                   (void *)MappedPtr,
+                                   (void *)(MappedPtr + PageSize - 1));
+
+        // FIXME: No flag to check the failed reason is VA is already mapped
+        auto URes = getContext()->urDdiTable.VirtualMem.pfnMap(
+            Context, (void *)MappedPtr, PageSize, PhysicalMem, 0,
+            UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+        if (URes != UR_RESULT_SUCCESS) {
+            getContext()->logger.debug("urVirtualMemMap({}, {}): {}",
+                                       (void *)MappedPtr, PageSize, URes);
+        }
+
+        // Initialize to zero
+        if (URes == UR_RESULT_SUCCESS) {
+            // Reset PhysicalMem to null since it's been mapped
+            PhysicalMem = nullptr;
+
+            auto URes = urEnqueueUSMSet(Queue, (void *)MappedPtr, 0, PageSize);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urEnqueueUSMFill(): {}", URes);
+                return URes;
+            }
+        }
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t enqueueShadowUpdatePlan(ur_context_handle_t Context,
+                                    std::shared_ptr<DeviceInfo> &DeviceInfo,
+                                    ur_queue_handle_t Queue,
+                                    const ShadowUpdatePlan &Plan) {
     if (DeviceInfo->Type == DeviceType::CPU) {
         ///
         /// CPU Device: CPU needs to use a special memset function
         ///
-        uptr ShadowBegin = MemToShadow_CPU(DeviceInfo->ShadowOffset, Ptr);
-        uptr ShadowEnd =
-            MemToShadow_CPU(DeviceInfo->ShadowOffset, Ptr + Size - 1);
 
         // Poison shadow memory outside of asan runtime is not allowed, so we
         // need to avoid memset's call from being intercepted.
@@ -80,94 +145,95 @@ ur_result_t enqueueMemSetShadow(ur_context_handle_t Context,
         if (!MemSet) {
             return UR_RESULT_ERROR_UNKNOWN;
         }
-        getContext()->logger.debug(
-            "enqueueMemSetShadow(addr={}, count={}, value={})",
-            (void *)ShadowBegin, ShadowEnd - ShadowBegin + 1,
-            (void *)(size_t)Value);
-        MemSet((void *)ShadowBegin, Value, ShadowEnd - ShadowBegin + 1);
-    } else {
-        ///
-        /// GPU Device: GPU needs to manually map physical memory before memset
-        ///
-        uptr ShadowBegin = 0, ShadowEnd = 0;
-
-        if (DeviceInfo->Type == DeviceType::GPU_PVC) {
-            ShadowBegin = MemToShadow_PVC(DeviceInfo->ShadowOffset, Ptr);
-            ShadowEnd =
-                MemToShadow_PVC(DeviceInfo->ShadowOffset, Ptr + Size - 1);
-        } else if (DeviceInfo->Type == DeviceType::GPU_DG2) {
-            ShadowBegin = MemToShadow_DG2(DeviceInfo->ShadowOffset, Ptr);
-            ShadowEnd =
-                MemToShadow_DG2(DeviceInfo->ShadowOffset, Ptr + Size - 1);
-        } else {
-            getContext()->logger.error("Unsupport device type");
-            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+
+        for (const auto &[Begin, Range] : Plan.ranges()) {
+            uptr ShadowBegin = MemToShadow(*DeviceInfo, Begin);
+            uptr ShadowEnd = MemToShadow(*DeviceInfo, Range.End - 1);
+            getContext()->logger.debug(
+                "enqueueMemSetShadow(addr={}, count={}, value={})",
+                (void *)ShadowBegin, ShadowEnd - ShadowBegin + 1,
+                (void *)(size_t)Range.Value);
+            MemSet((void *)ShadowBegin, Range.Value,
+                   ShadowEnd - ShadowBegin + 1);
         }
+        return UR_RESULT_SUCCESS;
+    }
 
-        assert(ShadowBegin <= ShadowEnd);
-        {
-            static const size_t PageSize =
-                GetVirtualMemGranularity(Context, DeviceInfo->Handle);
-
-            ur_physical_mem_properties_t Desc{
-                UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES, nullptr, 0};
-            static ur_physical_mem_handle_t PhysicalMem{};
-
-            // Make sure [Ptr, Ptr + Size] is mapped to physical memory
-            for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
-                 MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
-                if (!PhysicalMem) {
-                    auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
-                        Context, DeviceInfo->Handle, PageSize, &Desc,
-                        &PhysicalMem);
-                    if (URes != UR_RESULT_SUCCESS) {
-                        getContext()->logger.error("urPhysicalMemCreate(): {}",
-                                                   URes);
-                        return URes;
-                    }
-                }
+    if (DeviceInfo->Type != DeviceType::GPU_PVC &&
+        DeviceInfo->Type != DeviceType::GPU_DG2) {
+        getContext()->logger.error("Unsupport device type");
+        return UR_RESULT_ERROR_INVALID_ARGUMENT;
+    }
 
-                getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
-                                           (void *)MappedPtr,
-                                           (void *)(MappedPtr + PageSize - 1));
-
-                // FIXME: No flag to check the failed reason is VA is already mapped
-                auto URes = getContext()->urDdiTable.VirtualMem.pfnMap(
-                    Context, (void *)MappedPtr, PageSize, PhysicalMem, 0,
-                    UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
-                if (URes != UR_RESULT_SUCCESS) {
-                    getContext()->logger.debug("urVirtualMemMap({}, {}): {}",
-                                               (void *)MappedPtr, PageSize,
-                                               URes);
-                }
+    ///
+    /// GPU Device: the ranges which follow each other, typically the redzones
+    /// and the user range of an allocation, are written together. A span
+    /// holding a single value is filled, the others are copied from a host
+    /// staging buffer.
+    ///
+    std::vector<u8> Staging;
+    std::vector<std::pair<uptr, size_t>> Copies; // shadow address, offset
+
+    const auto &Ranges = Plan.ranges();
+    for (auto It = Ranges.begin(); It != Ranges.end();) {
+        auto SpanBegin = It;
+        uptr SpanEnd = It->second.End;
+        size_t NumRanges = 1;
+        for (++It; It != Ranges.end() && It->first == SpanEnd; ++It) {
+            SpanEnd = It->second.End;
+            ++NumRanges;
+        }
 
-                // Initialize to zero
-                if (URes == UR_RESULT_SUCCESS) {
-                    // Reset PhysicalMem to null since it's been mapped
-                    PhysicalMem = nullptr;
-
-                    auto URes =
-                        urEnqueueUSMSet(Queue, (void *)MappedPtr, 0, PageSize);
-                    if (URes != UR_RESULT_SUCCESS) {
-                        getContext()->logger.error("urEnqueueUSMFill(): {}",
-                                                   URes);
-                        return URes;
-                    }
-                }
+        uptr ShadowBegin = MemToShadow(*DeviceInfo, SpanBegin->first);
+        uptr ShadowEnd = MemToShadow(*DeviceInfo, SpanEnd - 1);
+        UR_CALL(mapShadowMemory(Context, DeviceInfo, Queue, ShadowBegin,
+                                ShadowEnd));
+
+        if (NumRanges == 1) {
+            auto Value = SpanBegin->second.Value;
+            auto URes = urEnqueueUSMSet(Queue, (void *)ShadowBegin, Value,
+                                        ShadowEnd - ShadowBegin + 1);
+            getContext()->logger.debug(
+                "enqueueMemSetShadow (addr={}, count={}, value={}): {}",
+                (void *)ShadowBegin, ShadowEnd - ShadowBegin + 1,
+                (void *)(size_t)Value, URes);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urEnqueueUSMFill(): {}", URes);
+                return URes;
             }
+            continue;
+        }
+
+        Copies.emplace_back(ShadowBegin, Staging.size());
+        for (auto RangeIt = SpanBegin; RangeIt != It; ++RangeIt) {
+            size_t Count = (RangeIt->second.End - RangeIt->first) /
+                           ASAN_SHADOW_GRANULARITY;
+            Staging.insert(Staging.end(), Count, RangeIt->second.Value);
         }
+    }
 
-        auto URes = urEnqueueUSMSet(Queue, (void *)ShadowBegin, Value,
-                                    ShadowEnd - ShadowBegin + 1);
+    // The staging buffer is only complete now, it must also outlive the
+    // copies
+    for (size_t i = 0; i < Copies.size(); i++) {
+        auto [ShadowBegin, Offset] = Copies[i];
+        size_t Size = (i + 1 < Copies.size() ? Copies[i + 1].second
+                                             : Staging.size()) -
+                      Offset;
+        auto URes = getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
+            Queue, false, (void *)ShadowBegin, Staging.data() + Offset, Size,
+            0, nullptr, nullptr);
         getContext()->logger.debug(
-            "enqueueMemSetShadow (addr={}, count={}, value={}): {}",
-            (void *)ShadowBegin, ShadowEnd - ShadowBegin + 1,
-            (void *)(size_t)Value, URes);
+            "enqueueMemCopyShadow (addr={}, count={}): {}", (void *)ShadowBegin,
+            Size, URes);
         if (URes != UR_RESULT_SUCCESS) {
-            getContext()->logger.error("urEnqueueUSMFill(): {}", URes);
+            getContext()->logger.error("urEnqueueUSMMemcpy(): {}", URes);
             return URes;
         }
     }
+    if (!Copies.empty()) {
+        UR_CALL(getContext()->urDdiTable.Queue.pfnFinish(Queue));
+    }
+
     return UR_RESULT_SUCCESS;
 }
 
@@ -178,7 +244,16 @@ SanitizerInterceptor::SanitizerInterceptor(logger::Logger &logger)
     if (Options(logger).MaxQuarantineSizeMB) {
         m_Quarantine = std::make_unique<Quarantine>(
             static_cast<uint64_t>(Options(logger).MaxQuarantineSizeMB) * 1024 *
-            1024);
+                1024,
+            [this](const std::shared_ptr<AllocInfo> &AI) {
+                getContext()->logger.info("Quarantine Free: {}",
+                                          (void *)AI->AllocBegin);
+                auto Result = releaseAllocation(AI);
+                if (Result != UR_RESULT_SUCCESS) {
+                    getContext()->logger.error("Quarantine Free: {} failed: {}",
+                                               (void *)AI->AllocBegin, Result);
+                }
+            });
     }
 }
 
@@ -191,7 +266,7 @@ SanitizerInterceptor::~SanitizerInterceptor() {
     // they may use the adapter in their destructor
     m_Quarantine = nullptr;
     m_MemBufferMap.clear();
-    m_AllocationMap.clear();
+    m_AllocationIndex.clear();
     m_KernelMap.clear();
     m_ContextMap.clear();
 
@@ -240,61 +315,92 @@ ur_result_t SanitizerInterceptor::allocateMemory(
         NeededSize += Alignment;
     }
 
-    void *Allocated = nullptr;
-
-    if (Type == AllocType::DEVICE_USM) {
-        UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
-            Context, Device, Properties, Pool, NeededSize, &Allocated));
-    } else if (Type == AllocType::HOST_USM) {
-        UR_CALL(getContext()->urDdiTable.USM.pfnHostAlloc(
-            Context, Properties, Pool, NeededSize, &Allocated));
-    } else if (Type == AllocType::SHARED_USM) {
-        UR_CALL(getContext()->urDdiTable.USM.pfnSharedAlloc(
-            Context, Device, Properties, Pool, NeededSize, &Allocated));
-    } else if (Type == AllocType::MEM_BUFFER) {
-        UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
-            Context, Device, Properties, Pool, NeededSize, &Allocated));
+    // For updating shadow memory
+    auto ScheduleShadowUpdate = [&](std::shared_ptr<AllocInfo> &AI) {
+        if (Device) { // Device/Shared USM
+            ContextInfo->insertAllocInfo({Device}, AI);
+        } else { // Host USM
+            ContextInfo->insertAllocInfo(ContextInfo->DeviceList, AI);
+        }
+    };
+
+    uptr AllocBegin = 0;
+    uptr UserBegin = 0;
+    bool IsSuballocated =
+        Options(logger).Suballocate &&
+        Suballocator::canSuballocate(Type, Pool, Properties, Size);
+
+    if (IsSuballocated) {
+        // A chunk only has a left redzone, the next chunk's one is its right
+        // redzone
+        uptr ChunkRZSize = std::max<uptr>(RZSize, Alignment);
+        auto PoisonSlab = [&](const Suballocator::Chunk &Slab) {
+            getContext()->logger.debug("Suballocator: new slab {} of {} bytes",
+                                       (void *)Slab.Begin, Slab.Size);
+            // Poisoned as an allocation without user memory
+            auto SlabAI = std::make_shared<AllocInfo>(
+                AllocInfo{Slab.Begin, Slab.Begin, Slab.Begin, Slab.Size, Type,
+                          false, false, Context, Device, 0, 0});
+            ScheduleShadowUpdate(SlabAI);
+        };
+        Suballocator::Chunk Chunk;
+        UR_CALL(ContextInfo->getSuballocator(Device, Type)
+                    .allocate(ChunkRZSize, Size, Chunk, PoisonSlab));
+        AllocBegin = Chunk.Begin;
+        UserBegin = Chunk.Begin + ChunkRZSize;
+        NeededSize = Chunk.Size;
     } else {
-        getContext()->logger.error("Unsupport memory type");
-        return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        void *Allocated = nullptr;
+
+        if (Type == AllocType::DEVICE_USM) {
+            UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
+                Context, Device, Properties, Pool, NeededSize, &Allocated));
+        } else if (Type == AllocType::HOST_USM) {
+            UR_CALL(getContext()->urDdiTable.USM.pfnHostAlloc(
+                Context, Properties, Pool, NeededSize, &Allocated));
+        } else if (Type == AllocType::SHARED_USM) {
+            UR_CALL(getContext()->urDdiTable.USM.pfnSharedAlloc(
+                Context, Device, Properties, Pool, NeededSize, &Allocated));
+        } else if (Type == AllocType::MEM_BUFFER) {
+            UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
+                Context, Device, Properties, Pool, NeededSize, &Allocated));
+        } else {
+            getContext()->logger.error("Unsupport memory type");
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        AllocBegin = reinterpret_cast<uptr>(Allocated);
+        UserBegin = AllocBegin + RZSize;
+        if (!IsAligned(UserBegin, Alignment)) {
+            UserBegin = RoundUpTo(UserBegin, Alignment);
+        }
     }
 
-    uptr AllocBegin = reinterpret_cast<uptr>(Allocated);
     [[maybe_unused]] uptr AllocEnd = AllocBegin + NeededSize;
-    uptr UserBegin = AllocBegin + RZSize;
-    if (!IsAligned(UserBegin, Alignment)) {
-        UserBegin = RoundUpTo(UserBegin, Alignment);
-    }
     uptr UserEnd = UserBegin + Size;
     assert(UserEnd <= AllocEnd);
 
     *ResultPtr = reinterpret_cast<void *>(UserBegin);
 
-    auto AI = std::make_shared<AllocInfo>(AllocInfo{AllocBegin,
-                                                    UserBegin,
-                                                    UserEnd,
-                                                    NeededSize,
-                                                    Type,
-                                                    false,
-                                                    Context,
-                                                    Device,
-                                                    GetCurrentBacktrace(),
-                                                    {}});
+    auto AI = std::allocate_shared<AllocInfo>(PoolAllocator<AllocInfo>(),
+                                              AllocInfo{AllocBegin,
+                                                        UserBegin,
+                                                        UserEnd,
+                                                        NeededSize,
+                                                        Type,
+                                                        false,
+                                                        IsSuballocated,
+                                                        Context,
+                                                        Device,
+                                                        GetCurrentStackId(),
+                                                        0});
 
     AI->print();
 
-    // For updating shadow memory
-    if (Device) { // Device/Shared USM
-        ContextInfo->insertAllocInfo({Device}, AI);
-    } else { // Host USM
-        ContextInfo->insertAllocInfo(ContextInfo->DeviceList, AI);
-    }
+    ScheduleShadowUpdate(AI);
 
     // For memory release
-    {
-        std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-        m_AllocationMap.emplace(AI->AllocBegin, std::move(AI));
-    }
+    m_AllocationIndex.insert(AI);
 
     return UR_RESULT_SUCCESS;
 }
@@ -304,17 +410,14 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
     auto ContextInfo = getContextInfo(Context);
 
     auto Addr = reinterpret_cast<uptr>(Ptr);
-    auto AllocInfoItOp = findAllocInfoByAddress(Addr);
+    auto AllocInfo = findAllocInfoByAddress(Addr);
 
-    if (!AllocInfoItOp) {
+    if (!AllocInfo) {
         // "Addr" might be a host pointer
         ReportBadFree(Addr, GetCurrentBacktrace(), nullptr);
         return UR_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    auto AllocInfoIt = *AllocInfoItOp;
-    auto &AllocInfo = AllocInfoIt->second;
-
     if (AllocInfo->Context != Context) {
         if (AllocInfo->UserBegin == Addr) {
             ReportBadContext(Addr, GetCurrentBacktrace(), AllocInfo);
@@ -336,7 +439,7 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
     }
 
     AllocInfo->IsReleased = true;
-    AllocInfo->ReleaseStack = GetCurrentBacktrace();
+    AllocInfo->ReleaseStack = GetCurrentStackId();
 
     if (AllocInfo->Type == AllocType::HOST_USM) {
         ContextInfo->insertAllocInfo(ContextInfo->DeviceList, AllocInfo);
@@ -347,27 +450,31 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
     // If quarantine is disabled, USM is freed immediately
     if (!m_Quarantine) {
         getContext()->logger.debug("Free: {}", (void *)AllocInfo->AllocBegin);
-        std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-        m_AllocationMap.erase(AllocInfoIt);
-        return getContext()->urDdiTable.USM.pfnFree(
-            Context, (void *)(AllocInfo->AllocBegin));
-    }
-
-    auto ReleaseList = m_Quarantine->put(AllocInfo->Device, AllocInfoIt);
-    if (ReleaseList.size()) {
-        std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-        for (auto &It : ReleaseList) {
-            getContext()->logger.info("Quarantine Free: {}",
-                                      (void *)It->second->AllocBegin);
-            m_AllocationMap.erase(It);
-            UR_CALL(getContext()->urDdiTable.USM.pfnFree(
-                Context, (void *)(It->second->AllocBegin)));
-        }
+        return releaseAllocation(AllocInfo);
     }
 
+    m_Quarantine->put(AllocInfo->Device, AllocInfo);
+
     return UR_RESULT_SUCCESS;
 }
 
+ur_result_t SanitizerInterceptor::releaseAllocation(
+    const std::shared_ptr<AllocInfo> &AI) {
+    m_AllocationIndex.erase(AI);
+
+    if (AI->IsSuballocated) {
+        // The shadow of the chunk is already poisoned by the release
+        getContextInfo(AI->Context)
+            ->getSuballocator(AI->Device, AI->Type)
+            .deallocate({AI->AllocBegin, AI->AllocSize},
+                        AI->UserBegin - AI->AllocBegin);
+        return UR_RESULT_SUCCESS;
+    }
+
+    return getContext()->urDdiTable.USM.pfnFree(AI->Context,
+                                                (void *)(AI->AllocBegin));
+}
+
 ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
                                                   ur_queue_handle_t Queue,
                                                   USMLaunchInfo &LaunchInfo) {
@@ -441,99 +548,26 @@ ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
     return UR_RESULT_SUCCESS;
 }
 
-/// Each 8 bytes of application memory are mapped into one byte of shadow memory
-/// The meaning of that byte:
-///  - Negative: All bytes are not accessible (poisoned)
-///  - 0: All bytes are accessible
-///  - 1 <= k <= 7: Only the first k bytes is accessible
-///
-/// ref: https://github.com/google/sanitizers/wiki/AddressSanitizerAlgorithm#mapping
-ur_result_t SanitizerInterceptor::enqueueAllocInfo(
-    ur_context_handle_t Context, std::shared_ptr<DeviceInfo> &DeviceInfo,
-    ur_queue_handle_t Queue, std::shared_ptr<AllocInfo> &AI) {
-    if (AI->IsReleased) {
-        int ShadowByte;
-        switch (AI->Type) {
-        case AllocType::HOST_USM:
-            ShadowByte = kUsmHostDeallocatedMagic;
-            break;
-        case AllocType::DEVICE_USM:
-            ShadowByte = kUsmDeviceDeallocatedMagic;
-            break;
-        case AllocType::SHARED_USM:
-            ShadowByte = kUsmSharedDeallocatedMagic;
-            break;
-        case AllocType::MEM_BUFFER:
-            ShadowByte = kMemBufferDeallocatedMagic;
-            break;
-        default:
-            ShadowByte = 0xff;
-            assert(false && "Unknow AllocInfo Type");
-        }
-        UR_CALL(enqueueMemSetShadow(Context, DeviceInfo, Queue, AI->AllocBegin,
-                                    AI->AllocSize, ShadowByte));
-        return UR_RESULT_SUCCESS;
-    }
-
-    // Init zero
-    UR_CALL(enqueueMemSetShadow(Context, DeviceInfo, Queue, AI->AllocBegin,
-                                AI->AllocSize, 0));
-
-    uptr TailBegin = RoundUpTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
-    uptr TailEnd = AI->AllocBegin + AI->AllocSize;
-
-    // User tail
-    if (TailBegin != AI->UserEnd) {
-        auto Value =
-            AI->UserEnd - RoundDownTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
-        UR_CALL(enqueueMemSetShadow(Context, DeviceInfo, Queue, AI->UserEnd, 1,
-                                    static_cast<u8>(Value)));
-    }
-
-    int ShadowByte;
-    switch (AI->Type) {
-    case AllocType::HOST_USM:
-        ShadowByte = kUsmHostRedzoneMagic;
-        break;
-    case AllocType::DEVICE_USM:
-        ShadowByte = kUsmDeviceRedzoneMagic;
-        break;
-    case AllocType::SHARED_USM:
-        ShadowByte = kUsmSharedRedzoneMagic;
-        break;
-    case AllocType::MEM_BUFFER:
-        ShadowByte = kMemBufferRedzoneMagic;
-        break;
-    case AllocType::DEVICE_GLOBAL:
-        ShadowByte = kDeviceGlobalRedzoneMagic;
-        break;
-    default:
-        ShadowByte = 0xff;
-        assert(false && "Unknow AllocInfo Type");
-    }
-
-    // Left red zone
-    UR_CALL(enqueueMemSetShadow(Context, DeviceInfo, Queue, AI->AllocBegin,
-                                AI->UserBegin - AI->AllocBegin, ShadowByte));
-
-    // Right red zone
-    UR_CALL(enqueueMemSetShadow(Context, DeviceInfo, Queue, TailBegin,
-                                TailEnd - TailBegin, ShadowByte));
-
-    return UR_RESULT_SUCCESS;
-}
-
 ur_result_t SanitizerInterceptor::updateShadowMemory(
     std::shared_ptr<ContextInfo> &ContextInfo,
     std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue) {
     auto &AllocInfos = ContextInfo->AllocInfosMap[DeviceInfo->Handle];
     std::scoped_lock<ur_shared_mutex> Guard(AllocInfos.Mutex);
 
+    if (AllocInfos.List.empty()) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    // Replay the pending allocations in order, so that the later ones win
+    ShadowUpdatePlan Plan;
     for (auto &AI : AllocInfos.List) {
-        UR_CALL(enqueueAllocInfo(ContextInfo->Handle, DeviceInfo, Queue, AI));
+        Plan.add(*AI);
     }
     AllocInfos.List.clear();
 
+    UR_CALL(
+        enqueueShadowUpdatePlan(ContextInfo->Handle, DeviceInfo, Queue, Plan));
+
     return UR_RESULT_SUCCESS;
 }
 
@@ -571,17 +605,19 @@ SanitizerInterceptor::registerDeviceGlobals(ur_context_handle_t Context,
 
         auto DeviceInfo = getDeviceInfo(Device);
         for (size_t i = 0; i < NumOfDeviceGlobal; i++) {
-            auto AI = std::make_shared<AllocInfo>(
+            auto AI = std::allocate_shared<AllocInfo>(
+                PoolAllocator<AllocInfo>(),
                 AllocInfo{GVInfos[i].Addr,
                           GVInfos[i].Addr,
                           GVInfos[i].Addr + GVInfos[i].Size,
                           GVInfos[i].SizeWithRedZone,
                           AllocType::DEVICE_GLOBAL,
                           false,
+                          false,
                           Context,
                           Device,
-                          GetCurrentBacktrace(),
-                          {}});
+                          GetCurrentStackId(),
+                          0});
 
             ContextInfo->insertAllocInfo({Device}, AI);
         }
@@ -609,6 +645,11 @@ SanitizerInterceptor::insertContext(ur_context_handle_t Context,
 }
 
 ur_result_t SanitizerInterceptor::eraseContext(ur_context_handle_t Context) {
+    // The quarantined allocations can't be freed once the context is gone
+    if (m_Quarantine) {
+        m_Quarantine->purge(Context);
+    }
+
     std::scoped_lock<ur_shared_mutex> Guard(m_ContextMapMutex);
     assert(m_ContextMap.find(Context) != m_ContextMap.end());
     m_ContextMap.erase(Context);
@@ -710,8 +751,9 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                 }
                 if (auto ValidateResult = ValidateUSMPointer(
                         Context, DeviceInfo->Handle, (uptr)Ptr)) {
-                    ReportInvalidKernelArgument(Kernel, ArgIndex, (uptr)Ptr,
-                                                ValidateResult, PtrPair.second);
+                    ReportInvalidKernelArgument(
+                        Kernel, ArgIndex, (uptr)Ptr, ValidateResult,
+                        StackDepotGet(PtrPair.second));
                     exit(1);
                 }
             }
@@ -920,19 +962,18 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
     return UR_RESULT_SUCCESS;
 }
 
-std::optional<AllocationIterator>
+std::shared_ptr<AllocInfo>
 SanitizerInterceptor::findAllocInfoByAddress(uptr Address) {
-    std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    auto It = m_AllocationMap.upper_bound(Address);
-    if (It == m_AllocationMap.begin()) {
-        return std::optional<AllocationIterator>{};
+    AllocationIndex::ReadGuard Guard;
+    auto AI = m_AllocationIndex.find(Address);
+    if (!AI) {
+        return nullptr;
     }
-    --It;
     // Make sure we got the right AllocInfo
-    assert(Address >= It->second->AllocBegin &&
-           Address < It->second->AllocBegin + It->second->AllocSize &&
+    assert(Address >= (*AI)->AllocBegin &&
+           Address < (*AI)->AllocBegin + (*AI)->AllocSize &&
            "Wrong AllocInfo for the address");
-    return It;
+    return *AI;
 }
 
 ur_result_t USMLaunchInfo::initialize() {
@@ -12,12 +12,15 @@
 
 #pragma once
 
+#include "asan_allocation_index.hpp"
 #include "asan_allocator.hpp"
 #include "asan_buffer.hpp"
 #include "asan_libdevice.hpp"
+#include "asan_suballocator.hpp"
 #include "common.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <queue>
@@ -81,8 +84,7 @@ struct KernelInfo {
     ur_shared_mutex Mutex;
     std::atomic<int32_t> RefCount = 1;
     std::unordered_map<uint32_t, std::shared_ptr<MemBuffer>> BufferArgs;
-    std::unordered_map<uint32_t, std::pair<const void *, StackTrace>>
-        PointerArgs;
+    std::unordered_map<uint32_t, std::pair<const void *, StackId>> PointerArgs;
 
     // Need preserve the order of local arguments
     std::map<uint32_t, LocalArgsInfo> LocalArgs;
@@ -106,6 +108,11 @@ struct ContextInfo {
     std::vector<ur_device_handle_t> DeviceList;
     std::unordered_map<ur_device_handle_t, AllocInfoList> AllocInfosMap;
 
+    std::map<std::pair<ur_device_handle_t, AllocType>,
+             std::unique_ptr<Suballocator>>
+        Suballocators;
+    ur_mutex SuballocatorsMutex;
+
     explicit ContextInfo(ur_context_handle_t Context) : Handle(Context) {
         [[maybe_unused]] auto Result =
             getContext()->urDdiTable.Context.pfnRetain(Context);
@@ -113,6 +120,8 @@ struct ContextInfo {
     }
 
     ~ContextInfo() {
+        // The slabs must be freed while the context is still alive
+        Suballocators.clear();
         [[maybe_unused]] auto Result =
             getContext()->urDdiTable.Context.pfnRelease(Handle);
         assert(Result == UR_RESULT_SUCCESS);
@@ -126,6 +135,16 @@ struct ContextInfo {
             AllocInfos.List.emplace_back(AI);
         }
     }
+
+    Suballocator &getSuballocator(ur_device_handle_t Device, AllocType Type) {
+        std::scoped_lock<ur_mutex> Guard(SuballocatorsMutex);
+        auto &SA = Suballocators[{Device, Type}];
+        if (!SA) {
+            SA = std::make_unique<Suballocator>(
+                Handle, Device, Type, getContext()->urDdiTable.USM);
+        }
+        return *SA;
+    }
 };
 
 struct USMLaunchInfo {
@@ -209,7 +228,13 @@ class SanitizerInterceptor {
         return UR_RESULT_SUCCESS;
     }
 
-    std::optional<AllocationIterator> findAllocInfoByAddress(uptr Address);
+    std::shared_ptr<AllocInfo> findAllocInfoByAddress(uptr Address);
+
+    /// Lock-free lookup for the hot paths, the result may only be used while
+    /// an AllocationIndex::ReadGuard is held
+    const std::shared_ptr<AllocInfo> *findAllocInfoUnsafe(uptr Address) const {
+        return m_AllocationIndex.find(Address);
+    }
 
     std::shared_ptr<ContextInfo> getContextInfo(ur_context_handle_t Context) {
         std::shared_lock<ur_shared_mutex> Guard(m_ContextMapMutex);
@@ -230,13 +255,13 @@ class SanitizerInterceptor {
     }
 
   private:
+    /// Gives the memory of a released allocation back to the adapter or to
+    /// its suballocator
+    ur_result_t releaseAllocation(const std::shared_ptr<AllocInfo> &AI);
+
     ur_result_t updateShadowMemory(std::shared_ptr<ContextInfo> &ContextInfo,
                                    std::shared_ptr<DeviceInfo> &DeviceInfo,
                                    ur_queue_handle_t Queue);
-    ur_result_t enqueueAllocInfo(ur_context_handle_t Context,
-                                 std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                 ur_queue_handle_t Queue,
-                                 std::shared_ptr<AllocInfo> &AI);
 
     /// Initialize Global Variables & Kernel Name at first Launch
     ur_result_t prepareLaunch(ur_context_handle_t Context,
@@ -265,8 +290,7 @@ class SanitizerInterceptor {
     ur_shared_mutex m_MemBufferMapMutex;
 
     /// Assumption: all USM chunks are allocated in one VA
-    AllocationMap m_AllocationMap;
-    ur_shared_mutex m_AllocationMapMutex;
+    AllocationIndex m_AllocationIndex;
 
     std::unique_ptr<Quarantine> m_Quarantine;
     logger::Logger &logger;
@@ -0,0 +1,153 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_object_pool.hpp
+ *
+ */
+
+#pragma once
+
+#include "common.hpp"
+
+#include <mutex>
+#include <new>
+
+namespace ur_sanitizer_layer {
+
+/// Hands out blocks of one size from per-thread free lists, which are refilled
+/// from and drained to a global list in batches, so that allocating and
+/// freeing the records of the layer rarely takes a lock. The memory is never
+/// returned to the system.
+template <size_t Size, size_t Align> class FixedSizePool {
+  public:
+    static void *allocate() {
+        auto &Cache = getCache();
+        if (!Cache.Head) {
+            refill(Cache);
+        }
+        Block *B = Cache.Head;
+        Cache.Head = B->Next;
+        Cache.Count--;
+        return B;
+    }
+
+    static void deallocate(void *Ptr) {
+        auto &Cache = getCache();
+        auto *B = static_cast<Block *>(Ptr);
+        B->Next = Cache.Head;
+        Cache.Head = B;
+        if (++Cache.Count > 2 * kBatchSize) {
+            drain(Cache, kBatchSize);
+        }
+    }
+
+  private:
+    union Block {
+        Block *Next;
+        alignas(Align) unsigned char Storage[Size];
+    };
+
+    static constexpr size_t kBatchSize = 64;
+
+    // Trivially destructible, so that it can still be used by the destructors
+    // running after the thread's drainer
+    struct Cache {
+        Block *Head;
+        size_t Count;
+    };
+
+    struct Drainer {
+        ~Drainer() { drain(getCache(), getCache().Count); }
+    };
+
+    struct Global {
+        ur_mutex Mutex;
+        Block *Head = nullptr;
+    };
+
+    static Cache &getCache() {
+        thread_local Cache C{nullptr, 0};
+        thread_local Drainer D;
+        (void)D;
+        return C;
+    }
+
+    static Global &getGlobal() {
+        // Never destroyed, the records may be released until the very end
+        static Global *G = new Global();
+        return *G;
+    }
+
+    static void refill(Cache &C) {
+        auto &G = getGlobal();
+        {
+            std::scoped_lock<ur_mutex> Guard(G.Mutex);
+            while (G.Head && C.Count < kBatchSize) {
+                Block *B = G.Head;
+                G.Head = B->Next;
+                B->Next = C.Head;
+                C.Head = B;
+                C.Count++;
+            }
+        }
+        if (C.Head) {
+            return;
+        }
+        auto *Blocks = new Block[kBatchSize];
+        for (size_t i = 0; i < kBatchSize; i++) {
+            Blocks[i].Next = C.Head;
+            C.Head = &Blocks[i];
+        }
+        C.Count = kBatchSize;
+    }
+
+    static void drain(Cache &C, size_t Count) {
+        auto &G = getGlobal();
+        std::scoped_lock<ur_mutex> Guard(G.Mutex);
+        for (; Count && C.Head; Count--) {
+            Block *B = C.Head;
+            C.Head = B->Next;
+            C.Count--;
+            B->Next = G.Head;
+            G.Head = B;
+        }
+    }
+};
+
+/// Standard allocator over FixedSizePool, for std::allocate_shared
+template <typename T> struct PoolAllocator {
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template <typename U> PoolAllocator(const PoolAllocator<U> &) {}
+
+    T *allocate(size_t N) {
+        if (N != 1) {
+            return static_cast<T *>(::operator new(N * sizeof(T)));
+        }
+        return static_cast<T *>(
+            FixedSizePool<sizeof(T), alignof(T)>::allocate());
+    }
+
+    void deallocate(T *Ptr, size_t N) {
+        if (N != 1) {
+            ::operator delete(Ptr);
+            return;
+        }
+        FixedSizePool<sizeof(T), alignof(T)>::deallocate(Ptr);
+    }
+
+    template <typename U> bool operator==(const PoolAllocator<U> &) const {
+        return true;
+    }
+    template <typename U> bool operator!=(const PoolAllocator<U> &) const {
+        return false;
+    }
+};
+
+} // namespace ur_sanitizer_layer
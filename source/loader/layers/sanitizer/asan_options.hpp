@@ -13,6 +13,7 @@
 #pragma once
 
 #include "common/ur_util.hpp"
+#include "stacktrace.hpp"
 #include "ur/ur.hpp"
 #include "ur_sanitizer_layer.hpp"
 
@@ -36,9 +37,11 @@ struct AsanOptions {
     uint64_t MinRZSize = 16;
     uint64_t MaxRZSize = 2048;
     uint32_t MaxQuarantineSizeMB = 0;
+    uint32_t MallocContextSize = MAX_BACKTRACE_FRAMES;
     bool DetectLocals = true;
     bool DetectPrivates = true;
     bool DetectKernelArguments = true;
+    bool Suballocate = true;
 
   private:
     AsanOptions(logger::Logger &logger) {
@@ -95,6 +98,7 @@ struct AsanOptions {
         SetBoolOption("detect_locals", DetectLocals);
         SetBoolOption("detect_privates", DetectPrivates);
         SetBoolOption("detect_kernel_arguments", DetectKernelArguments);
+        SetBoolOption("suballocate", Suballocate);
 
         auto KV = OptionsEnvMap->find("quarantine_size_mb");
         if (KV != OptionsEnvMap->end()) {
@@ -112,6 +116,24 @@ struct AsanOptions {
             }
         }
 
+        KV = OptionsEnvMap->find("malloc_context_size");
+        if (KV != OptionsEnvMap->end()) {
+            const auto &Value = KV->second.front();
+            try {
+                auto temp_long = std::stoul(Value);
+                if (temp_long > MAX_BACKTRACE_FRAMES) {
+                    temp_long = MAX_BACKTRACE_FRAMES;
+                    logger.warning("Trying to set malloc context size to a "
+                                   "value greater than {} is ignored",
+                                   MAX_BACKTRACE_FRAMES);
+                }
+                MallocContextSize = temp_long;
+            } catch (...) {
+                die("<SANITIZER>[ERROR]: \"malloc_context_size\" should be "
+                    "a non-negative integer");
+            }
+        }
+
         KV = OptionsEnvMap->find("redzone");
         if (KV != OptionsEnvMap->end()) {
             const auto &Value = KV->second.front();
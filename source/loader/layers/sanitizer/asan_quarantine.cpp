@@ -12,25 +12,261 @@
 
 #include "asan_quarantine.hpp"
 
+#include <algorithm>
+
 namespace ur_sanitizer_layer {
 
-std::vector<AllocationIterator> Quarantine::put(ur_device_handle_t Device,
-                                                AllocationIterator &It) {
-    auto &AI = It->second;
-    auto AllocSize = AI->AllocSize;
-    auto &Cache = getCache(Device);
+namespace {
+
+std::atomic<uint64_t> NextQuarantineId{1};
+
+// The thread cache of the current thread, valid if it belongs to the live
+// quarantine with the id Owner
+struct ThreadCacheSlot {
+    uint64_t Owner = 0;
+    void *Cache = nullptr;
+    // Expires with the quarantine
+    std::weak_ptr<std::atomic<bool>> Exited;
+
+    // Lets the quarantine reclaim the cache, the thread won't use it again
+    void release() {
+        if (auto Flag = Exited.lock()) {
+            Flag->store(true, std::memory_order_release);
+        }
+        Owner = 0;
+        Cache = nullptr;
+        Exited.reset();
+    }
+
+    ~ThreadCacheSlot() { release(); }
+};
+
+thread_local ThreadCacheSlot CurrentThreadCache;
+
+} // namespace
+
+Quarantine::Quarantine(size_t MaxQuarantineSize, ReleaseCallback Release)
+    : m_Id(NextQuarantineId++), m_MaxQuarantineSize(MaxQuarantineSize),
+      m_Release(std::move(Release)) {
+    m_Recycler = std::thread([this] { recycleLoop(); });
+}
+
+Quarantine::~Quarantine() {
+    {
+        std::scoped_lock<std::mutex> Guard(m_RecyclerMutex);
+        m_Stop = true;
+    }
+    m_RecyclerCV.notify_one();
+    m_Recycler.join();
+}
+
+Quarantine::ThreadCache &Quarantine::getThreadCache() {
+    auto &Slot = CurrentThreadCache;
+    if (Slot.Owner == m_Id) {
+        return *static_cast<ThreadCache *>(Slot.Cache);
+    }
+
+    // The thread only keeps the cache of one quarantine
+    Slot.release();
+
+    auto Cache = std::make_unique<ThreadCache>();
+    Slot.Owner = m_Id;
+    Slot.Cache = Cache.get();
+    Slot.Exited = Cache->Exited;
+    std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+    // Keep the list to about the live threads
+    reclaimExitedThreadCaches();
+    m_ThreadCaches.emplace_back(std::move(Cache));
+    return *m_ThreadCaches.back();
+}
+
+void Quarantine::reclaimExitedThreadCaches() {
+    // m_ThreadCachesMutex is held, the batches left by the exited threads
+    // move to the queues of their devices
+    auto Exited = std::stable_partition(
+        m_ThreadCaches.begin(), m_ThreadCaches.end(),
+        [](const std::unique_ptr<ThreadCache> &ThreadCache) {
+            return !ThreadCache->Exited->load(std::memory_order_acquire);
+        });
+    for (auto It = Exited; It != m_ThreadCaches.end(); ++It) {
+        std::scoped_lock<ur_mutex> ThreadGuard((*It)->Mutex);
+        for (auto &[Device, Entry] : (*It)->Entries) {
+            if (Entry.Batch.List.empty()) {
+                continue;
+            }
+            std::scoped_lock<ur_mutex> CacheGuard(Entry.Cache->Mutex);
+            Entry.Cache->enqueue(std::move(Entry.Batch));
+        }
+    }
+    m_ThreadCaches.erase(Exited, m_ThreadCaches.end());
+}
+
+QuarantineCache &Quarantine::getCache(ur_device_handle_t Device) {
+    {
+        std::shared_lock<ur_shared_mutex> Guard(m_Mutex);
+        auto It = m_Map.find(Device);
+        if (It != m_Map.end()) {
+            return *It->second;
+        }
+    }
+    std::scoped_lock<ur_shared_mutex> Guard(m_Mutex);
+    auto &Cache = m_Map[Device];
+    if (!Cache) {
+        Cache = std::make_unique<QuarantineCache>();
+    }
+    return *Cache;
+}
+
+void Quarantine::put(ur_device_handle_t Device,
+                     const std::shared_ptr<AllocInfo> &AI) {
+    auto &ThreadCache = getThreadCache();
+    bool OverLimit = false;
+    {
+        std::scoped_lock<ur_mutex> Guard(ThreadCache.Mutex);
+        auto &Entry = ThreadCache.Entries[Device];
+        if (!Entry.Cache) {
+            Entry.Cache = &getCache(Device);
+        }
+        QuarantineCache *Cache = Entry.Cache;
+
+        // Accounted before the allocation can be seen by the recycler or a
+        // purge, which subtract it from the size once they release it
+        OverLimit = Cache->Size.fetch_add(AI->AllocSize) + AI->AllocSize >
+                    m_MaxQuarantineSize;
+        Entry.Batch.push(AI);
+        // Don't keep much memory out of the device's queue, where it can't
+        // be recycled in order
+        if (Entry.Batch.List.size() >= QuarantineBatch::kMaxCount ||
+            Entry.Batch.Size >= m_MaxQuarantineSize / 16) {
+            std::scoped_lock<ur_mutex> CacheGuard(Cache->Mutex);
+            Cache->enqueue(std::move(Entry.Batch));
+            Entry.Batch = QuarantineBatch{};
+        }
+    }
+
+    if (OverLimit) {
+        {
+            std::scoped_lock<std::mutex> Guard(m_RecyclerMutex);
+            m_RecycleRequested = true;
+        }
+        m_RecyclerCV.notify_one();
+    }
+}
+
+void Quarantine::recycleLoop() {
+    std::unique_lock<std::mutex> Lock(m_RecyclerMutex);
+    while (true) {
+        m_RecyclerCV.wait(Lock,
+                          [this] { return m_Stop || m_RecycleRequested; });
+        if (m_Stop) {
+            return;
+        }
+        m_RecycleRequested = false;
+        Lock.unlock();
+
+        std::vector<std::pair<ur_device_handle_t, QuarantineCache *>> Caches;
+        {
+            std::shared_lock<ur_shared_mutex> Guard(m_Mutex);
+            for (auto &[Device, Cache] : m_Map) {
+                Caches.emplace_back(Device, Cache.get());
+            }
+        }
+        for (auto &[Device, Cache] : Caches) {
+            if (Cache->Size > m_MaxQuarantineSize) {
+                recycle(Device, *Cache);
+            }
+        }
+
+        Lock.lock();
+    }
+}
+
+void Quarantine::recycle(ur_device_handle_t Device, QuarantineCache &Cache) {
+    // Leave some room, so that the next frees don't wake the recycler up
+    // right away
+    const size_t Target = m_MaxQuarantineSize - m_MaxQuarantineSize / 10;
+    bool Flushed = false;
+
+    while (Cache.Size > Target) {
+        std::scoped_lock<ur_mutex> ReleaseGuard(m_ReleaseMutex);
+        std::optional<QuarantineBatch> Batch;
+        {
+            std::scoped_lock<ur_mutex> Guard(Cache.Mutex);
+            Batch = Cache.dequeue();
+        }
+        if (!Batch) {
+            // The rest is in the threads' batches
+            if (Flushed) {
+                break;
+            }
+            flushThreadCaches(Device, Cache);
+            Flushed = true;
+            continue;
+        }
+
+        for (auto &AI : Batch->List) {
+            m_Release(AI);
+        }
+        Cache.Size -= Batch->Size;
+    }
+}
+
+void Quarantine::flushThreadCaches(ur_device_handle_t Device,
+                                   QuarantineCache &Cache) {
+    std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+    reclaimExitedThreadCaches();
+    for (auto &ThreadCache : m_ThreadCaches) {
+        std::scoped_lock<ur_mutex> ThreadGuard(ThreadCache->Mutex);
+        auto It = ThreadCache->Entries.find(Device);
+        if (It == ThreadCache->Entries.end() || It->second.Batch.List.empty()) {
+            continue;
+        }
+        std::scoped_lock<ur_mutex> CacheGuard(Cache.Mutex);
+        Cache.enqueue(std::move(It->second.Batch));
+        It->second.Batch = QuarantineBatch{};
+    }
+}
+
+void Quarantine::purge(ur_context_handle_t Context) {
+    std::scoped_lock<ur_mutex> ReleaseGuard(m_ReleaseMutex);
+
+    std::vector<std::shared_ptr<AllocInfo>> Purged;
+    auto Extract = [&](QuarantineBatch &Batch, QuarantineCache &Cache) {
+        auto It = std::stable_partition(
+            Batch.List.begin(), Batch.List.end(),
+            [&](const std::shared_ptr<AllocInfo> &AI) {
+                return AI->Context != Context;
+            });
+        for (auto Extracted = It; Extracted != Batch.List.end(); ++Extracted) {
+            Batch.Size -= (*Extracted)->AllocSize;
+            Cache.Size -= (*Extracted)->AllocSize;
+            Purged.emplace_back(std::move(*Extracted));
+        }
+        Batch.List.erase(It, Batch.List.end());
+    };
 
-    std::vector<AllocationIterator> DequeueList;
-    std::scoped_lock<ur_mutex> Guard(Cache.Mutex);
-    while (Cache.size() + AllocSize > m_MaxQuarantineSize) {
-        auto ElementOp = Cache.dequeue();
-        if (!ElementOp) {
-            break;
+    {
+        std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+        for (auto &ThreadCache : m_ThreadCaches) {
+            std::scoped_lock<ur_mutex> ThreadGuard(ThreadCache->Mutex);
+            for (auto &[Device, Entry] : ThreadCache->Entries) {
+                Extract(Entry.Batch, *Entry.Cache);
+            }
         }
-        DequeueList.emplace_back(*ElementOp);
     }
-    Cache.enqueue(It);
-    return DequeueList;
+    {
+        std::shared_lock<ur_shared_mutex> Guard(m_Mutex);
+        for (auto &[Device, Cache] : m_Map) {
+            std::scoped_lock<ur_mutex> CacheGuard(Cache->Mutex);
+            for (auto &Batch : Cache->batches()) {
+                Extract(Batch, *Cache);
+            }
+        }
+    }
+
+    for (auto &AI : Purged) {
+        m_Release(AI);
+    }
 }
 
 } // namespace ur_sanitizer_layer
@@ -15,60 +15,126 @@
 #include "asan_allocator.hpp"
 
 #include <atomic>
-#include <queue>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 namespace ur_sanitizer_layer {
 
+/// A group of released allocations moved between the caches in one go
+struct QuarantineBatch {
+    static constexpr size_t kMaxCount = 64;
+
+    std::vector<std::shared_ptr<AllocInfo>> List;
+    // Total memory of the allocations in the batch
+    size_t Size = 0;
+
+    void push(const std::shared_ptr<AllocInfo> &AI) {
+        if (List.empty()) {
+            List.reserve(kMaxCount);
+        }
+        List.push_back(AI);
+        Size += AI->AllocSize;
+    }
+};
+
+/// The released allocations of one device, in the order their batches were
+/// recycled
 class QuarantineCache {
   public:
-    using Element = AllocationIterator;
-    using List = std::queue<Element>;
-
     // The following methods are not thread safe, use this lock
     ur_mutex Mutex;
 
-    // Total memory used, including internal accounting.
-    uptr size() const { return m_Size; }
+    // Total memory of the device's allocations in quarantine, including the
+    // ones still in the per-thread batches
+    std::atomic_size_t Size = 0;
 
-    void enqueue(Element &It) {
-        m_List.push(It);
-        m_Size += It->second->AllocSize;
+    void enqueue(QuarantineBatch &&Batch) {
+        m_Batches.push_back(std::move(Batch));
     }
 
-    std::optional<Element> dequeue() {
-        if (m_List.empty()) {
-            return std::optional<Element>{};
+    std::optional<QuarantineBatch> dequeue() {
+        if (m_Batches.empty()) {
+            return std::optional<QuarantineBatch>{};
         }
-        auto It = m_List.front();
-        m_List.pop();
-        m_Size -= It->second->AllocSize;
-        return It;
+        auto Batch = std::move(m_Batches.front());
+        m_Batches.pop_front();
+        return Batch;
     }
 
+    std::deque<QuarantineBatch> &batches() { return m_Batches; }
+
   private:
-    List m_List;
-    std::atomic_uintptr_t m_Size = 0;
+    std::deque<QuarantineBatch> m_Batches;
 };
 
+/// Delays the release of freed allocations, so that the accesses to them can
+/// be reported as use-after-free.
+///
+/// The allocations are first put in a batch local to the freeing thread,
+/// which is moved to the device's queue once full, or once the thread exits
+/// and the recycler or a new thread reclaims its cache. A background thread
+/// recycles the oldest batches of a device, calling Release for each of their
+/// allocations, once the device's allocations exceed the quarantine size.
 class Quarantine {
   public:
-    explicit Quarantine(size_t MaxQuarantineSize)
-        : m_MaxQuarantineSize(MaxQuarantineSize) {}
+    using ReleaseCallback =
+        std::function<void(const std::shared_ptr<AllocInfo> &)>;
+
+    Quarantine(size_t MaxQuarantineSize, ReleaseCallback Release);
+    ~Quarantine();
 
-    std::vector<AllocationIterator> put(ur_device_handle_t Device,
-                                        AllocationIterator &Ptr);
+    void put(ur_device_handle_t Device, const std::shared_ptr<AllocInfo> &AI);
+
+    /// Releases the allocations of the context right away, before the
+    /// context itself is released
+    void purge(ur_context_handle_t Context);
 
   private:
-    QuarantineCache &getCache(ur_device_handle_t Device) {
-        std::scoped_lock<ur_mutex> Guard(m_Mutex);
-        return m_Map[Device];
-    }
+    struct ThreadCache {
+        struct Entry {
+            QuarantineCache *Cache = nullptr;
+            QuarantineBatch Batch;
+        };
+
+        // Only contended when the recycler steals the batches
+        ur_mutex Mutex;
+        std::unordered_map<ur_device_handle_t, Entry> Entries;
+        // Set once the thread exited, or moved to another quarantine
+        std::shared_ptr<std::atomic<bool>> Exited =
+            std::make_shared<std::atomic<bool>>(false);
+    };
+
+    ThreadCache &getThreadCache();
+    void reclaimExitedThreadCaches();
+    QuarantineCache &getCache(ur_device_handle_t Device);
+
+    void recycleLoop();
+    void recycle(ur_device_handle_t Device, QuarantineCache &Cache);
+    void flushThreadCaches(ur_device_handle_t Device, QuarantineCache &Cache);
+
+    std::unordered_map<ur_device_handle_t, std::unique_ptr<QuarantineCache>>
+        m_Map;
+    ur_shared_mutex m_Mutex;
+
+    std::vector<std::unique_ptr<ThreadCache>> m_ThreadCaches;
+    ur_mutex m_ThreadCachesMutex;
+    const uint64_t m_Id;
 
-    std::unordered_map<ur_device_handle_t, QuarantineCache> m_Map;
-    ur_mutex m_Mutex;
     size_t m_MaxQuarantineSize;
+    ReleaseCallback m_Release;
+    // Held while releasing, so that a purged context is never used afterwards
+    ur_mutex m_ReleaseMutex;
+
+    std::thread m_Recycler;
+    std::mutex m_RecyclerMutex;
+    std::condition_variable m_RecyclerCV;
+    bool m_RecycleRequested = false;
+    bool m_Stop = false;
 };
 
 } // namespace ur_sanitizer_layer
@@ -28,10 +28,10 @@ void PrintAllocateInfo(uptr Addr, const AllocInfo *AI) {
                                 (void *)Addr, ToString(AI->Type),
                                 (void *)AI->UserBegin, (void *)AI->UserEnd);
     getContext()->logger.always("allocated here:");
-    AI->AllocStack.print();
+    StackDepotGet(AI->AllocStack).print();
     if (AI->IsReleased) {
         getContext()->logger.always("freed here:");
-        AI->ReleaseStack.print();
+        StackDepotGet(AI->ReleaseStack).print();
     }
 }
 
@@ -74,9 +74,9 @@ void ReportDoubleFree(uptr Addr, const StackTrace &Stack,
                                 (void *)Addr, ToString(AI->Type),
                                 (void *)AI->UserBegin, (void *)AI->UserEnd);
     getContext()->logger.always("freed here:");
-    AI->ReleaseStack.print();
+    StackDepotGet(AI->ReleaseStack).print();
     getContext()->logger.always("previously allocated here:");
-    AI->AllocStack.print();
+    StackDepotGet(AI->AllocStack).print();
 }
 
 void ReportFatalError(const DeviceSanitizerReport &Report) {
@@ -128,15 +128,14 @@ void ReportUseAfterFree(const DeviceSanitizerReport &Report,
     getContext()->logger.always("");
 
     if (Options(getContext()->logger).MaxQuarantineSizeMB > 0) {
-        auto AllocInfoItOp =
+        auto AllocInfo =
             getContext()->interceptor->findAllocInfoByAddress(Report.Address);
 
-        if (!AllocInfoItOp) {
+        if (!AllocInfo) {
             getContext()->logger.always(
                 "Failed to find which chunck {} is allocated",
                 (void *)Report.Address);
         } else {
-            auto &AllocInfo = (*AllocInfoItOp)->second;
             if (AllocInfo->Context != Context) {
                 getContext()->logger.always(
                     "Failed to find which chunck {} is allocated",
@@ -190,7 +189,7 @@ void ReportInvalidKernelArgument(ur_kernel_handle_t Kernel, uint32_t ArgIndex,
             "The {}th argument {} is located outside of its region [{}, {})",
             ArgIndex, (void *)Addr, (void *)AI->UserBegin, (void *)AI->UserEnd);
         getContext()->logger.always("allocated here:");
-        AI->AllocStack.print();
+        StackDepotGet(AI->AllocStack).print();
         break;
     default:
         break;
@@ -0,0 +1,147 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_shadow_update.cpp
+ *
+ */
+
+#include "asan_shadow_update.hpp"
+#include "asan_libdevice.hpp"
+
+namespace ur_sanitizer_layer {
+
+void ShadowUpdatePlan::add(uptr Ptr, uptr Size, u8 Value) {
+    if (Size == 0) {
+        return;
+    }
+    // The shadow bytes of the first and the last byte, and all in between
+    assign(RoundDownTo(Ptr, ASAN_SHADOW_GRANULARITY),
+           RoundDownTo(Ptr + Size - 1, ASAN_SHADOW_GRANULARITY) +
+               ASAN_SHADOW_GRANULARITY,
+           Value);
+}
+
+void ShadowUpdatePlan::assign(uptr Begin, uptr End, u8 Value) {
+    // Split the range overlapping Begin from the left
+    auto It = m_Ranges.lower_bound(Begin);
+    if (It != m_Ranges.begin()) {
+        auto Prev = std::prev(It);
+        if (Prev->second.End > Begin) {
+            if (Prev->second.End > End) {
+                m_Ranges[End] = {Prev->second.End, Prev->second.Value};
+            }
+            Prev->second.End = Begin;
+        }
+    }
+
+    // Drop the ranges starting inside [Begin, End), keeping the part of the
+    // last one that goes past End
+    It = m_Ranges.lower_bound(Begin);
+    while (It != m_Ranges.end() && It->first < End) {
+        if (It->second.End > End) {
+            m_Ranges[End] = {It->second.End, It->second.Value};
+        }
+        It = m_Ranges.erase(It);
+    }
+
+    It = m_Ranges.emplace(Begin, Range{End, Value}).first;
+
+    // Merge with the neighbours holding the same value
+    auto Next = std::next(It);
+    if (Next != m_Ranges.end() && Next->first == End &&
+        Next->second.Value == Value) {
+        It->second.End = Next->second.End;
+        m_Ranges.erase(Next);
+    }
+    if (It != m_Ranges.begin()) {
+        auto Prev = std::prev(It);
+        if (Prev->second.End == Begin && Prev->second.Value == Value) {
+            Prev->second.End = It->second.End;
+            m_Ranges.erase(It);
+        }
+    }
+}
+
+/// Each 16 bytes of application memory are mapped into one byte of shadow
+/// memory. The meaning of that byte:
+///  - Negative: All bytes are not accessible (poisoned)
+///  - 0: All bytes are accessible
+///  - 1 <= k <= 15: Only the first k bytes is accessible
+///
+/// ref: https://github.com/google/sanitizers/wiki/AddressSanitizerAlgorithm#mapping
+void ShadowUpdatePlan::add(const AllocInfo &AI) {
+    // The left redzone of a suballocated chunk was poisoned with its slab and
+    // never changes
+    uptr Begin = AI.IsSuballocated ? AI.UserBegin : AI.AllocBegin;
+    uptr End = AI.AllocBegin + AI.AllocSize;
+
+    if (AI.IsReleased) {
+        int ShadowByte;
+        switch (AI.Type) {
+        case AllocType::HOST_USM:
+            ShadowByte = kUsmHostDeallocatedMagic;
+            break;
+        case AllocType::DEVICE_USM:
+            ShadowByte = kUsmDeviceDeallocatedMagic;
+            break;
+        case AllocType::SHARED_USM:
+            ShadowByte = kUsmSharedDeallocatedMagic;
+            break;
+        case AllocType::MEM_BUFFER:
+            ShadowByte = kMemBufferDeallocatedMagic;
+            break;
+        default:
+            ShadowByte = 0xff;
+            assert(false && "Unknow AllocInfo Type");
+        }
+        add(Begin, End - Begin, ShadowByte);
+        return;
+    }
+
+    // Init zero
+    add(Begin, End - Begin, 0);
+
+    uptr TailBegin = RoundUpTo(AI.UserEnd, ASAN_SHADOW_GRANULARITY);
+
+    // User tail
+    if (TailBegin != AI.UserEnd) {
+        auto Value =
+            AI.UserEnd - RoundDownTo(AI.UserEnd, ASAN_SHADOW_GRANULARITY);
+        add(AI.UserEnd, 1, static_cast<u8>(Value));
+    }
+
+    int ShadowByte;
+    switch (AI.Type) {
+    case AllocType::HOST_USM:
+        ShadowByte = kUsmHostRedzoneMagic;
+        break;
+    case AllocType::DEVICE_USM:
+        ShadowByte = kUsmDeviceRedzoneMagic;
+        break;
+    case AllocType::SHARED_USM:
+        ShadowByte = kUsmSharedRedzoneMagic;
+        break;
+    case AllocType::MEM_BUFFER:
+        ShadowByte = kMemBufferRedzoneMagic;
+        break;
+    case AllocType::DEVICE_GLOBAL:
+        ShadowByte = kDeviceGlobalRedzoneMagic;
+        break;
+    default:
+        ShadowByte = 0xff;
+        assert(false && "Unknow AllocInfo Type");
+    }
+
+    // Left red zone
+    add(Begin, AI.UserBegin - Begin, ShadowByte);
+
+    // Right red zone
+    add(TailBegin, End - TailBegin, ShadowByte);
+}
+
+} // namespace ur_sanitizer_layer
@@ -0,0 +1,54 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_shadow_update.hpp
+ *
+ */
+
+#pragma once
+
+#include "asan_allocator.hpp"
+#include "common.hpp"
+
+#include <iterator>
+#include <map>
+
+namespace ur_sanitizer_layer {
+
+/// The shadow values to write for the pending allocations of a device, kept
+/// as disjoint ranges of application memory rounded to the shadow
+/// granularity. A range added later overrides what it overlaps, and adjacent
+/// ranges with the same value are merged, so the plan is applied with as few
+/// writes as possible.
+class ShadowUpdatePlan {
+  public:
+    struct Range {
+        uptr End;
+        u8 Value;
+    };
+
+    /// Every byte of [Ptr, Ptr + Size) gets the shadow value Value
+    void add(uptr Ptr, uptr Size, u8 Value);
+
+    /// Poisons the redzones and unpoisons the user range of a live
+    /// allocation, or poisons the whole of a released one
+    void add(const AllocInfo &AI);
+
+    bool empty() const { return m_Ranges.empty(); }
+    void clear() { m_Ranges.clear(); }
+
+    /// The ranges sorted by address, keyed by their beginning
+    const std::map<uptr, Range> &ranges() const { return m_Ranges; }
+
+  private:
+    void assign(uptr Begin, uptr End, u8 Value);
+
+    std::map<uptr, Range> m_Ranges;
+};
+
+} // namespace ur_sanitizer_layer
@@ -0,0 +1,120 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_suballocator.cpp
+ *
+ */
+
+#include "asan_suballocator.hpp"
+#include "asan_libdevice.hpp"
+
+#include <algorithm>
+
+namespace ur_sanitizer_layer {
+
+namespace {
+
+constexpr size_t kMinSlabSize = 64 * 1024;
+constexpr size_t kMinChunksPerSlab = 8;
+
+// The size classes are spaced by an eighth of the next power of two, and by
+// the redzone size, which the rooms must stay aligned to
+uptr GetRoomSize(size_t Size, uptr RZSize) {
+    uptr Step = ASAN_SHADOW_GRANULARITY;
+    while (Step * 8 < Size) {
+        Step *= 2;
+    }
+    return RoundUpTo(RoundUpTo(std::max<size_t>(Size, 1), Step), RZSize);
+}
+
+} // namespace
+
+Suballocator::~Suballocator() {
+    for (auto Slab : m_Slabs) {
+        [[maybe_unused]] auto Result = m_USM.pfnFree(m_Context, Slab);
+        assert(Result == UR_RESULT_SUCCESS);
+    }
+}
+
+bool Suballocator::canSuballocate(AllocType Type, ur_usm_pool_handle_t Pool,
+                                  const ur_usm_desc_t *Properties,
+                                  size_t Size) {
+    if (Type != AllocType::DEVICE_USM && Type != AllocType::HOST_USM &&
+        Type != AllocType::SHARED_USM) {
+        return false;
+    }
+    // The memory of user pools and the allocations with special properties
+    // must come from the adapter
+    if (Pool) {
+        return false;
+    }
+    if (Properties && (Properties->pNext ||
+                       (Properties->hints & ~UR_USM_ADVICE_FLAG_DEFAULT))) {
+        return false;
+    }
+    return Size <= kMaxSuballocatedSize;
+}
+
+ur_result_t Suballocator::allocateSlab(size_t Size, void **Slab) {
+    switch (m_Type) {
+    case AllocType::DEVICE_USM:
+        return m_USM.pfnDeviceAlloc(m_Context, m_Device, nullptr, nullptr,
+                                    Size, Slab);
+    case AllocType::HOST_USM:
+        return m_USM.pfnHostAlloc(m_Context, nullptr, nullptr, Size, Slab);
+    case AllocType::SHARED_USM:
+        return m_USM.pfnSharedAlloc(m_Context, m_Device, nullptr, nullptr,
+                                    Size, Slab);
+    default:
+        assert(false && "Unsupported type of suballocation");
+        return UR_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+ur_result_t Suballocator::allocate(uptr RZSize, size_t Size, Chunk &Result,
+                                   const SlabCallback &PoisonSlab) {
+    uptr RoomSize = GetRoomSize(Size, RZSize);
+    uptr ChunkSize = RZSize + RoomSize;
+
+    std::scoped_lock<ur_mutex> Guard(m_Mutex);
+    auto &Class = m_Classes[{RZSize, RoomSize}];
+
+    if (!Class.FreeList.empty()) {
+        Result = Chunk{Class.FreeList.back(), ChunkSize};
+        Class.FreeList.pop_back();
+        return UR_RESULT_SUCCESS;
+    }
+
+    if (Class.Next + ChunkSize > Class.End) {
+        // Leave room to align the first chunk, and for the last redzone
+        size_t SlabSize =
+            std::max(kMinSlabSize, kMinChunksPerSlab * ChunkSize) + 2 * RZSize;
+        void *Slab = nullptr;
+        ur_result_t Status = allocateSlab(SlabSize, &Slab);
+        if (Status != UR_RESULT_SUCCESS) {
+            return Status;
+        }
+        m_Slabs.push_back(Slab);
+
+        uptr SlabBegin = reinterpret_cast<uptr>(Slab);
+        Class.Next = RoundUpTo(SlabBegin, RZSize);
+        Class.End = SlabBegin + SlabSize - RZSize;
+        PoisonSlab(Chunk{SlabBegin, SlabSize});
+    }
+
+    Result = Chunk{Class.Next, ChunkSize};
+    Class.Next += ChunkSize;
+    return UR_RESULT_SUCCESS;
+}
+
+void Suballocator::deallocate(const Chunk &C, uptr RZSize) {
+    std::scoped_lock<ur_mutex> Guard(m_Mutex);
+    m_Classes[{RZSize, C.Size - RZSize}].FreeList.push_back(C.Begin);
+}
+
+} // namespace ur_sanitizer_layer
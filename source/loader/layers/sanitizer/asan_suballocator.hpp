@@ -0,0 +1,86 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_suballocator.hpp
+ *
+ */
+
+#pragma once
+
+#include "asan_allocator.hpp"
+#include "common.hpp"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+/// Carves the small USM allocations of one context, device and type out of
+/// slabs allocated from the adapter.
+///
+/// A slab is split in chunks of one size class, each made of a redzone
+/// followed by the room of the user memory, and ends with a redzone: the
+/// redzone of a chunk is the right redzone of the chunk before it. The whole
+/// slab is poisoned when it's created, so that a chunk only has to update
+/// the shadow of its room afterwards. The released chunks are reused once
+/// they leave the quarantine.
+class Suballocator {
+  public:
+    struct Chunk {
+        uptr Begin;
+        uptr Size;
+    };
+
+    static constexpr size_t kMaxSuballocatedSize = 16 * 1024;
+
+    /// The slabs are allocated and freed with the functions of USM
+    Suballocator(ur_context_handle_t Context, ur_device_handle_t Device,
+                 AllocType Type, const ur_usm_dditable_t &USM)
+        : m_Context(Context), m_Device(Device), m_Type(Type), m_USM(USM) {}
+    ~Suballocator();
+
+    Suballocator(const Suballocator &) = delete;
+    Suballocator &operator=(const Suballocator &) = delete;
+
+    static bool canSuballocate(AllocType Type, ur_usm_pool_handle_t Pool,
+                               const ur_usm_desc_t *Properties, size_t Size);
+
+    using SlabCallback = std::function<void(const Chunk &Slab)>;
+
+    /// Takes a chunk with a redzone of RZSize bytes followed by at least Size
+    /// bytes aligned to RZSize. When a slab has to be allocated for it,
+    /// PoisonSlab is called before any of its chunks is handed out.
+    ur_result_t allocate(uptr RZSize, size_t Size, Chunk &Result,
+                         const SlabCallback &PoisonSlab);
+
+    /// Gives back a chunk returned by allocate
+    void deallocate(const Chunk &C, uptr RZSize);
+
+  private:
+    struct SizeClass {
+        std::vector<uptr> FreeList;
+        // The part of the last slab never handed out
+        uptr Next = 0;
+        uptr End = 0;
+    };
+
+    ur_result_t allocateSlab(size_t Size, void **Slab);
+
+    ur_context_handle_t m_Context;
+    ur_device_handle_t m_Device;
+    AllocType m_Type;
+    const ur_usm_dditable_t &m_USM;
+
+    // Keyed by the redzone size and the room of the chunks
+    std::map<std::pair<uptr, uptr>, SizeClass> m_Classes;
+    std::vector<void *> m_Slabs;
+    ur_mutex m_Mutex;
+};
+
+} // namespace ur_sanitizer_layer
@@ -38,8 +38,10 @@ ValidateUSMResult ValidateUSMPointer(ur_context_handle_t Context,
                                      ur_device_handle_t Device, uptr Ptr) {
     assert(Ptr != 0 && "Don't validate nullptr here");
 
-    auto AllocInfoItOp = getContext()->interceptor->findAllocInfoByAddress(Ptr);
-    if (!AllocInfoItOp) {
+    // Only the failures keep the AllocInfo, so don't copy it on the way
+    AllocationIndex::ReadGuard Guard;
+    auto AllocInfoPtr = getContext()->interceptor->findAllocInfoUnsafe(Ptr);
+    if (!AllocInfoPtr) {
         auto DI = getContext()->interceptor->getDeviceInfo(Device);
         bool IsSupportSharedSystemUSM = DI->IsSupportSharedSystemUSM;
         if (IsSupportSharedSystemUSM) {
@@ -49,7 +51,7 @@ ValidateUSMResult ValidateUSMPointer(ur_context_handle_t Context,
         return ValidateUSMResult::fail(ValidateUSMResult::MAYBE_HOST_POINTER);
     }
 
-    auto AllocInfo = AllocInfoItOp.value()->second;
+    auto &AllocInfo = *AllocInfoPtr;
 
     if (AllocInfo->Context != Context) {
         return ValidateUSMResult::fail(ValidateUSMResult::BAD_CONTEXT,
@@ -14,23 +14,26 @@
 
 namespace ur_sanitizer_layer {
 
-StackTrace GetCurrentBacktrace() {
-    void *Frames[MAX_BACKTRACE_FRAMES];
-    int FrameCount = backtrace(Frames, MAX_BACKTRACE_FRAMES);
-    char **Symbols = backtrace_symbols(Frames, FrameCount);
+size_t GetBacktraceFrames(BacktraceFrame *Frames, size_t MaxFrames) {
+    int FrameCount = backtrace(Frames, static_cast<int>(MaxFrames));
+    return FrameCount > 0 ? FrameCount : 0;
+}
+
+std::vector<BacktraceInfo> GetBacktraceSymbols(const BacktraceFrame *Frames,
+                                               size_t Size) {
+    char **Symbols = backtrace_symbols(Frames, Size);
 
     if (Symbols == nullptr) {
-        return StackTrace();
+        return {};
     }
 
-    StackTrace Stack;
-    for (int i = 0; i < FrameCount; i++) {
-        BacktraceInfo addr_info(Symbols[i]);
-        Stack.stack.emplace_back(addr_info);
+    std::vector<BacktraceInfo> Infos;
+    for (size_t i = 0; i < Size; i++) {
+        Infos.emplace_back(Symbols[i]);
     }
     free(Symbols);
 
-    return Stack;
+    return Infos;
 }
 
 } // namespace ur_sanitizer_layer
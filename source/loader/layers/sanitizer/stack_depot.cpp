@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file stack_depot.cpp
+ *
+ */
+
+#include "stack_depot.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace ur_sanitizer_layer {
+
+namespace {
+
+// MurmurHash2 over the frame addresses, as in compiler-rt
+u32 HashFrames(const BacktraceFrame *Frames, size_t Size) {
+    constexpr u32 m = 0x5bd1e995;
+    constexpr u32 r = 24;
+    u32 h = 0x9747b28c ^ static_cast<u32>(Size);
+    for (size_t i = 0; i < Size; i++) {
+        auto Addr = static_cast<uint64_t>(reinterpret_cast<uptr>(Frames[i]));
+        u32 k = static_cast<u32>(Addr) ^ static_cast<u32>(Addr >> 32);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h *= m;
+        h ^= k;
+    }
+    h ^= h >> 13;
+    h *= m;
+    h ^= h >> 15;
+    return h;
+}
+
+} // namespace
+
+bool StackDepot::Node::equals(u32 Hash, const BacktraceFrame *Frames,
+                              size_t Size) {
+    return this->Hash == Hash && this->Size == Size &&
+           std::memcmp(frames(), Frames, Size * sizeof(BacktraceFrame)) == 0;
+}
+
+StackDepot::Node *StackDepot::find(Node *First, Node *Last, u32 Hash,
+                                   const BacktraceFrame *Frames, size_t Size) {
+    for (Node *N = First; N != Last; N = N->Next) {
+        if (N->equals(Hash, Frames, Size)) {
+            return N;
+        }
+    }
+    return nullptr;
+}
+
+StackDepot::Node *StackDepot::createNode(u32 Hash, const BacktraceFrame *Frames,
+                                         size_t Size) {
+    void *Mem = ::operator new(sizeof(Node) + Size * sizeof(BacktraceFrame));
+    Node *N = new (Mem) Node{nullptr, 0, Hash, static_cast<u32>(Size)};
+    std::memcpy(N->frames(), Frames, Size * sizeof(BacktraceFrame));
+    return N;
+}
+
+void StackDepot::destroyNode(Node *N) { ::operator delete(N); }
+
+bool StackDepot::publishId(StackId Id, Node *N) {
+    if (Id / kNodesPerChunk >= kMaxChunks) {
+        return false;
+    }
+    auto &ChunkSlot = m_IdChunks[Id / kNodesPerChunk];
+    auto *Chunk = ChunkSlot.load(std::memory_order_acquire);
+    if (!Chunk) {
+        auto *NewChunk = new std::atomic<Node *>[kNodesPerChunk]();
+        if (ChunkSlot.compare_exchange_strong(Chunk, NewChunk,
+                                              std::memory_order_acq_rel)) {
+            Chunk = NewChunk;
+        } else {
+            delete[] NewChunk;
+        }
+    }
+    Chunk[Id % kNodesPerChunk].store(N, std::memory_order_release);
+    return true;
+}
+
+StackId StackDepot::put(const BacktraceFrame *Frames, size_t Size) {
+    if (Size == 0) {
+        return 0;
+    }
+
+    u32 Hash = HashFrames(Frames, Size);
+    auto &Bucket = m_Table[Hash % kTabSize];
+
+    Node *Head = Bucket.load(std::memory_order_acquire);
+    if (Node *N = find(Head, nullptr, Hash, Frames, Size)) {
+        return N->Id;
+    }
+
+    // The id is published before the node, so that any thread which finds the
+    // node can also look it up by its id
+    Node *NewNode = createNode(Hash, Frames, Size);
+    NewNode->Id = m_NextId.fetch_add(1, std::memory_order_relaxed);
+    if (!publishId(NewNode->Id, NewNode)) {
+        // The depot is full, the stack is dropped
+        destroyNode(NewNode);
+        return 0;
+    }
+
+    while (true) {
+        NewNode->Next = Head;
+        Node *OldHead = Head;
+        if (Bucket.compare_exchange_weak(Head, NewNode,
+                                         std::memory_order_release,
+                                         std::memory_order_acquire)) {
+            return NewNode->Id;
+        }
+        // Another thread may have inserted the same stack in the meantime
+        if (Node *N = find(Head, OldHead, Hash, Frames, Size)) {
+            // Our id is never handed out, but still resolves to the stack
+            publishId(NewNode->Id, N);
+            destroyNode(NewNode);
+            return N->Id;
+        }
+    }
+}
+
+StackTrace StackDepot::get(StackId Id) const {
+    if (Id == 0 || Id / kNodesPerChunk >= kMaxChunks) {
+        return StackTrace();
+    }
+    auto *Chunk =
+        m_IdChunks[Id / kNodesPerChunk].load(std::memory_order_acquire);
+    if (!Chunk) {
+        return StackTrace();
+    }
+    Node *N = Chunk[Id % kNodesPerChunk].load(std::memory_order_acquire);
+    if (!N) {
+        return StackTrace();
+    }
+    StackTrace Stack;
+    Stack.stack.assign(N->frames(), N->frames() + N->Size);
+    return Stack;
+}
+
+StackDepot &GetStackDepot() {
+    // Never destroyed, the stacks may be reported until the very end
+    static StackDepot *Depot = new StackDepot();
+    return *Depot;
+}
+
+} // namespace ur_sanitizer_layer
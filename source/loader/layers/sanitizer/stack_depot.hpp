@@ -0,0 +1,80 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file stack_depot.hpp
+ *
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "stacktrace.hpp"
+
+#include <atomic>
+
+namespace ur_sanitizer_layer {
+
+// Identifies a stack interned in the stack depot, 0 is the empty stack
+using StackId = u32;
+
+// Stores each distinct stack once, like compiler-rt's StackDepot, so that the
+// stacks captured for allocations, frees and kernel arguments only cost a
+// 32-bit id. The table is append-only and lock-free: stacks are never removed
+// and a lookup only follows pointers published with release semantics.
+class StackDepot {
+  public:
+    StackDepot() = default;
+    StackDepot(const StackDepot &) = delete;
+    StackDepot &operator=(const StackDepot &) = delete;
+
+    StackId put(const BacktraceFrame *Frames, size_t Size);
+
+    StackTrace get(StackId Id) const;
+
+  private:
+    struct Node {
+        Node *Next;
+        StackId Id;
+        u32 Hash;
+        u32 Size;
+
+        // The frames are stored right after the node
+        BacktraceFrame *frames() {
+            return reinterpret_cast<BacktraceFrame *>(this + 1);
+        }
+        bool equals(u32 Hash, const BacktraceFrame *Frames, size_t Size);
+    };
+
+    static Node *find(Node *First, Node *Last, u32 Hash,
+                      const BacktraceFrame *Frames, size_t Size);
+    static Node *createNode(u32 Hash, const BacktraceFrame *Frames,
+                            size_t Size);
+    static void destroyNode(Node *N);
+
+    bool publishId(StackId Id, Node *N);
+
+    static constexpr size_t kTabSize = 1 << 16;
+    static constexpr size_t kNodesPerChunk = 1 << 12;
+    static constexpr size_t kMaxChunks = 1 << 12;
+
+    // Buckets of the hash table, each one a singly linked list
+    std::atomic<Node *> m_Table[kTabSize] = {};
+    // Maps the ids to the nodes, chunks are allocated on demand
+    std::atomic<std::atomic<Node *> *> m_IdChunks[kMaxChunks] = {};
+    std::atomic<StackId> m_NextId{1};
+};
+
+StackDepot &GetStackDepot();
+
+// Interns the current stack, at most "malloc_context_size" frames of it.
+// Defined in stacktrace.cpp, next to the capture of the stacks.
+StackId GetCurrentStackId();
+
+inline StackTrace StackDepotGet(StackId Id) { return GetStackDepot().get(Id); }
+
+} // namespace ur_sanitizer_layer
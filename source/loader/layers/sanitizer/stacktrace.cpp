@@ -11,6 +11,8 @@
  */
 
 #include "stacktrace.hpp"
+#include "asan_options.hpp"
+#include "stack_depot.hpp"
 #include "ur_sanitizer_layer.hpp"
 
 extern "C" {
@@ -79,14 +81,31 @@ SourceInfo ParseSymbolizerOutput(const std::string &Output) {
 
 } // namespace
 
+StackTrace GetCurrentBacktrace() {
+    BacktraceFrame Frames[MAX_BACKTRACE_FRAMES];
+    size_t FrameCount = GetBacktraceFrames(Frames, MAX_BACKTRACE_FRAMES);
+    StackTrace Stack;
+    Stack.stack.assign(Frames, Frames + FrameCount);
+    return Stack;
+}
+
+StackId GetCurrentStackId() {
+    BacktraceFrame Frames[MAX_BACKTRACE_FRAMES];
+    size_t FrameCount = GetBacktraceFrames(
+        Frames, Options(getContext()->logger).MallocContextSize);
+    return GetStackDepot().put(Frames, FrameCount);
+}
+
 void StackTrace::print() const {
-    if (!stack.size()) {
+    // Symbolize the frames only now that the stack is reported
+    auto Symbols = GetBacktraceSymbols(stack.data(), stack.size());
+    if (!Symbols.size()) {
         getContext()->logger.always("  failed to acquire backtrace");
     }
 
     unsigned index = 0;
 
-    for (auto &BI : stack) {
+    for (auto &BI : Symbols) {
         // Skip runtime modules
         if (Contains(BI, "libsycl.so") ||
             Contains(BI, "libpi_unified_runtime.so") ||
@@ -21,11 +21,20 @@ namespace ur_sanitizer_layer {
 constexpr size_t MAX_BACKTRACE_FRAMES = 64;
 
 struct StackTrace {
-    std::vector<BacktraceInfo> stack;
+    std::vector<BacktraceFrame> stack;
 
     void print() const;
 };
 
 StackTrace GetCurrentBacktrace();
 
+// Captures at most MaxFrames return addresses of the current thread into
+// Frames, and returns how many were captured.
+size_t GetBacktraceFrames(BacktraceFrame *Frames, size_t MaxFrames);
+
+// Describes each frame as "<module_name>([function_name]+function_offset)
+// [offset]", this is only needed when a stack is printed.
+std::vector<BacktraceInfo> GetBacktraceSymbols(const BacktraceFrame *Frames,
+                                               size_t Size);
+
 } // namespace ur_sanitizer_layer
@@ -12,7 +12,7 @@
 
 #include "asan_interceptor.hpp"
 #include "asan_options.hpp"
-#include "stacktrace.hpp"
+#include "stack_depot.hpp"
 #include "ur_sanitizer_layer.hpp"
 #include "ur_sanitizer_utils.hpp"
 
@@ -1360,7 +1360,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     if (Options(getContext()->logger).DetectKernelArguments) {
         auto KI = getContext()->interceptor->getKernelInfo(hKernel);
         std::scoped_lock<ur_shared_mutex> Guard(KI->Mutex);
-        KI->PointerArgs[argIndex] = {pArgValue, GetCurrentBacktrace()};
+        KI->PointerArgs[argIndex] = {pArgValue, GetCurrentStackId()};
     }
 
     ur_result_t result =
@@ -16,6 +16,7 @@
 #include "xpti/xpti_trace_framework.h"
 #include <atomic>
 #include <optional>
+#include <regex>
 #include <sstream>
 
 namespace ur_tracing_layer {
@@ -58,6 +59,10 @@ void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
 }
 
 uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
+    if (!xptiEnabled) {
+        return 0;
+    }
+
     if (auto loc = codelocData.get_codeloc()) {
         xpti::payload_t payload =
             xpti::payload_t(loc->functionName, loc->sourceFile, loc->lineNumber,
@@ -76,10 +81,47 @@ uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
 
 void context_t::notify_end(uint32_t id, const char *name, void *args,
                            ur_result_t *resultp, uint64_t instance) {
+    if (!xptiEnabled) {
+        return;
+    }
+
     notify((uint16_t)xpti::trace_point_type_t::function_with_args_end, id, name,
            args, resultp, instance);
 }
 
+void context_t::initTracing() {
+    // Subscribers are loaded when the stream is initialized, in the
+    // constructor, so they are all known by now.
+    xptiEnabled = xptiTraceEnabled();
+    traceCalls = xptiEnabled || logger.isLevelEnabled(logger::Level::INFO);
+    tracedFunctions.clear();
+
+    functionFilter.reset();
+    if (auto filter = ur_getenv("UR_TRACING_FUNCTIONS")) {
+        try {
+            functionFilter.emplace(*filter);
+        } catch (const std::regex_error &e) {
+            logger.error("invalid UR_TRACING_FUNCTIONS regular expression "
+                         "\"{}\": {}, tracing all functions",
+                         *filter, e.what());
+        }
+    }
+}
+
+void context_t::initTracedFunction(ur_function_t function, const char *name) {
+    // Every function gets its bit, so that isTraced doesn't need to check
+    // the bounds.
+    size_t word = function / 64;
+    if (word >= tracedFunctions.size()) {
+        tracedFunctions.resize(word + 1);
+    }
+    if (!traceCalls ||
+        (functionFilter && !std::regex_match(name, *functionFilter))) {
+        return;
+    }
+    tracedFunctions[word] |= uint64_t(1) << (function % 64);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() { xptiFinalize(CALL_STREAM_NAME); }
 } // namespace ur_tracing_layer
@@ -15,9 +15,15 @@
 
 #include "logger/ur_logger.hpp"
 #include "ur_ddi.h"
+#include "ur_print.hpp"
 #include "ur_proxy_layer.hpp"
 #include "ur_util.hpp"
 
+#include <optional>
+#include <ostream>
+#include <regex>
+#include <vector>
+
 #define TRACING_COMP_NAME "tracing layer"
 
 namespace ur_tracing_layer {
@@ -43,17 +49,48 @@ class __urdlllocal context_t : public proxy_layer_context_t,
     void notify_end(uint32_t id, const char *name, void *args,
                     ur_result_t *resultp, uint64_t instance);
 
+    /// Whether the calls to function are traced, the other calls go straight
+    /// to the next layer.
+    bool isTraced(ur_function_t function) const {
+        return (tracedFunctions[function / 64] >> (function % 64)) & 1;
+    }
+
   private:
     void notify(uint16_t trace_type, uint32_t id, const char *name, void *args,
                 ur_result_t *resultp, uint64_t instance);
     uint8_t call_stream_id;
 
+    /// Finds out whether anything consumes the traces, XPTI subscribers or
+    /// the logger, and reads the UR_TRACING_FUNCTIONS filter.
+    void initTracing();
+    /// Called by init for each function of the API, decides whether its
+    /// calls are traced.
+    void initTracedFunction(ur_function_t function, const char *name);
+
+    bool xptiEnabled = false;
+    bool traceCalls = false;
+    std::optional<std::regex> functionFilter;
+    /// One bit for each function, set for those which are traced.
+    std::vector<uint64_t> tracedFunctions;
+
     inline static const std::string name = "UR_LAYER_TRACING";
 
     std::shared_ptr<XptiContextManager> xptiContextManager;
 };
 
 context_t *getContext();
+
+/// The parameters of a call, formatted when written to a stream, so that the
+/// logger only formats them for the messages it writes.
+struct params_printer_t {
+    ur_function_t function;
+    const void *params;
+};
+
+inline std::ostream &operator<<(std::ostream &os, const params_printer_t &p) {
+    ur::extras::printFunctionParams(os, p.function, p.params);
+    return os;
+}
 } // namespace ur_tracing_layer
 
 #endif /* UR_TRACING_LAYER_H */
@@ -36,20 +36,24 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET)) {
+        return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+    }
+
     ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET,
                                                    "urAdapterGet", &params);
 
-    getContext()->logger.info("---> urAdapterGet");
+    auto &logger = getContext()->logger;
+    logger.info("---> urAdapterGet");
 
     ur_result_t result = pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
 
     getContext()->notify_end(UR_FUNCTION_ADAPTER_GET, "urAdapterGet", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ADAPTER_GET, &params}, result);
 
     return result;
 }
@@ -65,21 +69,24 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RELEASE)) {
+        return pfnAdapterRelease(hAdapter);
+    }
+
     ur_adapter_release_params_t params = {&hAdapter};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RELEASE,
                                                    "urAdapterRelease", &params);
 
-    getContext()->logger.info("---> urAdapterRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urAdapterRelease");
 
     ur_result_t result = pfnAdapterRelease(hAdapter);
 
     getContext()->notify_end(UR_FUNCTION_ADAPTER_RELEASE, "urAdapterRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ADAPTER_RELEASE, &params}, result);
 
     return result;
 }
@@ -95,21 +102,24 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RETAIN)) {
+        return pfnAdapterRetain(hAdapter);
+    }
+
     ur_adapter_retain_params_t params = {&hAdapter};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RETAIN,
                                                    "urAdapterRetain", &params);
 
-    getContext()->logger.info("---> urAdapterRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urAdapterRetain");
 
     ur_result_t result = pfnAdapterRetain(hAdapter);
 
     getContext()->notify_end(UR_FUNCTION_ADAPTER_RETAIN, "urAdapterRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ADAPTER_RETAIN, &params}, result);
 
     return result;
 }
@@ -132,12 +142,17 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_LAST_ERROR)) {
+        return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+    }
+
     ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage,
                                                  &pError};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ADAPTER_GET_LAST_ERROR, "urAdapterGetLastError", &params);
 
-    getContext()->logger.info("---> urAdapterGetLastError");
+    auto &logger = getContext()->logger;
+    logger.info("---> urAdapterGetLastError");
 
     ur_result_t result = pfnAdapterGetLastError(hAdapter, ppMessage, pError);
 
@@ -145,10 +160,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
                              "urAdapterGetLastError", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ADAPTER_GET_LAST_ERROR, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ADAPTER_GET_LAST_ERROR, &params},
+                result);
 
     return result;
 }
@@ -174,12 +188,18 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_INFO)) {
+        return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
+                                 pPropSizeRet);
+    }
+
     ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET_INFO,
                                                    "urAdapterGetInfo", &params);
 
-    getContext()->logger.info("---> urAdapterGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urAdapterGetInfo");
 
     ur_result_t result = pfnAdapterGetInfo(hAdapter, propName, propSize,
                                            pPropValue, pPropSizeRet);
@@ -187,10 +207,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
     getContext()->notify_end(UR_FUNCTION_ADAPTER_GET_INFO, "urAdapterGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ADAPTER_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -219,12 +238,18 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET)) {
+        return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
+                      pNumPlatforms);
+    }
+
     ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
                                        &phPlatforms, &pNumPlatforms};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET,
                                                    "urPlatformGet", &params);
 
-    getContext()->logger.info("---> urPlatformGet");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPlatformGet");
 
     ur_result_t result =
         pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms, pNumPlatforms);
@@ -232,10 +257,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
     getContext()->notify_end(UR_FUNCTION_PLATFORM_GET, "urPlatformGet", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PLATFORM_GET, &params}, result);
 
     return result;
 }
@@ -261,12 +284,18 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_INFO)) {
+        return pfnGetInfo(hPlatform, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo", &params);
 
-    getContext()->logger.info("---> urPlatformGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPlatformGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hPlatform, propName, propSize, pPropValue, pPropSizeRet);
@@ -274,10 +303,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
     getContext()->notify_end(UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PLATFORM_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -294,12 +322,17 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_API_VERSION)) {
+        return pfnGetApiVersion(hPlatform, pVersion);
+    }
+
     ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_API_VERSION,
                                    "urPlatformGetApiVersion", &params);
 
-    getContext()->logger.info("---> urPlatformGetApiVersion");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPlatformGetApiVersion");
 
     ur_result_t result = pfnGetApiVersion(hPlatform, pVersion);
 
@@ -307,10 +340,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
                              "urPlatformGetApiVersion", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PLATFORM_GET_API_VERSION, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PLATFORM_GET_API_VERSION, &params},
+                result);
 
     return result;
 }
@@ -329,13 +361,18 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hPlatform, phNativePlatform);
+    }
+
     ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                      &phNativePlatform};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE,
                                    "urPlatformGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urPlatformGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPlatformGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hPlatform, phNativePlatform);
 
@@ -343,10 +380,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
                              "urPlatformGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -370,13 +407,20 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
+                                         phPlatform);
+    }
+
     ur_platform_create_with_native_handle_params_t params = {
         &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
         "urPlatformCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urPlatformCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPlatformCreateWithNativeHandle");
 
     ur_result_t result = pfnCreateWithNativeHandle(hNativePlatform, hAdapter,
                                                    pProperties, phPlatform);
@@ -385,10 +429,11 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
                              "urPlatformCreateWithNativeHandle", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
+                         &params},
+        result);
 
     return result;
 }
@@ -410,13 +455,19 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION)) {
+        return pfnGetBackendOption(hPlatform, pFrontendOption,
+                                   ppPlatformOption);
+    }
+
     ur_platform_get_backend_option_params_t params = {
         &hPlatform, &pFrontendOption, &ppPlatformOption};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION,
                                    "urPlatformGetBackendOption", &params);
 
-    getContext()->logger.info("---> urPlatformGetBackendOption");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPlatformGetBackendOption");
 
     ur_result_t result =
         pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
@@ -425,10 +476,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
                              "urPlatformGetBackendOption", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, &params},
+        result);
 
     return result;
 }
@@ -456,12 +507,18 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET)) {
+        return pfnGet(hPlatform, DeviceType, NumEntries, phDevices,
+                      pNumDevices);
+    }
+
     ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                      &phDevices, &pNumDevices};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET,
                                                    "urDeviceGet", &params);
 
-    getContext()->logger.info("---> urDeviceGet");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceGet");
 
     ur_result_t result =
         pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
@@ -469,9 +526,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     getContext()->notify_end(UR_FUNCTION_DEVICE_GET, "urDeviceGet", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_GET, &params}, result);
 
     return result;
 }
@@ -498,12 +554,18 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_INFO)) {
+        return pfnGetInfo(hDevice, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_INFO,
                                                    "urDeviceGetInfo", &params);
 
-    getContext()->logger.info("---> urDeviceGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hDevice, propName, propSize, pPropValue, pPropSizeRet);
@@ -511,10 +573,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
     getContext()->notify_end(UR_FUNCTION_DEVICE_GET_INFO, "urDeviceGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_GET_INFO, &params}, result);
 
     return result;
 }
@@ -531,21 +591,24 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RETAIN)) {
+        return pfnRetain(hDevice);
+    }
+
     ur_device_retain_params_t params = {&hDevice};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RETAIN,
                                                    "urDeviceRetain", &params);
 
-    getContext()->logger.info("---> urDeviceRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceRetain");
 
     ur_result_t result = pfnRetain(hDevice);
 
     getContext()->notify_end(UR_FUNCTION_DEVICE_RETAIN, "urDeviceRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_RETAIN, &params}, result);
 
     return result;
 }
@@ -562,21 +625,24 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RELEASE)) {
+        return pfnRelease(hDevice);
+    }
+
     ur_device_release_params_t params = {&hDevice};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RELEASE,
                                                    "urDeviceRelease", &params);
 
-    getContext()->logger.info("---> urDeviceRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceRelease");
 
     ur_result_t result = pfnRelease(hDevice);
 
     getContext()->notify_end(UR_FUNCTION_DEVICE_RELEASE, "urDeviceRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_RELEASE, &params}, result);
 
     return result;
 }
@@ -602,12 +668,18 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_PARTITION)) {
+        return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
+    }
+
     ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                            &phSubDevices, &pNumDevicesRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition", &params);
 
-    getContext()->logger.info("---> urDevicePartition");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDevicePartition");
 
     ur_result_t result = pfnPartition(hDevice, pProperties, NumDevices,
                                       phSubDevices, pNumDevicesRet);
@@ -615,10 +687,9 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
     getContext()->notify_end(UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_PARTITION,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_PARTITION, &params},
+                result);
 
     return result;
 }
@@ -643,12 +714,18 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_SELECT_BINARY)) {
+        return pfnSelectBinary(hDevice, pBinaries, NumBinaries,
+                               pSelectedBinary);
+    }
+
     ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
                                                &NumBinaries, &pSelectedBinary};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_DEVICE_SELECT_BINARY, "urDeviceSelectBinary", &params);
 
-    getContext()->logger.info("---> urDeviceSelectBinary");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceSelectBinary");
 
     ur_result_t result =
         pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
@@ -657,10 +734,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
                              "urDeviceSelectBinary", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_SELECT_BINARY,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_SELECT_BINARY, &params},
+                result);
 
     return result;
 }
@@ -679,12 +755,17 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hDevice, phNativeDevice);
+    }
+
     ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE,
                                    "urDeviceGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urDeviceGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hDevice, phNativeDevice);
 
@@ -692,10 +773,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
                              "urDeviceGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, &params},
+                result);
 
     return result;
 }
@@ -719,13 +799,19 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeDevice, hAdapter, pProperties,
+                                         phDevice);
+    }
+
     ur_device_create_with_native_handle_params_t params = {
         &hNativeDevice, &hAdapter, &pProperties, &phDevice};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
                                    "urDeviceCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urDeviceCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceCreateWithNativeHandle");
 
     ur_result_t result = pfnCreateWithNativeHandle(hNativeDevice, hAdapter,
                                                    pProperties, phDevice);
@@ -734,10 +820,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
                              "urDeviceCreateWithNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -760,13 +846,19 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS)) {
+        return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp,
+                                      pHostTimestamp);
+    }
+
     ur_device_get_global_timestamps_params_t params = {
         &hDevice, &pDeviceTimestamp, &pHostTimestamp};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
                                    "urDeviceGetGlobalTimestamps", &params);
 
-    getContext()->logger.info("---> urDeviceGetGlobalTimestamps");
+    auto &logger = getContext()->logger;
+    logger.info("---> urDeviceGetGlobalTimestamps");
 
     ur_result_t result =
         pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
@@ -775,10 +867,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
                              "urDeviceGetGlobalTimestamps", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, &params},
+        result);
 
     return result;
 }
@@ -800,12 +892,17 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_CREATE)) {
+        return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+    }
+
     ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                          &phContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_CREATE,
                                                    "urContextCreate", &params);
 
-    getContext()->logger.info("---> urContextCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextCreate");
 
     ur_result_t result =
         pfnCreate(DeviceCount, phDevices, pProperties, phContext);
@@ -813,10 +910,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     getContext()->notify_end(UR_FUNCTION_CONTEXT_CREATE, "urContextCreate",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_CONTEXT_CREATE, &params}, result);
 
     return result;
 }
@@ -833,21 +928,24 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RETAIN)) {
+        return pfnRetain(hContext);
+    }
+
     ur_context_retain_params_t params = {&hContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RETAIN,
                                                    "urContextRetain", &params);
 
-    getContext()->logger.info("---> urContextRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextRetain");
 
     ur_result_t result = pfnRetain(hContext);
 
     getContext()->notify_end(UR_FUNCTION_CONTEXT_RETAIN, "urContextRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_CONTEXT_RETAIN, &params}, result);
 
     return result;
 }
@@ -864,21 +962,24 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RELEASE)) {
+        return pfnRelease(hContext);
+    }
+
     ur_context_release_params_t params = {&hContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RELEASE,
                                                    "urContextRelease", &params);
 
-    getContext()->logger.info("---> urContextRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextRelease");
 
     ur_result_t result = pfnRelease(hContext);
 
     getContext()->notify_end(UR_FUNCTION_CONTEXT_RELEASE, "urContextRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_CONTEXT_RELEASE, &params}, result);
 
     return result;
 }
@@ -906,12 +1007,18 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_INFO)) {
+        return pfnGetInfo(hContext, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_INFO,
                                                    "urContextGetInfo", &params);
 
-    getContext()->logger.info("---> urContextGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
@@ -919,10 +1026,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
     getContext()->notify_end(UR_FUNCTION_CONTEXT_GET_INFO, "urContextGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_CONTEXT_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -941,13 +1047,18 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hContext, phNativeContext);
+    }
+
     ur_context_get_native_handle_params_t params = {&hContext,
                                                     &phNativeContext};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE,
                                    "urContextGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urContextGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hContext, phNativeContext);
 
@@ -955,10 +1066,10 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
                              "urContextGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -986,6 +1097,12 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
+                                         phDevices, pProperties, phContext);
+    }
+
     ur_context_create_with_native_handle_params_t params = {
         &hNativeContext, &hAdapter,    &numDevices,
         &phDevices,      &pProperties, &phContext};
@@ -993,7 +1110,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
         "urContextCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urContextCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextCreateWithNativeHandle");
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
@@ -1003,10 +1121,11 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
                              "urContextCreateWithNativeHandle", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
+                         &params},
+        result);
 
     return result;
 }
@@ -1027,13 +1146,18 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER)) {
+        return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+    }
+
     ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                        &pUserData};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
                                    "urContextSetExtendedDeleter", &params);
 
-    getContext()->logger.info("---> urContextSetExtendedDeleter");
+    auto &logger = getContext()->logger;
+    logger.info("---> urContextSetExtendedDeleter");
 
     ur_result_t result = pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
 
@@ -1041,10 +1165,10 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
                              "urContextSetExtendedDeleter", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, &params},
+        result);
 
     return result;
 }
@@ -1066,12 +1190,18 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_CREATE)) {
+        return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
+                              phMem);
+    }
+
     ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                            &pImageDesc, &pHost, &phMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_IMAGE_CREATE,
                                                    "urMemImageCreate", &params);
 
-    getContext()->logger.info("---> urMemImageCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemImageCreate");
 
     ur_result_t result =
         pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost, phMem);
@@ -1079,10 +1209,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     getContext()->notify_end(UR_FUNCTION_MEM_IMAGE_CREATE, "urMemImageCreate",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_IMAGE_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_IMAGE_CREATE, &params},
+                result);
 
     return result;
 }
@@ -1104,12 +1233,17 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_CREATE)) {
+        return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+    }
+
     ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                             &pProperties, &phBuffer};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate", &params);
 
-    getContext()->logger.info("---> urMemBufferCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemBufferCreate");
 
     ur_result_t result =
         pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
@@ -1117,10 +1251,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     getContext()->notify_end(UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_BUFFER_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_BUFFER_CREATE, &params},
+                result);
 
     return result;
 }
@@ -1137,20 +1270,24 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RETAIN)) {
+        return pfnRetain(hMem);
+    }
+
     ur_mem_retain_params_t params = {&hMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RETAIN,
                                                    "urMemRetain", &params);
 
-    getContext()->logger.info("---> urMemRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemRetain");
 
     ur_result_t result = pfnRetain(hMem);
 
     getContext()->notify_end(UR_FUNCTION_MEM_RETAIN, "urMemRetain", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RETAIN, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_RETAIN, &params}, result);
 
     return result;
 }
@@ -1167,20 +1304,24 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RELEASE)) {
+        return pfnRelease(hMem);
+    }
+
     ur_mem_release_params_t params = {&hMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RELEASE,
                                                    "urMemRelease", &params);
 
-    getContext()->logger.info("---> urMemRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemRelease");
 
     ur_result_t result = pfnRelease(hMem);
 
     getContext()->notify_end(UR_FUNCTION_MEM_RELEASE, "urMemRelease", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RELEASE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_RELEASE, &params}, result);
 
     return result;
 }
@@ -1203,12 +1344,18 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_PARTITION)) {
+        return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion,
+                                  phMem);
+    }
+
     ur_mem_buffer_partition_params_t params = {
         &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_BUFFER_PARTITION, "urMemBufferPartition", &params);
 
-    getContext()->logger.info("---> urMemBufferPartition");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemBufferPartition");
 
     ur_result_t result =
         pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
@@ -1217,10 +1364,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
                              "urMemBufferPartition", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_BUFFER_PARTITION,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_BUFFER_PARTITION, &params},
+                result);
 
     return result;
 }
@@ -1241,11 +1387,16 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+    }
+
     ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urMemGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hMem, hDevice, phNativeMem);
 
@@ -1253,10 +1404,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
                              "urMemGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_GET_NATIVE_HANDLE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_GET_NATIVE_HANDLE, &params},
+                result);
 
     return result;
 }
@@ -1279,13 +1429,20 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
+                                               pProperties, phMem);
+    }
+
     ur_mem_buffer_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext, &pProperties, &phMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
         "urMemBufferCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urMemBufferCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemBufferCreateWithNativeHandle");
 
     ur_result_t result = pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
                                                          pProperties, phMem);
@@ -1294,10 +1451,11 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
                              "urMemBufferCreateWithNativeHandle", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
+                         &params},
+        result);
 
     return result;
 }
@@ -1323,6 +1481,13 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnImageCreateWithNativeHandle(hNativeMem, hContext,
+                                              pImageFormat, pImageDesc,
+                                              pProperties, phMem);
+    }
+
     ur_mem_image_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext,    &pImageFormat,
         &pImageDesc, &pProperties, &phMem};
@@ -1330,7 +1495,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
         "urMemImageCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urMemImageCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemImageCreateWithNativeHandle");
 
     ur_result_t result = pfnImageCreateWithNativeHandle(
         hNativeMem, hContext, pImageFormat, pImageDesc, pProperties, phMem);
@@ -1339,10 +1505,11 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
                              "urMemImageCreateWithNativeHandle", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
+                         &params},
+        result);
 
     return result;
 }
@@ -1370,12 +1537,18 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_INFO)) {
+        return pfnGetInfo(hMemory, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_GET_INFO,
                                                    "urMemGetInfo", &params);
 
-    getContext()->logger.info("---> urMemGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
@@ -1383,10 +1556,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
     getContext()->notify_end(UR_FUNCTION_MEM_GET_INFO, "urMemGetInfo", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_GET_INFO, &params}, result);
 
     return result;
 }
@@ -1413,12 +1584,18 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_GET_INFO)) {
+        return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                              &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo", &params);
 
-    getContext()->logger.info("---> urMemImageGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urMemImageGetInfo");
 
     ur_result_t result =
         pfnImageGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
@@ -1426,10 +1603,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
     getContext()->notify_end(UR_FUNCTION_MEM_IMAGE_GET_INFO,
                              "urMemImageGetInfo", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_IMAGE_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_MEM_IMAGE_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -1448,21 +1624,24 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_CREATE)) {
+        return pfnCreate(hContext, pDesc, phSampler);
+    }
+
     ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_CREATE,
                                                    "urSamplerCreate", &params);
 
-    getContext()->logger.info("---> urSamplerCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urSamplerCreate");
 
     ur_result_t result = pfnCreate(hContext, pDesc, phSampler);
 
     getContext()->notify_end(UR_FUNCTION_SAMPLER_CREATE, "urSamplerCreate",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_SAMPLER_CREATE, &params}, result);
 
     return result;
 }
@@ -1479,21 +1658,24 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RETAIN)) {
+        return pfnRetain(hSampler);
+    }
+
     ur_sampler_retain_params_t params = {&hSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RETAIN,
                                                    "urSamplerRetain", &params);
 
-    getContext()->logger.info("---> urSamplerRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urSamplerRetain");
 
     ur_result_t result = pfnRetain(hSampler);
 
     getContext()->notify_end(UR_FUNCTION_SAMPLER_RETAIN, "urSamplerRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_SAMPLER_RETAIN, &params}, result);
 
     return result;
 }
@@ -1510,21 +1692,24 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RELEASE)) {
+        return pfnRelease(hSampler);
+    }
+
     ur_sampler_release_params_t params = {&hSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RELEASE,
                                                    "urSamplerRelease", &params);
 
-    getContext()->logger.info("---> urSamplerRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urSamplerRelease");
 
     ur_result_t result = pfnRelease(hSampler);
 
     getContext()->notify_end(UR_FUNCTION_SAMPLER_RELEASE, "urSamplerRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_SAMPLER_RELEASE, &params}, result);
 
     return result;
 }
@@ -1548,12 +1733,18 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_INFO)) {
+        return pfnGetInfo(hSampler, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_INFO,
                                                    "urSamplerGetInfo", &params);
 
-    getContext()->logger.info("---> urSamplerGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urSamplerGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
@@ -1561,10 +1752,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
     getContext()->notify_end(UR_FUNCTION_SAMPLER_GET_INFO, "urSamplerGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_SAMPLER_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -1583,13 +1773,18 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hSampler, phNativeSampler);
+    }
+
     ur_sampler_get_native_handle_params_t params = {&hSampler,
                                                     &phNativeSampler};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE,
                                    "urSamplerGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urSamplerGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urSamplerGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hSampler, phNativeSampler);
 
@@ -1597,10 +1792,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
                              "urSamplerGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -1623,13 +1818,20 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
+                                         phSampler);
+    }
+
     ur_sampler_create_with_native_handle_params_t params = {
         &hNativeSampler, &hContext, &pProperties, &phSampler};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
         "urSamplerCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urSamplerCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urSamplerCreateWithNativeHandle");
 
     ur_result_t result = pfnCreateWithNativeHandle(hNativeSampler, hContext,
                                                    pProperties, phSampler);
@@ -1638,10 +1840,11 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
                              "urSamplerCreateWithNativeHandle", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
+                         &params},
+        result);
 
     return result;
 }
@@ -1664,22 +1867,25 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_HOST_ALLOC)) {
+        return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                          &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_HOST_ALLOC,
                                                    "urUSMHostAlloc", &params);
 
-    getContext()->logger.info("---> urUSMHostAlloc");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMHostAlloc");
 
     ur_result_t result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
 
     getContext()->notify_end(UR_FUNCTION_USM_HOST_ALLOC, "urUSMHostAlloc",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_HOST_ALLOC,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_HOST_ALLOC, &params}, result);
 
     return result;
 }
@@ -1703,12 +1909,17 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_DEVICE_ALLOC)) {
+        return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_DEVICE_ALLOC,
                                                    "urUSMDeviceAlloc", &params);
 
-    getContext()->logger.info("---> urUSMDeviceAlloc");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMDeviceAlloc");
 
     ur_result_t result =
         pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
@@ -1716,10 +1927,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     getContext()->notify_end(UR_FUNCTION_USM_DEVICE_ALLOC, "urUSMDeviceAlloc",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_DEVICE_ALLOC,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_DEVICE_ALLOC, &params},
+                result);
 
     return result;
 }
@@ -1743,12 +1953,17 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_SHARED_ALLOC)) {
+        return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_SHARED_ALLOC,
                                                    "urUSMSharedAlloc", &params);
 
-    getContext()->logger.info("---> urUSMSharedAlloc");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMSharedAlloc");
 
     ur_result_t result =
         pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
@@ -1756,10 +1971,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     getContext()->notify_end(UR_FUNCTION_USM_SHARED_ALLOC, "urUSMSharedAlloc",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_SHARED_ALLOC,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_SHARED_ALLOC, &params},
+                result);
 
     return result;
 }
@@ -1776,20 +1990,24 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_FREE)) {
+        return pfnFree(hContext, pMem);
+    }
+
     ur_usm_free_params_t params = {&hContext, &pMem};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_USM_FREE, "urUSMFree", &params);
 
-    getContext()->logger.info("---> urUSMFree");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMFree");
 
     ur_result_t result = pfnFree(hContext, pMem);
 
     getContext()->notify_end(UR_FUNCTION_USM_FREE, "urUSMFree", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_FREE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_FREE, &params}, result);
 
     return result;
 }
@@ -1815,12 +2033,18 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO)) {
+        return pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_usm_get_mem_alloc_info_params_t params = {
         &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, "urUSMGetMemAllocInfo", &params);
 
-    getContext()->logger.info("---> urUSMGetMemAllocInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMGetMemAllocInfo");
 
     ur_result_t result = pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
                                             pPropValue, pPropSizeRet);
@@ -1829,10 +2053,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
                              "urUSMGetMemAllocInfo", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, &params},
+                result);
 
     return result;
 }
@@ -1852,21 +2075,24 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_CREATE)) {
+        return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+    }
+
     ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_CREATE,
                                                    "urUSMPoolCreate", &params);
 
-    getContext()->logger.info("---> urUSMPoolCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMPoolCreate");
 
     ur_result_t result = pfnPoolCreate(hContext, pPoolDesc, ppPool);
 
     getContext()->notify_end(UR_FUNCTION_USM_POOL_CREATE, "urUSMPoolCreate",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_POOL_CREATE, &params}, result);
 
     return result;
 }
@@ -1882,21 +2108,24 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RETAIN)) {
+        return pfnPoolRetain(pPool);
+    }
+
     ur_usm_pool_retain_params_t params = {&pPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RETAIN,
                                                    "urUSMPoolRetain", &params);
 
-    getContext()->logger.info("---> urUSMPoolRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMPoolRetain");
 
     ur_result_t result = pfnPoolRetain(pPool);
 
     getContext()->notify_end(UR_FUNCTION_USM_POOL_RETAIN, "urUSMPoolRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_POOL_RETAIN, &params}, result);
 
     return result;
 }
@@ -1912,21 +2141,25 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RELEASE)) {
+        return pfnPoolRelease(pPool);
+    }
+
     ur_usm_pool_release_params_t params = {&pPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RELEASE,
                                                    "urUSMPoolRelease", &params);
 
-    getContext()->logger.info("---> urUSMPoolRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMPoolRelease");
 
     ur_result_t result = pfnPoolRelease(pPool);
 
     getContext()->notify_end(UR_FUNCTION_USM_POOL_RELEASE, "urUSMPoolRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_POOL_RELEASE, &params},
+                result);
 
     return result;
 }
@@ -1949,12 +2182,18 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_GET_INFO)) {
+        return pfnPoolGetInfo(hPool, propName, propSize, pPropValue,
+                              pPropSizeRet);
+    }
+
     ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo", &params);
 
-    getContext()->logger.info("---> urUSMPoolGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMPoolGetInfo");
 
     ur_result_t result =
         pfnPoolGetInfo(hPool, propName, propSize, pPropValue, pPropSizeRet);
@@ -1962,10 +2201,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
     getContext()->notify_end(UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_POOL_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -1996,13 +2234,19 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO)) {
+        return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
+                                     pPropValue, pPropSizeRet);
+    }
+
     ur_virtual_mem_granularity_get_info_params_t params = {
         &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
                                    "urVirtualMemGranularityGetInfo", &params);
 
-    getContext()->logger.info("---> urVirtualMemGranularityGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemGranularityGetInfo");
 
     ur_result_t result = pfnGranularityGetInfo(
         hContext, hDevice, propName, propSize, pPropValue, pPropSizeRet);
@@ -2011,10 +2255,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
                              "urVirtualMemGranularityGetInfo", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO, &params},
+        result);
 
     return result;
 }
@@ -2039,22 +2283,26 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_RESERVE)) {
+        return pfnReserve(hContext, pStart, size, ppStart);
+    }
+
     ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
                                               &ppStart};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve", &params);
 
-    getContext()->logger.info("---> urVirtualMemReserve");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemReserve");
 
     ur_result_t result = pfnReserve(hContext, pStart, size, ppStart);
 
     getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_RESERVE,
                              "urVirtualMemReserve", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_RESERVE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_VIRTUAL_MEM_RESERVE, &params},
+                result);
 
     return result;
 }
@@ -2073,21 +2321,25 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_FREE)) {
+        return pfnFree(hContext, pStart, size);
+    }
+
     ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_FREE,
                                                    "urVirtualMemFree", &params);
 
-    getContext()->logger.info("---> urVirtualMemFree");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemFree");
 
     ur_result_t result = pfnFree(hContext, pStart, size);
 
     getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_FREE, "urVirtualMemFree",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_FREE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_VIRTUAL_MEM_FREE, &params},
+                result);
 
     return result;
 }
@@ -2112,12 +2364,17 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_MAP)) {
+        return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+    }
+
     ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
                                           &hPhysicalMem, &offset, &flags};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_MAP,
                                                    "urVirtualMemMap", &params);
 
-    getContext()->logger.info("---> urVirtualMemMap");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemMap");
 
     ur_result_t result =
         pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
@@ -2125,10 +2382,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
     getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_MAP, "urVirtualMemMap",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_MAP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_VIRTUAL_MEM_MAP, &params}, result);
 
     return result;
 }
@@ -2147,21 +2402,25 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_UNMAP)) {
+        return pfnUnmap(hContext, pStart, size);
+    }
+
     ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap", &params);
 
-    getContext()->logger.info("---> urVirtualMemUnmap");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemUnmap");
 
     ur_result_t result = pfnUnmap(hContext, pStart, size);
 
     getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_UNMAP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_VIRTUAL_MEM_UNMAP, &params},
+                result);
 
     return result;
 }
@@ -2182,12 +2441,17 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS)) {
+        return pfnSetAccess(hContext, pStart, size, flags);
+    }
+
     ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
                                                  &flags};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, "urVirtualMemSetAccess", &params);
 
-    getContext()->logger.info("---> urVirtualMemSetAccess");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemSetAccess");
 
     ur_result_t result = pfnSetAccess(hContext, pStart, size, flags);
 
@@ -2195,10 +2459,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
                              "urVirtualMemSetAccess", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, &params},
+                result);
 
     return result;
 }
@@ -2227,13 +2490,19 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_GET_INFO)) {
+        return pfnGetInfo(hContext, pStart, size, propName, propSize,
+                          pPropValue, pPropSizeRet);
+    }
+
     ur_virtual_mem_get_info_params_t params = {
         &hContext, &pStart,     &size,        &propName,
         &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo", &params);
 
-    getContext()->logger.info("---> urVirtualMemGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urVirtualMemGetInfo");
 
     ur_result_t result = pfnGetInfo(hContext, pStart, size, propName, propSize,
                                     pPropValue, pPropSizeRet);
@@ -2241,10 +2510,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
     getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_GET_INFO,
                              "urVirtualMemGetInfo", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_VIRTUAL_MEM_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -2268,12 +2536,17 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_CREATE)) {
+        return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+    }
+
     ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
                                               &pProperties, &phPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate", &params);
 
-    getContext()->logger.info("---> urPhysicalMemCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPhysicalMemCreate");
 
     ur_result_t result =
         pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
@@ -2281,10 +2554,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
     getContext()->notify_end(UR_FUNCTION_PHYSICAL_MEM_CREATE,
                              "urPhysicalMemCreate", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PHYSICAL_MEM_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PHYSICAL_MEM_CREATE, &params},
+                result);
 
     return result;
 }
@@ -2301,21 +2573,25 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RETAIN)) {
+        return pfnRetain(hPhysicalMem);
+    }
+
     ur_physical_mem_retain_params_t params = {&hPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain", &params);
 
-    getContext()->logger.info("---> urPhysicalMemRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPhysicalMemRetain");
 
     ur_result_t result = pfnRetain(hPhysicalMem);
 
     getContext()->notify_end(UR_FUNCTION_PHYSICAL_MEM_RETAIN,
                              "urPhysicalMemRetain", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PHYSICAL_MEM_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PHYSICAL_MEM_RETAIN, &params},
+                result);
 
     return result;
 }
@@ -2332,11 +2608,16 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RELEASE)) {
+        return pfnRelease(hPhysicalMem);
+    }
+
     ur_physical_mem_release_params_t params = {&hPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease", &params);
 
-    getContext()->logger.info("---> urPhysicalMemRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urPhysicalMemRelease");
 
     ur_result_t result = pfnRelease(hPhysicalMem);
 
@@ -2344,10 +2625,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
                              "urPhysicalMemRelease", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PHYSICAL_MEM_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PHYSICAL_MEM_RELEASE, &params},
+                result);
 
     return result;
 }
@@ -2369,12 +2649,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_IL)) {
+        return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+    }
+
     ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                  &pProperties, &phProgram};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_CREATE_WITH_IL, "urProgramCreateWithIL", &params);
 
-    getContext()->logger.info("---> urProgramCreateWithIL");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramCreateWithIL");
 
     ur_result_t result =
         pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
@@ -2383,10 +2668,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
                              "urProgramCreateWithIL", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_IL, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_CREATE_WITH_IL, &params},
+                result);
 
     return result;
 }
@@ -2411,13 +2695,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY)) {
+        return pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                   pProperties, phProgram);
+    }
+
     ur_program_create_with_binary_params_t params = {
         &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY,
                                    "urProgramCreateWithBinary", &params);
 
-    getContext()->logger.info("---> urProgramCreateWithBinary");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramCreateWithBinary");
 
     ur_result_t result = pfnCreateWithBinary(hContext, hDevice, size, pBinary,
                                              pProperties, phProgram);
@@ -2426,10 +2716,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
                              "urProgramCreateWithBinary", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, &params},
+        result);
 
     return result;
 }
@@ -2448,21 +2738,24 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD)) {
+        return pfnBuild(hContext, hProgram, pOptions);
+    }
+
     ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD,
                                                    "urProgramBuild", &params);
 
-    getContext()->logger.info("---> urProgramBuild");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramBuild");
 
     ur_result_t result = pfnBuild(hContext, hProgram, pOptions);
 
     getContext()->notify_end(UR_FUNCTION_PROGRAM_BUILD, "urProgramBuild",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_BUILD, &params}, result);
 
     return result;
 }
@@ -2482,21 +2775,24 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE)) {
+        return pfnCompile(hContext, hProgram, pOptions);
+    }
+
     ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_COMPILE,
                                                    "urProgramCompile", &params);
 
-    getContext()->logger.info("---> urProgramCompile");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramCompile");
 
     ur_result_t result = pfnCompile(hContext, hProgram, pOptions);
 
     getContext()->notify_end(UR_FUNCTION_PROGRAM_COMPILE, "urProgramCompile",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_COMPILE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_COMPILE, &params}, result);
 
     return result;
 }
@@ -2522,12 +2818,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK)) {
+        return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+    }
+
     ur_program_link_params_t params = {&hContext, &count, &phPrograms,
                                        &pOptions, &phProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK,
                                                    "urProgramLink", &params);
 
-    getContext()->logger.info("---> urProgramLink");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramLink");
 
     ur_result_t result =
         pfnLink(hContext, count, phPrograms, pOptions, phProgram);
@@ -2535,10 +2836,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     getContext()->notify_end(UR_FUNCTION_PROGRAM_LINK, "urProgramLink", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_LINK, &params}, result);
 
     return result;
 }
@@ -2555,21 +2854,24 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RETAIN)) {
+        return pfnRetain(hProgram);
+    }
+
     ur_program_retain_params_t params = {&hProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RETAIN,
                                                    "urProgramRetain", &params);
 
-    getContext()->logger.info("---> urProgramRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramRetain");
 
     ur_result_t result = pfnRetain(hProgram);
 
     getContext()->notify_end(UR_FUNCTION_PROGRAM_RETAIN, "urProgramRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_RETAIN, &params}, result);
 
     return result;
 }
@@ -2586,21 +2888,24 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RELEASE)) {
+        return pfnRelease(hProgram);
+    }
+
     ur_program_release_params_t params = {&hProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RELEASE,
                                                    "urProgramRelease", &params);
 
-    getContext()->logger.info("---> urProgramRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramRelease");
 
     ur_result_t result = pfnRelease(hProgram);
 
     getContext()->notify_end(UR_FUNCTION_PROGRAM_RELEASE, "urProgramRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_RELEASE, &params}, result);
 
     return result;
 }
@@ -2626,13 +2931,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER)) {
+        return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                     ppFunctionPointer);
+    }
+
     ur_program_get_function_pointer_params_t params = {
         &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
                                    "urProgramGetFunctionPointer", &params);
 
-    getContext()->logger.info("---> urProgramGetFunctionPointer");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramGetFunctionPointer");
 
     ur_result_t result = pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
                                                ppFunctionPointer);
@@ -2641,10 +2952,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
                              "urProgramGetFunctionPointer", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, &params},
+        result);
 
     return result;
 }
@@ -2671,6 +2982,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER)) {
+        return pfnGetGlobalVariablePointer(hDevice, hProgram,
+                                           pGlobalVariableName,
+                                           pGlobalVariableSizeRet,
+                                           ppGlobalVariablePointerRet);
+    }
+
     ur_program_get_global_variable_pointer_params_t params = {
         &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
         &ppGlobalVariablePointerRet};
@@ -2678,7 +2997,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
         "urProgramGetGlobalVariablePointer", &params);
 
-    getContext()->logger.info("---> urProgramGetGlobalVariablePointer");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramGetGlobalVariablePointer");
 
     ur_result_t result = pfnGetGlobalVariablePointer(
         hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
@@ -2688,10 +3008,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
                              "urProgramGetGlobalVariablePointer", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
+                         &params},
+        result);
 
     return result;
 }
@@ -2718,12 +3039,18 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_INFO)) {
+        return pfnGetInfo(hProgram, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_INFO,
                                                    "urProgramGetInfo", &params);
 
-    getContext()->logger.info("---> urProgramGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
@@ -2731,10 +3058,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
     getContext()->notify_end(UR_FUNCTION_PROGRAM_GET_INFO, "urProgramGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_GET_INFO, &params},
+                result);
 
     return result;
 }
@@ -2763,12 +3089,18 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_BUILD_INFO)) {
+        return pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                               pPropValue, pPropSizeRet);
+    }
+
     ur_program_get_build_info_params_t params = {
         &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_GET_BUILD_INFO, "urProgramGetBuildInfo", &params);
 
-    getContext()->logger.info("---> urProgramGetBuildInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramGetBuildInfo");
 
     ur_result_t result = pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
                                          pPropValue, pPropSizeRet);
@@ -2777,10 +3109,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
                              "urProgramGetBuildInfo", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_GET_BUILD_INFO, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_GET_BUILD_INFO, &params},
+                result);
 
     return result;
 }
@@ -2801,13 +3132,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+    }
+
     ur_program_set_specialization_constants_params_t params = {
         &hProgram, &count, &pSpecConstants};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
         "urProgramSetSpecializationConstants", &params);
 
-    getContext()->logger.info("---> urProgramSetSpecializationConstants");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramSetSpecializationConstants");
 
     ur_result_t result =
         pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
@@ -2816,10 +3153,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
                              "urProgramSetSpecializationConstants", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
+                         &params},
+        result);
 
     return result;
 }
@@ -2838,13 +3176,18 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hProgram, phNativeProgram);
+    }
+
     ur_program_get_native_handle_params_t params = {&hProgram,
                                                     &phNativeProgram};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE,
                                    "urProgramGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urProgramGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hProgram, phNativeProgram);
 
@@ -2852,10 +3195,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
                              "urProgramGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -2878,13 +3221,20 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
+                                         phProgram);
+    }
+
     ur_program_create_with_native_handle_params_t params = {
         &hNativeProgram, &hContext, &pProperties, &phProgram};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
         "urProgramCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urProgramCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramCreateWithNativeHandle");
 
     ur_result_t result = pfnCreateWithNativeHandle(hNativeProgram, hContext,
                                                    pProperties, phProgram);
@@ -2893,10 +3243,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
                              "urProgramCreateWithNativeHandle", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
+                         &params},
+        result);
 
     return result;
 }
@@ -2915,21 +3266,24 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_CREATE)) {
+        return pfnCreate(hProgram, pKernelName, phKernel);
+    }
+
     ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE,
                                                    "urKernelCreate", &params);
 
-    getContext()->logger.info("---> urKernelCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelCreate");
 
     ur_result_t result = pfnCreate(hProgram, pKernelName, phKernel);
 
     getContext()->notify_end(UR_FUNCTION_KERNEL_CREATE, "urKernelCreate",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_CREATE, &params}, result);
 
     return result;
 }
@@ -2952,12 +3306,18 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_VALUE)) {
+        return pfnSetArgValue(hKernel, argIndex, argSize, pProperties,
+                              pArgValue);
+    }
+
     ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties, &pArgValue};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue", &params);
 
-    getContext()->logger.info("---> urKernelSetArgValue");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetArgValue");
 
     ur_result_t result =
         pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
@@ -2965,10 +3325,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_VALUE,
                              "urKernelSetArgValue", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_SET_ARG_VALUE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_SET_ARG_VALUE, &params},
+                result);
 
     return result;
 }
@@ -2989,12 +3348,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_LOCAL)) {
+        return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+    }
+
     ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal", &params);
 
-    getContext()->logger.info("---> urKernelSetArgLocal");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetArgLocal");
 
     ur_result_t result =
         pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
@@ -3002,10 +3366,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_LOCAL,
                              "urKernelSetArgLocal", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_SET_ARG_LOCAL,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_SET_ARG_LOCAL, &params},
+                result);
 
     return result;
 }
@@ -3033,12 +3396,18 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_INFO)) {
+        return pfnGetInfo(hKernel, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_INFO,
                                                    "urKernelGetInfo", &params);
 
-    getContext()->logger.info("---> urKernelGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
@@ -3046,10 +3415,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
     getContext()->notify_end(UR_FUNCTION_KERNEL_GET_INFO, "urKernelGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_GET_INFO, &params}, result);
 
     return result;
 }
@@ -3075,12 +3442,18 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_GROUP_INFO)) {
+        return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_kernel_get_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_GET_GROUP_INFO, "urKernelGetGroupInfo", &params);
 
-    getContext()->logger.info("---> urKernelGetGroupInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelGetGroupInfo");
 
     ur_result_t result = pfnGetGroupInfo(hKernel, hDevice, propName, propSize,
                                          pPropValue, pPropSizeRet);
@@ -3089,10 +3462,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
                              "urKernelGetGroupInfo", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_GET_GROUP_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_GET_GROUP_INFO, &params},
+                result);
 
     return result;
 }
@@ -3119,13 +3491,19 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO)) {
+        return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_kernel_get_sub_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO,
                                    "urKernelGetSubGroupInfo", &params);
 
-    getContext()->logger.info("---> urKernelGetSubGroupInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelGetSubGroupInfo");
 
     ur_result_t result = pfnGetSubGroupInfo(hKernel, hDevice, propName,
                                             propSize, pPropValue, pPropSizeRet);
@@ -3134,10 +3512,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
                              "urKernelGetSubGroupInfo", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, &params},
+        result);
 
     return result;
 }
@@ -3153,21 +3531,24 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RETAIN)) {
+        return pfnRetain(hKernel);
+    }
+
     ur_kernel_retain_params_t params = {&hKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RETAIN,
                                                    "urKernelRetain", &params);
 
-    getContext()->logger.info("---> urKernelRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelRetain");
 
     ur_result_t result = pfnRetain(hKernel);
 
     getContext()->notify_end(UR_FUNCTION_KERNEL_RETAIN, "urKernelRetain",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_RETAIN, &params}, result);
 
     return result;
 }
@@ -3184,21 +3565,24 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RELEASE)) {
+        return pfnRelease(hKernel);
+    }
+
     ur_kernel_release_params_t params = {&hKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RELEASE,
                                                    "urKernelRelease", &params);
 
-    getContext()->logger.info("---> urKernelRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelRelease");
 
     ur_result_t result = pfnRelease(hKernel);
 
     getContext()->notify_end(UR_FUNCTION_KERNEL_RELEASE, "urKernelRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_RELEASE, &params}, result);
 
     return result;
 }
@@ -3220,12 +3604,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_POINTER)) {
+        return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+    }
+
     ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &pArgValue};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_ARG_POINTER, "urKernelSetArgPointer", &params);
 
-    getContext()->logger.info("---> urKernelSetArgPointer");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetArgPointer");
 
     ur_result_t result =
         pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
@@ -3234,10 +3623,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
                              "urKernelSetArgPointer", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_SET_ARG_POINTER, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_SET_ARG_POINTER, &params},
+                result);
 
     return result;
 }
@@ -3260,12 +3648,18 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_EXEC_INFO)) {
+        return pfnSetExecInfo(hKernel, propName, propSize, pProperties,
+                              pPropValue);
+    }
+
     ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                                &pProperties, &pPropValue};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo", &params);
 
-    getContext()->logger.info("---> urKernelSetExecInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetExecInfo");
 
     ur_result_t result =
         pfnSetExecInfo(hKernel, propName, propSize, pProperties, pPropValue);
@@ -3273,10 +3667,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     getContext()->notify_end(UR_FUNCTION_KERNEL_SET_EXEC_INFO,
                              "urKernelSetExecInfo", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_SET_EXEC_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_SET_EXEC_INFO, &params},
+                result);
 
     return result;
 }
@@ -3296,12 +3689,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER)) {
+        return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+    }
+
     ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, "urKernelSetArgSampler", &params);
 
-    getContext()->logger.info("---> urKernelSetArgSampler");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetArgSampler");
 
     ur_result_t result =
         pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
@@ -3310,10 +3708,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
                              "urKernelSetArgSampler", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, &params},
+                result);
 
     return result;
 }
@@ -3333,12 +3730,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ)) {
+        return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+    }
+
     ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, "urKernelSetArgMemObj", &params);
 
-    getContext()->logger.info("---> urKernelSetArgMemObj");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetArgMemObj");
 
     ur_result_t result =
         pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
@@ -3347,10 +3749,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
                              "urKernelSetArgMemObj", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, &params},
+                result);
 
     return result;
 }
@@ -3370,13 +3771,19 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+    }
+
     ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                               &pSpecConstants};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
         "urKernelSetSpecializationConstants", &params);
 
-    getContext()->logger.info("---> urKernelSetSpecializationConstants");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSetSpecializationConstants");
 
     ur_result_t result =
         pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
@@ -3385,10 +3792,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
                              "urKernelSetSpecializationConstants", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
+                         &params},
+        result);
 
     return result;
 }
@@ -3407,12 +3815,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hKernel, phNativeKernel);
+    }
+
     ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE,
                                    "urKernelGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urKernelGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hKernel, phNativeKernel);
 
@@ -3420,10 +3833,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
                              "urKernelGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, &params},
+                result);
 
     return result;
 }
@@ -3448,13 +3860,19 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
+                                         pProperties, phKernel);
+    }
+
     ur_kernel_create_with_native_handle_params_t params = {
         &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
                                    "urKernelCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urKernelCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelCreateWithNativeHandle");
 
     ur_result_t result = pfnCreateWithNativeHandle(
         hNativeKernel, hContext, hProgram, pProperties, phKernel);
@@ -3463,10 +3881,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
                              "urKernelCreateWithNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -3497,6 +3915,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE)) {
+        return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
+                                            pGlobalWorkOffset, pGlobalWorkSize,
+                                            pSuggestedLocalWorkSize);
+    }
+
     ur_kernel_get_suggested_local_work_size_params_t params = {
         &hKernel,           &hQueue,          &numWorkDim,
         &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
@@ -3504,7 +3929,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
         "urKernelGetSuggestedLocalWorkSize", &params);
 
-    getContext()->logger.info("---> urKernelGetSuggestedLocalWorkSize");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelGetSuggestedLocalWorkSize");
 
     ur_result_t result = pfnGetSuggestedLocalWorkSize(
         hKernel, hQueue, numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
@@ -3514,10 +3940,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
                              "urKernelGetSuggestedLocalWorkSize", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
+                         &params},
+        result);
 
     return result;
 }
@@ -3541,12 +3968,17 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_INFO)) {
+        return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_GET_INFO,
                                                    "urQueueGetInfo", &params);
 
-    getContext()->logger.info("---> urQueueGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
@@ -3554,10 +3986,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
     getContext()->notify_end(UR_FUNCTION_QUEUE_GET_INFO, "urQueueGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_GET_INFO, &params}, result);
 
     return result;
 }
@@ -3578,22 +4008,25 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE)) {
+        return pfnCreate(hContext, hDevice, pProperties, phQueue);
+    }
+
     ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                        &phQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE,
                                                    "urQueueCreate", &params);
 
-    getContext()->logger.info("---> urQueueCreate");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueCreate");
 
     ur_result_t result = pfnCreate(hContext, hDevice, pProperties, phQueue);
 
     getContext()->notify_end(UR_FUNCTION_QUEUE_CREATE, "urQueueCreate", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_CREATE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_CREATE, &params}, result);
 
     return result;
 }
@@ -3610,21 +4043,24 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RETAIN)) {
+        return pfnRetain(hQueue);
+    }
+
     ur_queue_retain_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RETAIN,
                                                    "urQueueRetain", &params);
 
-    getContext()->logger.info("---> urQueueRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueRetain");
 
     ur_result_t result = pfnRetain(hQueue);
 
     getContext()->notify_end(UR_FUNCTION_QUEUE_RETAIN, "urQueueRetain", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_RETAIN, &params}, result);
 
     return result;
 }
@@ -3641,21 +4077,24 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RELEASE)) {
+        return pfnRelease(hQueue);
+    }
+
     ur_queue_release_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RELEASE,
                                                    "urQueueRelease", &params);
 
-    getContext()->logger.info("---> urQueueRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueRelease");
 
     ur_result_t result = pfnRelease(hQueue);
 
     getContext()->notify_end(UR_FUNCTION_QUEUE_RELEASE, "urQueueRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_RELEASE, &params}, result);
 
     return result;
 }
@@ -3675,12 +4114,17 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+    }
+
     ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
                                                   &phNativeQueue};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urQueueGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
 
@@ -3688,10 +4132,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
                              "urQueueGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, &params},
+                result);
 
     return result;
 }
@@ -3715,13 +4158,19 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
+                                         pProperties, phQueue);
+    }
+
     ur_queue_create_with_native_handle_params_t params = {
         &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
                                    "urQueueCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urQueueCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueCreateWithNativeHandle");
 
     ur_result_t result = pfnCreateWithNativeHandle(
         hNativeQueue, hContext, hDevice, pProperties, phQueue);
@@ -3730,10 +4179,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
                              "urQueueCreateWithNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -3749,21 +4198,24 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FINISH)) {
+        return pfnFinish(hQueue);
+    }
+
     ur_queue_finish_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FINISH,
                                                    "urQueueFinish", &params);
 
-    getContext()->logger.info("---> urQueueFinish");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueFinish");
 
     ur_result_t result = pfnFinish(hQueue);
 
     getContext()->notify_end(UR_FUNCTION_QUEUE_FINISH, "urQueueFinish", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FINISH,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_FINISH, &params}, result);
 
     return result;
 }
@@ -3779,20 +4231,24 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FLUSH)) {
+        return pfnFlush(hQueue);
+    }
+
     ur_queue_flush_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FLUSH,
                                                    "urQueueFlush", &params);
 
-    getContext()->logger.info("---> urQueueFlush");
+    auto &logger = getContext()->logger;
+    logger.info("---> urQueueFlush");
 
     ur_result_t result = pfnFlush(hQueue);
 
     getContext()->notify_end(UR_FUNCTION_QUEUE_FLUSH, "urQueueFlush", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FLUSH, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_QUEUE_FLUSH, &params}, result);
 
     return result;
 }
@@ -3814,12 +4270,17 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_INFO)) {
+        return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_GET_INFO,
                                                    "urEventGetInfo", &params);
 
-    getContext()->logger.info("---> urEventGetInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventGetInfo");
 
     ur_result_t result =
         pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
@@ -3827,10 +4288,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
     getContext()->notify_end(UR_FUNCTION_EVENT_GET_INFO, "urEventGetInfo",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_GET_INFO,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_GET_INFO, &params}, result);
 
     return result;
 }
@@ -3856,13 +4315,19 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_PROFILING_INFO)) {
+        return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
+                                   pPropSizeRet);
+    }
+
     ur_event_get_profiling_info_params_t params = {
         &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_EVENT_GET_PROFILING_INFO,
                                    "urEventGetProfilingInfo", &params);
 
-    getContext()->logger.info("---> urEventGetProfilingInfo");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventGetProfilingInfo");
 
     ur_result_t result = pfnGetProfilingInfo(hEvent, propName, propSize,
                                              pPropValue, pPropSizeRet);
@@ -3871,10 +4336,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
                              "urEventGetProfilingInfo", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_EVENT_GET_PROFILING_INFO, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_GET_PROFILING_INFO, &params},
+                result);
 
     return result;
 }
@@ -3893,20 +4357,24 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT)) {
+        return pfnWait(numEvents, phEventWaitList);
+    }
+
     ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_WAIT,
                                                    "urEventWait", &params);
 
-    getContext()->logger.info("---> urEventWait");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventWait");
 
     ur_result_t result = pfnWait(numEvents, phEventWaitList);
 
     getContext()->notify_end(UR_FUNCTION_EVENT_WAIT, "urEventWait", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_WAIT, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_WAIT, &params}, result);
 
     return result;
 }
@@ -3922,21 +4390,24 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RETAIN)) {
+        return pfnRetain(hEvent);
+    }
+
     ur_event_retain_params_t params = {&hEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RETAIN,
                                                    "urEventRetain", &params);
 
-    getContext()->logger.info("---> urEventRetain");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventRetain");
 
     ur_result_t result = pfnRetain(hEvent);
 
     getContext()->notify_end(UR_FUNCTION_EVENT_RETAIN, "urEventRetain", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RETAIN,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_RETAIN, &params}, result);
 
     return result;
 }
@@ -3952,21 +4423,24 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RELEASE)) {
+        return pfnRelease(hEvent);
+    }
+
     ur_event_release_params_t params = {&hEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RELEASE,
                                                    "urEventRelease", &params);
 
-    getContext()->logger.info("---> urEventRelease");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventRelease");
 
     ur_result_t result = pfnRelease(hEvent);
 
     getContext()->notify_end(UR_FUNCTION_EVENT_RELEASE, "urEventRelease",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RELEASE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_RELEASE, &params}, result);
 
     return result;
 }
@@ -3984,11 +4458,16 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hEvent, phNativeEvent);
+    }
+
     ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params);
 
-    getContext()->logger.info("---> urEventGetNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventGetNativeHandle");
 
     ur_result_t result = pfnGetNativeHandle(hEvent, phNativeEvent);
 
@@ -3996,10 +4475,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
                              "urEventGetNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, &params},
+                result);
 
     return result;
 }
@@ -4022,13 +4500,19 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
+                                         phEvent);
+    }
+
     ur_event_create_with_native_handle_params_t params = {
         &hNativeEvent, &hContext, &pProperties, &phEvent};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
                                    "urEventCreateWithNativeHandle", &params);
 
-    getContext()->logger.info("---> urEventCreateWithNativeHandle");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventCreateWithNativeHandle");
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties, phEvent);
@@ -4037,10 +4521,10 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
                              "urEventCreateWithNativeHandle", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE, &params},
+        result);
 
     return result;
 }
@@ -4060,12 +4544,17 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_SET_CALLBACK)) {
+        return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+    }
+
     ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                              &pUserData};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback", &params);
 
-    getContext()->logger.info("---> urEventSetCallback");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEventSetCallback");
 
     ur_result_t result =
         pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
@@ -4073,10 +4562,9 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
     getContext()->notify_end(UR_FUNCTION_EVENT_SET_CALLBACK,
                              "urEventSetCallback", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_SET_CALLBACK,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_EVENT_SET_CALLBACK, &params},
+                result);
 
     return result;
 }
@@ -4118,6 +4606,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH)) {
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_params_t params = {&hQueue,
                                                 &hKernel,
                                                 &workDim,
@@ -4130,7 +4624,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "urEnqueueKernelLaunch", &params);
 
-    getContext()->logger.info("---> urEnqueueKernelLaunch");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueKernelLaunch");
 
     ur_result_t result = pfnKernelLaunch(
         hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
@@ -4140,10 +4635,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                              "urEnqueueKernelLaunch", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, &params},
+                result);
 
     return result;
 }
@@ -4169,12 +4663,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_EVENTS_WAIT)) {
+        return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
+                             phEvent);
+    }
+
     ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                               &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait", &params);
 
-    getContext()->logger.info("---> urEnqueueEventsWait");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueEventsWait");
 
     ur_result_t result =
         pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
@@ -4182,10 +4682,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     getContext()->notify_end(UR_FUNCTION_ENQUEUE_EVENTS_WAIT,
                              "urEnqueueEventsWait", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_EVENTS_WAIT, &params},
+                result);
 
     return result;
 }
@@ -4212,13 +4711,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER)) {
+        return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_events_wait_with_barrier_params_t params = {
         &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
                                    "urEnqueueEventsWaitWithBarrier", &params);
 
-    getContext()->logger.info("---> urEnqueueEventsWaitWithBarrier");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueEventsWaitWithBarrier");
 
     ur_result_t result = pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
                                                   phEventWaitList, phEvent);
@@ -4227,10 +4732,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
                              "urEnqueueEventsWaitWithBarrier", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER, &params},
+        result);
 
     return result;
 }
@@ -4261,6 +4766,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ)) {
+        return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size,
+                                pDst, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_params_t params = {
         &hQueue, &hBuffer, &blockingRead,        &offset,
         &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
@@ -4268,7 +4779,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferRead");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferRead");
 
     ur_result_t result =
         pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
@@ -4278,10 +4790,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
                              "urEnqueueMemBufferRead", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, &params},
+                result);
 
     return result;
 }
@@ -4314,6 +4825,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE)) {
+        return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size,
+                                 pSrc, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_params_t params = {
         &hQueue, &hBuffer, &blockingWrite,       &offset,
         &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
@@ -4322,7 +4839,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
                                    "urEnqueueMemBufferWrite", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferWrite");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferWrite");
 
     ur_result_t result =
         pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
@@ -4332,10 +4850,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
                              "urEnqueueMemBufferWrite", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params},
+                result);
 
     return result;
 }
@@ -4379,6 +4896,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT)) {
+        return pfnMemBufferReadRect(hQueue, hBuffer, blockingRead, bufferOrigin,
+                                    hostOrigin, region, bufferRowPitch,
+                                    bufferSlicePitch, hostRowPitch,
+                                    hostSlicePitch, pDst, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_rect_params_t params = {&hQueue,
                                                        &hBuffer,
                                                        &blockingRead,
@@ -4397,7 +4922,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
                                    "urEnqueueMemBufferReadRect", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferReadRect");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferReadRect");
 
     ur_result_t result = pfnMemBufferReadRect(
         hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
@@ -4408,10 +4934,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                              "urEnqueueMemBufferReadRect", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, &params},
+        result);
 
     return result;
 }
@@ -4458,6 +4984,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT)) {
+        return pfnMemBufferWriteRect(hQueue, hBuffer, blockingWrite,
+                                     bufferOrigin, hostOrigin, region,
+                                     bufferRowPitch, bufferSlicePitch,
+                                     hostRowPitch, hostSlicePitch, pSrc,
+                                     numEventsInWaitList, phEventWaitList,
+                                     phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_rect_params_t params = {&hQueue,
                                                         &hBuffer,
                                                         &blockingWrite,
@@ -4476,7 +5011,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
                                    "urEnqueueMemBufferWriteRect", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferWriteRect");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferWriteRect");
 
     ur_result_t result = pfnMemBufferWriteRect(
         hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
@@ -4487,10 +5023,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                              "urEnqueueMemBufferWriteRect", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT, &params},
+        result);
 
     return result;
 }
@@ -4522,13 +5058,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY)) {
+        return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                                dstOffset, size, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_params_t params = {
         &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
         &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferCopy");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferCopy");
 
     ur_result_t result =
         pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset,
@@ -4538,10 +5081,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
                              "urEnqueueMemBufferCopy", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, &params},
+                result);
 
     return result;
 }
@@ -4583,6 +5125,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT)) {
+        return pfnMemBufferCopyRect(hQueue, hBufferSrc, hBufferDst, srcOrigin,
+                                    dstOrigin, region, srcRowPitch,
+                                    srcSlicePitch, dstRowPitch, dstSlicePitch,
+                                    numEventsInWaitList, phEventWaitList,
+                                    phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_rect_params_t params = {
         &hQueue,      &hBufferSrc,    &hBufferDst,          &srcOrigin,
         &dstOrigin,   &region,        &srcRowPitch,         &srcSlicePitch,
@@ -4592,7 +5142,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
                                    "urEnqueueMemBufferCopyRect", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferCopyRect");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferCopyRect");
 
     ur_result_t result = pfnMemBufferCopyRect(
         hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
@@ -4603,10 +5154,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
                              "urEnqueueMemBufferCopyRect", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, &params},
+        result);
 
     return result;
 }
@@ -4637,6 +5188,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL)) {
+        return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_fill_params_t params = {&hQueue,
                                                   &hBuffer,
                                                   &pPattern,
@@ -4649,7 +5206,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferFill");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferFill");
 
     ur_result_t result =
         pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset, size,
@@ -4659,10 +5217,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                              "urEnqueueMemBufferFill", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, &params},
+                result);
 
     return result;
 }
@@ -4698,6 +5255,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ)) {
+        return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
+                               rowPitch, slicePitch, pDst, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_read_params_t params = {
         &hQueue,          &hImage, &blockingRead,
         &origin,          &region, &rowPitch,
@@ -4706,7 +5269,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, "urEnqueueMemImageRead", &params);
 
-    getContext()->logger.info("---> urEnqueueMemImageRead");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemImageRead");
 
     ur_result_t result = pfnMemImageRead(
         hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
@@ -4716,10 +5280,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
                              "urEnqueueMemImageRead", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, &params},
+                result);
 
     return result;
 }
@@ -4756,6 +5319,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE)) {
+        return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
+                                rowPitch, slicePitch, pSrc, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_write_params_t params = {
         &hQueue,          &hImage, &blockingWrite,
         &origin,          &region, &rowPitch,
@@ -4764,7 +5333,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite", &params);
 
-    getContext()->logger.info("---> urEnqueueMemImageWrite");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemImageWrite");
 
     ur_result_t result = pfnMemImageWrite(
         hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
@@ -4774,10 +5344,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
                              "urEnqueueMemImageWrite", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, &params},
+                result);
 
     return result;
 }
@@ -4815,13 +5384,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY)) {
+        return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin,
+                               dstOrigin, region, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_copy_params_t params = {
         &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
         &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, "urEnqueueMemImageCopy", &params);
 
-    getContext()->logger.info("---> urEnqueueMemImageCopy");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemImageCopy");
 
     ur_result_t result =
         pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
@@ -4831,10 +5407,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
                              "urEnqueueMemImageCopy", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, &params},
+                result);
 
     return result;
 }
@@ -4867,6 +5442,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP)) {
+        return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent, ppRetMap);
+    }
+
     ur_enqueue_mem_buffer_map_params_t params = {
         &hQueue,  &hBuffer, &blockingMap,         &mapFlags,
         &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
@@ -4874,7 +5455,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, "urEnqueueMemBufferMap", &params);
 
-    getContext()->logger.info("---> urEnqueueMemBufferMap");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemBufferMap");
 
     ur_result_t result = pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags,
                                          offset, size, numEventsInWaitList,
@@ -4884,10 +5466,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
                              "urEnqueueMemBufferMap", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, &params},
+                result);
 
     return result;
 }
@@ -4915,13 +5496,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_UNMAP)) {
+        return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                           phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_unmap_params_t params = {
         &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap", &params);
 
-    getContext()->logger.info("---> urEnqueueMemUnmap");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueMemUnmap");
 
     ur_result_t result =
         pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
@@ -4930,10 +5517,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
     getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_MEM_UNMAP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_MEM_UNMAP, &params},
+                result);
 
     return result;
 }
@@ -4966,6 +5552,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL)) {
+        return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_fill_params_t params = {
         &hQueue,          &pMem,   &patternSize,
         &pPattern,        &size,   &numEventsInWaitList,
@@ -4973,7 +5564,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_FILL,
                                                    "urEnqueueUSMFill", &params);
 
-    getContext()->logger.info("---> urEnqueueUSMFill");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueUSMFill");
 
     ur_result_t result =
         pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
@@ -4982,10 +5574,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
     getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FILL, "urEnqueueUSMFill",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_FILL,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_USM_FILL, &params},
+                result);
 
     return result;
 }
@@ -5016,13 +5607,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY)) {
+        return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_params_t params = {
         &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy", &params);
 
-    getContext()->logger.info("---> urEnqueueUSMMemcpy");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueUSMMemcpy");
 
     ur_result_t result =
         pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
@@ -5031,10 +5628,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_MEMCPY,
                              "urEnqueueUSMMemcpy", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_USM_MEMCPY, &params},
+                result);
 
     return result;
 }
@@ -5063,13 +5659,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_PREFETCH)) {
+        return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_prefetch_params_t params = {
         &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_USM_PREFETCH, "urEnqueueUSMPrefetch", &params);
 
-    getContext()->logger.info("---> urEnqueueUSMPrefetch");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueUSMPrefetch");
 
     ur_result_t result =
         pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
@@ -5079,10 +5681,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
                              "urEnqueueUSMPrefetch", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_PREFETCH,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_USM_PREFETCH, &params},
+                result);
 
     return result;
 }
@@ -5105,22 +5706,26 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_ADVISE)) {
+        return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+    }
+
     ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                              &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise", &params);
 
-    getContext()->logger.info("---> urEnqueueUSMAdvise");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueUSMAdvise");
 
     ur_result_t result = pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
 
     getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_ADVISE,
                              "urEnqueueUSMAdvise", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_ADVISE,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_USM_ADVISE, &params},
+                result);
 
     return result;
 }
@@ -5158,6 +5763,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL_2D)) {
+        return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
+                            height, numEventsInWaitList, phEventWaitList,
+                            phEvent);
+    }
+
     ur_enqueue_usm_fill_2d_params_t params = {
         &hQueue,          &pMem,   &pitch,  &patternSize,
         &pPattern,        &width,  &height, &numEventsInWaitList,
@@ -5165,7 +5776,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D", &params);
 
-    getContext()->logger.info("---> urEnqueueUSMFill2D");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueUSMFill2D");
 
     ur_result_t result =
         pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width, height,
@@ -5174,10 +5786,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
     getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FILL_2D,
                              "urEnqueueUSMFill2D", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_FILL_2D,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_USM_FILL_2D, &params},
+                result);
 
     return result;
 }
@@ -5214,6 +5825,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D)) {
+        return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
+                              width, height, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_2d_params_t params = {
         &hQueue,          &blocking, &pDst,
         &dstPitch,        &pSrc,     &srcPitch,
@@ -5222,7 +5839,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, "urEnqueueUSMMemcpy2D", &params);
 
-    getContext()->logger.info("---> urEnqueueUSMMemcpy2D");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueUSMMemcpy2D");
 
     ur_result_t result =
         pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width,
@@ -5232,10 +5850,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
                              "urEnqueueUSMMemcpy2D", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, &params},
+                result);
 
     return result;
 }
@@ -5270,6 +5887,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE)) {
+        return pfnDeviceGlobalVariableWrite(hQueue, hProgram, name,
+                                            blockingWrite, count, offset, pSrc,
+                                            numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+    }
+
     ur_enqueue_device_global_variable_write_params_t params = {
         &hQueue,          &hProgram, &name, &blockingWrite,
         &count,           &offset,   &pSrc, &numEventsInWaitList,
@@ -5278,7 +5903,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
         "urEnqueueDeviceGlobalVariableWrite", &params);
 
-    getContext()->logger.info("---> urEnqueueDeviceGlobalVariableWrite");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueDeviceGlobalVariableWrite");
 
     ur_result_t result = pfnDeviceGlobalVariableWrite(
         hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
@@ -5288,10 +5914,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
                              "urEnqueueDeviceGlobalVariableWrite", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+                         &params},
+        result);
 
     return result;
 }
@@ -5326,6 +5953,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ)) {
+        return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
+                                           count, offset, pDst,
+                                           numEventsInWaitList, phEventWaitList,
+                                           phEvent);
+    }
+
     ur_enqueue_device_global_variable_read_params_t params = {
         &hQueue,          &hProgram, &name, &blockingRead,
         &count,           &offset,   &pDst, &numEventsInWaitList,
@@ -5334,7 +5969,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
         "urEnqueueDeviceGlobalVariableRead", &params);
 
-    getContext()->logger.info("---> urEnqueueDeviceGlobalVariableRead");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueDeviceGlobalVariableRead");
 
     ur_result_t result = pfnDeviceGlobalVariableRead(
         hQueue, hProgram, name, blockingRead, count, offset, pDst,
@@ -5344,10 +5980,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
                              "urEnqueueDeviceGlobalVariableRead", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+                         &params},
+        result);
 
     return result;
 }
@@ -5385,6 +6022,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE)) {
+        return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    }
+
     ur_enqueue_read_host_pipe_params_t params = {
         &hQueue, &hProgram, &pipe_symbol,         &blocking,
         &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
@@ -5392,7 +6035,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, "urEnqueueReadHostPipe", &params);
 
-    getContext()->logger.info("---> urEnqueueReadHostPipe");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueReadHostPipe");
 
     ur_result_t result =
         pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst, size,
@@ -5402,10 +6046,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
                              "urEnqueueReadHostPipe", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, &params},
+                result);
 
     return result;
 }
@@ -5443,6 +6086,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE)) {
+        return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_write_host_pipe_params_t params = {
         &hQueue, &hProgram, &pipe_symbol,         &blocking,
         &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
@@ -5450,7 +6099,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, "urEnqueueWriteHostPipe", &params);
 
-    getContext()->logger.info("---> urEnqueueWriteHostPipe");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueWriteHostPipe");
 
     ur_result_t result =
         pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
@@ -5460,10 +6110,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
                              "urEnqueueWriteHostPipe", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, &params},
+                result);
 
     return result;
 }
@@ -5492,13 +6141,20 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_PITCHED_ALLOC_EXP)) {
+        return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool,
+                                  widthInBytes, height, elementSizeBytes, ppMem,
+                                  pResultPitch);
+    }
+
     ur_usm_pitched_alloc_exp_params_t params = {
         &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
         &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_USM_PITCHED_ALLOC_EXP, "urUSMPitchedAllocExp", &params);
 
-    getContext()->logger.info("---> urUSMPitchedAllocExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMPitchedAllocExp");
 
     ur_result_t result =
         pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
@@ -5508,10 +6164,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
                              "urUSMPitchedAllocExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_PITCHED_ALLOC_EXP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_PITCHED_ALLOC_EXP, &params},
+                result);
 
     return result;
 }
@@ -5533,14 +6188,19 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
     ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
         "urBindlessImagesUnsampledImageHandleDestroyExp", &params);
 
-    getContext()->logger.info(
-        "---> urBindlessImagesUnsampledImageHandleDestroyExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesUnsampledImageHandleDestroyExp");
 
     ur_result_t result =
         pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
@@ -5550,12 +6210,12 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         "urBindlessImagesUnsampledImageHandleDestroyExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str,
-        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -5577,14 +6237,19 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
     ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
         "urBindlessImagesSampledImageHandleDestroyExp", &params);
 
-    getContext()->logger.info(
-        "---> urBindlessImagesSampledImageHandleDestroyExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesSampledImageHandleDestroyExp");
 
     ur_result_t result =
         pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
@@ -5594,11 +6259,12 @@ urBindlessImagesSampledImageHandleDestroyExp(
         "urBindlessImagesSampledImageHandleDestroyExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -5621,13 +6287,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP)) {
+        return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
+                                   phImageMem);
+    }
+
     ur_bindless_images_image_allocate_exp_params_t params = {
         &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
         "urBindlessImagesImageAllocateExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesImageAllocateExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesImageAllocateExp");
 
     ur_result_t result = pfnImageAllocateExp(hContext, hDevice, pImageFormat,
                                              pImageDesc, phImageMem);
@@ -5636,10 +6309,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
                              "urBindlessImagesImageAllocateExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -5659,13 +6333,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP)) {
+        return pfnImageFreeExp(hContext, hDevice, hImageMem);
+    }
+
     ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
                                                          &hImageMem};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
                                    "urBindlessImagesImageFreeExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesImageFreeExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesImageFreeExp");
 
     ur_result_t result = pfnImageFreeExp(hContext, hDevice, hImageMem);
 
@@ -5673,10 +6352,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
                              "urBindlessImagesImageFreeExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP, &params},
+        result);
 
     return result;
 }
@@ -5701,13 +6380,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP)) {
+        return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
+                                          pImageFormat, pImageDesc, phImage);
+    }
+
     ur_bindless_images_unsampled_image_create_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
         "urBindlessImagesUnsampledImageCreateExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesUnsampledImageCreateExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesUnsampledImageCreateExp");
 
     ur_result_t result = pfnUnsampledImageCreateExp(
         hContext, hDevice, hImageMem, pImageFormat, pImageDesc, phImage);
@@ -5716,11 +6402,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
         "urBindlessImagesUnsampledImageCreateExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -5746,6 +6432,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP)) {
+        return pfnSampledImageCreateExp(hContext, hDevice, hImageMem,
+                                        pImageFormat, pImageDesc, hSampler,
+                                        phImage);
+    }
+
     ur_bindless_images_sampled_image_create_exp_params_t params = {
         &hContext,   &hDevice,  &hImageMem, &pImageFormat,
         &pImageDesc, &hSampler, &phImage};
@@ -5753,7 +6446,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
         "urBindlessImagesSampledImageCreateExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesSampledImageCreateExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesSampledImageCreateExp");
 
     ur_result_t result =
         pfnSampledImageCreateExp(hContext, hDevice, hImageMem, pImageFormat,
@@ -5763,11 +6457,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
         "urBindlessImagesSampledImageCreateExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -5807,6 +6501,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP)) {
+        return pfnImageCopyExp(hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc,
+                               pSrcImageFormat, pDstImageFormat, pCopyRegion,
+                               imageCopyFlags, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_image_copy_exp_params_t params = {&hQueue,
                                                          &pSrc,
                                                          &pDst,
@@ -5823,7 +6524,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
                                    "urBindlessImagesImageCopyExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesImageCopyExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesImageCopyExp");
 
     ur_result_t result = pfnImageCopyExp(
         hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
@@ -5834,10 +6536,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                              "urBindlessImagesImageCopyExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP, &params},
+        result);
 
     return result;
 }
@@ -5859,13 +6561,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP)) {
+        return pfnImageGetInfoExp(hContext, hImageMem, propName, pPropValue,
+                                  pPropSizeRet);
+    }
+
     ur_bindless_images_image_get_info_exp_params_t params = {
         &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
         "urBindlessImagesImageGetInfoExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesImageGetInfoExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesImageGetInfoExp");
 
     ur_result_t result = pfnImageGetInfoExp(hContext, hImageMem, propName,
                                             pPropValue, pPropSizeRet);
@@ -5874,10 +6583,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
                              "urBindlessImagesImageGetInfoExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -5900,13 +6610,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP)) {
+        return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
+                                    phImageMem);
+    }
+
     ur_bindless_images_mipmap_get_level_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
         "urBindlessImagesMipmapGetLevelExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesMipmapGetLevelExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesMipmapGetLevelExp");
 
     ur_result_t result = pfnMipmapGetLevelExp(hContext, hDevice, hImageMem,
                                               mipmapLevel, phImageMem);
@@ -5915,10 +6632,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
                              "urBindlessImagesMipmapGetLevelExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -5938,13 +6656,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP)) {
+        return pfnMipmapFreeExp(hContext, hDevice, hMem);
+    }
+
     ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
                                                           &hMem};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
                                    "urBindlessImagesMipmapFreeExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesMipmapFreeExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesMipmapFreeExp");
 
     ur_result_t result = pfnMipmapFreeExp(hContext, hDevice, hMem);
 
@@ -5952,10 +6675,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
                              "urBindlessImagesMipmapFreeExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP, &params},
+        result);
 
     return result;
 }
@@ -5980,6 +6703,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP)) {
+        return pfnImportExternalMemoryExp(hContext, hDevice, size,
+                                          memHandleType, pExternalMemDesc,
+                                          phExternalMem);
+    }
+
     ur_bindless_images_import_external_memory_exp_params_t params = {
         &hContext,      &hDevice,          &size,
         &memHandleType, &pExternalMemDesc, &phExternalMem};
@@ -5987,7 +6717,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
         "urBindlessImagesImportExternalMemoryExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesImportExternalMemoryExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesImportExternalMemoryExp");
 
     ur_result_t result =
         pfnImportExternalMemoryExp(hContext, hDevice, size, memHandleType,
@@ -5997,11 +6728,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
         "urBindlessImagesImportExternalMemoryExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6026,6 +6757,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP)) {
+        return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat,
+                                      pImageDesc, hExternalMem, phImageMem);
+    }
+
     ur_bindless_images_map_external_array_exp_params_t params = {
         &hContext,   &hDevice,      &pImageFormat,
         &pImageDesc, &hExternalMem, &phImageMem};
@@ -6033,7 +6770,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
         "urBindlessImagesMapExternalArrayExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesMapExternalArrayExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesMapExternalArrayExp");
 
     ur_result_t result = pfnMapExternalArrayExp(
         hContext, hDevice, pImageFormat, pImageDesc, hExternalMem, phImageMem);
@@ -6042,10 +6780,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
                              "urBindlessImagesMapExternalArrayExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6069,14 +6808,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP)) {
+        return pfnMapExternalLinearMemoryExp(hContext, hDevice, offset, size,
+                                             hExternalMem, ppRetMem);
+    }
+
     ur_bindless_images_map_external_linear_memory_exp_params_t params = {
         &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
         "urBindlessImagesMapExternalLinearMemoryExp", &params);
 
-    getContext()->logger.info(
-        "---> urBindlessImagesMapExternalLinearMemoryExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesMapExternalLinearMemoryExp");
 
     ur_result_t result = pfnMapExternalLinearMemoryExp(
         hContext, hDevice, offset, size, hExternalMem, ppRetMem);
@@ -6086,11 +6831,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         "urBindlessImagesMapExternalLinearMemoryExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -6110,13 +6856,19 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP)) {
+        return pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
+    }
+
     ur_bindless_images_release_external_memory_exp_params_t params = {
         &hContext, &hDevice, &hExternalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
         "urBindlessImagesReleaseExternalMemoryExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesReleaseExternalMemoryExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesReleaseExternalMemoryExp");
 
     ur_result_t result =
         pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
@@ -6125,11 +6877,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
         "urBindlessImagesReleaseExternalMemoryExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP, &params},
+        result);
 
     return result;
 }
@@ -6154,6 +6906,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
+                                             pExternalSemaphoreDesc,
+                                             phExternalSemaphore);
+    }
+
     ur_bindless_images_import_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
         &phExternalSemaphore};
@@ -6161,8 +6920,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
         "urBindlessImagesImportExternalSemaphoreExp", &params);
 
-    getContext()->logger.info(
-        "---> urBindlessImagesImportExternalSemaphoreExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesImportExternalSemaphoreExp");
 
     ur_result_t result = pfnImportExternalSemaphoreExp(
         hContext, hDevice, semHandleType, pExternalSemaphoreDesc,
@@ -6173,11 +6932,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         "urBindlessImagesImportExternalSemaphoreExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP, &params},
+        result);
 
     return result;
 }
@@ -6198,14 +6957,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnReleaseExternalSemaphoreExp(hContext, hDevice,
+                                              hExternalSemaphore);
+    }
+
     ur_bindless_images_release_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &hExternalSemaphore};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
         "urBindlessImagesReleaseExternalSemaphoreExp", &params);
 
-    getContext()->logger.info(
-        "---> urBindlessImagesReleaseExternalSemaphoreExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesReleaseExternalSemaphoreExp");
 
     ur_result_t result =
         pfnReleaseExternalSemaphoreExp(hContext, hDevice, hExternalSemaphore);
@@ -6215,11 +6980,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         "urBindlessImagesReleaseExternalSemaphoreExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -6254,6 +7020,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
+                                           waitValue, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_wait_external_semaphore_exp_params_t params = {
         &hQueue,    &hSemaphore,          &hasWaitValue,
         &waitValue, &numEventsInWaitList, &phEventWaitList,
@@ -6262,7 +7035,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
         "urBindlessImagesWaitExternalSemaphoreExp", &params);
 
-    getContext()->logger.info("---> urBindlessImagesWaitExternalSemaphoreExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesWaitExternalSemaphoreExp");
 
     ur_result_t result = pfnWaitExternalSemaphoreExp(
         hQueue, hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
@@ -6272,11 +7046,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
         "urBindlessImagesWaitExternalSemaphoreExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP, &params},
+        result);
 
     return result;
 }
@@ -6312,6 +7086,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
+                                             signalValue, numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_signal_external_semaphore_exp_params_t params = {
         &hQueue,      &hSemaphore,          &hasSignalValue,
         &signalValue, &numEventsInWaitList, &phEventWaitList,
@@ -6320,8 +7101,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
         "urBindlessImagesSignalExternalSemaphoreExp", &params);
 
-    getContext()->logger.info(
-        "---> urBindlessImagesSignalExternalSemaphoreExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urBindlessImagesSignalExternalSemaphoreExp");
 
     ur_result_t result = pfnSignalExternalSemaphoreExp(
         hQueue, hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
@@ -6332,11 +7113,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         "urBindlessImagesSignalExternalSemaphoreExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP, &params},
+        result);
 
     return result;
 }
@@ -6357,13 +7138,19 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP)) {
+        return pfnCreateExp(hContext, hDevice, pCommandBufferDesc,
+                            phCommandBuffer);
+    }
+
     ur_command_buffer_create_exp_params_t params = {
         &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP,
                                    "urCommandBufferCreateExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferCreateExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferCreateExp");
 
     ur_result_t result =
         pfnCreateExp(hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
@@ -6372,10 +7159,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
                              "urCommandBufferCreateExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, &params},
+        result);
 
     return result;
 }
@@ -6392,12 +7179,17 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP)) {
+        return pfnRetainExp(hCommandBuffer);
+    }
+
     ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP,
                                    "urCommandBufferRetainExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferRetainExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferRetainExp");
 
     ur_result_t result = pfnRetainExp(hCommandBuffer);
 
@@ -6405,10 +7197,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
                              "urCommandBufferRetainExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, &params},
+        result);
 
     return result;
 }
@@ -6426,12 +7218,17 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP)) {
+        return pfnReleaseExp(hCommandBuffer);
+    }
+
     ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP,
                                    "urCommandBufferReleaseExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferReleaseExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferReleaseExp");
 
     ur_result_t result = pfnReleaseExp(hCommandBuffer);
 
@@ -6439,10 +7236,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
                              "urCommandBufferReleaseExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, &params},
+        result);
 
     return result;
 }
@@ -6460,12 +7257,17 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP)) {
+        return pfnFinalizeExp(hCommandBuffer);
+    }
+
     ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP,
                                    "urCommandBufferFinalizeExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferFinalizeExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferFinalizeExp");
 
     ur_result_t result = pfnFinalizeExp(hCommandBuffer);
 
@@ -6473,10 +7275,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
                              "urCommandBufferFinalizeExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, &params},
+        result);
 
     return result;
 }
@@ -6511,6 +7313,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP)) {
+        return pfnAppendKernelLaunchExp(hCommandBuffer, hKernel, workDim,
+                                        pGlobalWorkOffset, pGlobalWorkSize,
+                                        pLocalWorkSize, numSyncPointsInWaitList,
+                                        pSyncPointWaitList, pSyncPoint,
+                                        phCommand);
+    }
+
     ur_command_buffer_append_kernel_launch_exp_params_t params = {
         &hCommandBuffer,
         &hKernel,
@@ -6526,7 +7337,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
         "urCommandBufferAppendKernelLaunchExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendKernelLaunchExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendKernelLaunchExp");
 
     ur_result_t result = pfnAppendKernelLaunchExp(
         hCommandBuffer, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
@@ -6537,10 +7349,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
         "urCommandBufferAppendKernelLaunchExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6568,6 +7381,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP)) {
+        return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_memcpy_exp_params_t params = {
         &hCommandBuffer,     &pDst,      &pSrc, &size, &numSyncPointsInWaitList,
         &pSyncPointWaitList, &pSyncPoint};
@@ -6575,7 +7395,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
         "urCommandBufferAppendUSMMemcpyExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendUSMMemcpyExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendUSMMemcpyExp");
 
     ur_result_t result = pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
                                                numSyncPointsInWaitList,
@@ -6585,10 +7406,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
                              "urCommandBufferAppendUSMMemcpyExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6618,6 +7440,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP)) {
+        return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern,
+                                   patternSize, size, numSyncPointsInWaitList,
+                                   pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_fill_exp_params_t params = {
         &hCommandBuffer,     &pMemory,   &pPattern,
         &patternSize,        &size,      &numSyncPointsInWaitList,
@@ -6626,7 +7455,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
         "urCommandBufferAppendUSMFillExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendUSMFillExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendUSMFillExp");
 
     ur_result_t result = pfnAppendUSMFillExp(
         hCommandBuffer, pMemory, pPattern, patternSize, size,
@@ -6636,10 +7466,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
                              "urCommandBufferAppendUSMFillExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6669,6 +7500,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP)) {
+        return pfnAppendMemBufferCopyExp(hCommandBuffer, hSrcMem, hDstMem,
+                                         srcOffset, dstOffset, size,
+                                         numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_copy_exp_params_t params = {
         &hCommandBuffer,
         &hSrcMem,
@@ -6683,7 +7522,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
         "urCommandBufferAppendMemBufferCopyExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendMemBufferCopyExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferCopyExp");
 
     ur_result_t result = pfnAppendMemBufferCopyExp(
         hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
@@ -6693,11 +7533,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
         "urCommandBufferAppendMemBufferCopyExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6727,6 +7567,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP)) {
+        return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
+                                          pSrc, numSyncPointsInWaitList,
+                                          pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_write_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -6740,7 +7587,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
         "urCommandBufferAppendMemBufferWriteExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendMemBufferWriteExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferWriteExp");
 
     ur_result_t result = pfnAppendMemBufferWriteExp(
         hCommandBuffer, hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
@@ -6750,11 +7598,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
         "urCommandBufferAppendMemBufferWriteExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6783,6 +7631,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP)) {
+        return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
+                                         pDst, numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_read_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -6796,7 +7651,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
         "urCommandBufferAppendMemBufferReadExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendMemBufferReadExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferReadExp");
 
     ur_result_t result = pfnAppendMemBufferReadExp(
         hCommandBuffer, hBuffer, offset, size, pDst, numSyncPointsInWaitList,
@@ -6806,11 +7662,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
         "urCommandBufferAppendMemBufferReadExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -6847,6 +7703,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP)) {
+        return pfnAppendMemBufferCopyRectExp(hCommandBuffer, hSrcMem, hDstMem,
+                                             srcOrigin, dstOrigin, region,
+                                             srcRowPitch, srcSlicePitch,
+                                             dstRowPitch, dstSlicePitch,
+                                             numSyncPointsInWaitList,
+                                             pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t params = {
         &hCommandBuffer,
         &hSrcMem,
@@ -6865,7 +7731,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
         "urCommandBufferAppendMemBufferCopyRectExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendMemBufferCopyRectExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferCopyRectExp");
 
     ur_result_t result = pfnAppendMemBufferCopyRectExp(
         hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
@@ -6877,11 +7744,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         "urCommandBufferAppendMemBufferCopyRectExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -6925,6 +7793,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP)) {
+        return pfnAppendMemBufferWriteRectExp(hCommandBuffer, hBuffer,
+                                              bufferOffset, hostOffset, region,
+                                              bufferRowPitch, bufferSlicePitch,
+                                              hostRowPitch, hostSlicePitch,
+                                              pSrc, numSyncPointsInWaitList,
+                                              pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_write_rect_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -6943,8 +7821,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
         "urCommandBufferAppendMemBufferWriteRectExp", &params);
 
-    getContext()->logger.info(
-        "---> urCommandBufferAppendMemBufferWriteRectExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferWriteRectExp");
 
     ur_result_t result = pfnAppendMemBufferWriteRectExp(
         hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
@@ -6956,11 +7834,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         "urCommandBufferAppendMemBufferWriteRectExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -7001,6 +7880,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP)) {
+        return pfnAppendMemBufferReadRectExp(hCommandBuffer, hBuffer,
+                                             bufferOffset, hostOffset, region,
+                                             bufferRowPitch, bufferSlicePitch,
+                                             hostRowPitch, hostSlicePitch, pDst,
+                                             numSyncPointsInWaitList,
+                                             pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_read_rect_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7019,7 +7908,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
         "urCommandBufferAppendMemBufferReadRectExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendMemBufferReadRectExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferReadRectExp");
 
     ur_result_t result = pfnAppendMemBufferReadRectExp(
         hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
@@ -7031,11 +7921,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         "urCommandBufferAppendMemBufferReadRectExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -7066,6 +7957,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP)) {
+        return pfnAppendMemBufferFillExp(hCommandBuffer, hBuffer, pPattern,
+                                         patternSize, offset, size,
+                                         numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_fill_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7080,7 +7979,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
         "urCommandBufferAppendMemBufferFillExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendMemBufferFillExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendMemBufferFillExp");
 
     ur_result_t result = pfnAppendMemBufferFillExp(
         hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
@@ -7090,11 +7990,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
         "urCommandBufferAppendMemBufferFillExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7122,6 +8022,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP)) {
+        return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
+                                       numSyncPointsInWaitList,
+                                       pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_prefetch_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -7134,7 +8041,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
         "urCommandBufferAppendUSMPrefetchExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendUSMPrefetchExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendUSMPrefetchExp");
 
     ur_result_t result = pfnAppendUSMPrefetchExp(
         hCommandBuffer, pMemory, size, flags, numSyncPointsInWaitList,
@@ -7144,10 +8052,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
                              "urCommandBufferAppendUSMPrefetchExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7175,6 +8084,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP)) {
+        return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_advise_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -7187,7 +8103,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
         "urCommandBufferAppendUSMAdviseExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferAppendUSMAdviseExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferAppendUSMAdviseExp");
 
     ur_result_t result = pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size,
                                                advice, numSyncPointsInWaitList,
@@ -7197,10 +8114,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
                              "urCommandBufferAppendUSMAdviseExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7228,6 +8146,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP)) {
+        return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
+                             phEventWaitList, phEvent);
+    }
+
     ur_command_buffer_enqueue_exp_params_t params = {
         &hCommandBuffer, &hQueue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
@@ -7235,7 +8158,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
                                    "urCommandBufferEnqueueExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferEnqueueExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferEnqueueExp");
 
     ur_result_t result = pfnEnqueueExp(
         hCommandBuffer, hQueue, numEventsInWaitList, phEventWaitList, phEvent);
@@ -7244,10 +8168,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
                              "urCommandBufferEnqueueExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, &params},
+        result);
 
     return result;
 }
@@ -7265,12 +8189,18 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP)) {
+        return pfnRetainCommandExp(hCommand);
+    }
+
     ur_command_buffer_retain_command_exp_params_t params = {&hCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
         "urCommandBufferRetainCommandExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferRetainCommandExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferRetainCommandExp");
 
     ur_result_t result = pfnRetainCommandExp(hCommand);
 
@@ -7278,10 +8208,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
                              "urCommandBufferRetainCommandExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7299,12 +8230,18 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP)) {
+        return pfnReleaseCommandExp(hCommand);
+    }
+
     ur_command_buffer_release_command_exp_params_t params = {&hCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
         "urCommandBufferReleaseCommandExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferReleaseCommandExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferReleaseCommandExp");
 
     ur_result_t result = pfnReleaseCommandExp(hCommand);
 
@@ -7312,10 +8249,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
                              "urCommandBufferReleaseCommandExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7335,13 +8273,19 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP)) {
+        return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+    }
+
     ur_command_buffer_update_kernel_launch_exp_params_t params = {
         &hCommand, &pUpdateKernelLaunch};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
         "urCommandBufferUpdateKernelLaunchExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferUpdateKernelLaunchExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferUpdateKernelLaunchExp");
 
     ur_result_t result =
         pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
@@ -7350,10 +8294,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
         "urCommandBufferUpdateKernelLaunchExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7380,13 +8325,19 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP)) {
+        return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
+                             pPropSizeRet);
+    }
+
     ur_command_buffer_get_info_exp_params_t params = {
         &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP,
                                    "urCommandBufferGetInfoExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferGetInfoExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferGetInfoExp");
 
     ur_result_t result = pfnGetInfoExp(hCommandBuffer, propName, propSize,
                                        pPropValue, pPropSizeRet);
@@ -7395,10 +8346,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
                              "urCommandBufferGetInfoExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, &params},
+        result);
 
     return result;
 }
@@ -7425,13 +8376,20 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP)) {
+        return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
+                                    pPropSizeRet);
+    }
+
     ur_command_buffer_command_get_info_exp_params_t params = {
         &hCommand, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
         "urCommandBufferCommandGetInfoExp", &params);
 
-    getContext()->logger.info("---> urCommandBufferCommandGetInfoExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urCommandBufferCommandGetInfoExp");
 
     ur_result_t result = pfnCommandGetInfoExp(hCommand, propName, propSize,
                                               pPropValue, pPropSizeRet);
@@ -7440,10 +8398,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
                              "urCommandBufferCommandGetInfoExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7486,6 +8445,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP)) {
+        return pfnCooperativeKernelLaunchExp(hQueue, hKernel, workDim,
+                                             pGlobalWorkOffset, pGlobalWorkSize,
+                                             pLocalWorkSize,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
     ur_enqueue_cooperative_kernel_launch_exp_params_t params = {
         &hQueue,
         &hKernel,
@@ -7500,7 +8468,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
         "urEnqueueCooperativeKernelLaunchExp", &params);
 
-    getContext()->logger.info("---> urEnqueueCooperativeKernelLaunchExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueCooperativeKernelLaunchExp");
 
     ur_result_t result = pfnCooperativeKernelLaunchExp(
         hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
@@ -7510,10 +8479,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
                              "urEnqueueCooperativeKernelLaunchExp", &params,
                              &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+                         &params},
+        result);
 
     return result;
 }
@@ -7538,14 +8508,21 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP)) {
+        return pfnSuggestMaxCooperativeGroupCountExp(hKernel, localWorkSize,
+                                                     dynamicSharedMemorySize,
+                                                     pGroupCountRet);
+    }
+
     ur_kernel_suggest_max_cooperative_group_count_exp_params_t params = {
         &hKernel, &localWorkSize, &dynamicSharedMemorySize, &pGroupCountRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
         "urKernelSuggestMaxCooperativeGroupCountExp", &params);
 
-    getContext()->logger.info(
-        "---> urKernelSuggestMaxCooperativeGroupCountExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urKernelSuggestMaxCooperativeGroupCountExp");
 
     ur_result_t result = pfnSuggestMaxCooperativeGroupCountExp(
         hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
@@ -7555,11 +8532,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         "urKernelSuggestMaxCooperativeGroupCountExp", &params, &result,
         instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
-        &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
+            &params},
+        result);
 
     return result;
 }
@@ -7594,13 +8572,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP)) {
+        return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_timestamp_recording_exp_params_t params = {
         &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
                                    "urEnqueueTimestampRecordingExp", &params);
 
-    getContext()->logger.info("---> urEnqueueTimestampRecordingExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueTimestampRecordingExp");
 
     ur_result_t result = pfnTimestampRecordingExp(
         hQueue, blocking, numEventsInWaitList, phEventWaitList, phEvent);
@@ -7609,10 +8593,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
                              "urEnqueueTimestampRecordingExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP, &params},
+        result);
 
     return result;
 }
@@ -7654,6 +8638,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP)) {
+        return pfnKernelLaunchCustomExp(hQueue, hKernel, workDim,
+                                        pGlobalWorkSize, pLocalWorkSize,
+                                        numPropsInLaunchPropList,
+                                        launchPropList, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_custom_exp_params_t params = {
         &hQueue,          &hKernel,
         &workDim,         &pGlobalWorkSize,
@@ -7664,7 +8656,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
                                    "urEnqueueKernelLaunchCustomExp", &params);
 
-    getContext()->logger.info("---> urEnqueueKernelLaunchCustomExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueKernelLaunchCustomExp");
 
     ur_result_t result = pfnKernelLaunchCustomExp(
         hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
@@ -7675,10 +8668,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
                              "urEnqueueKernelLaunchCustomExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP, &params},
+        result);
 
     return result;
 }
@@ -7699,22 +8692,26 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD_EXP)) {
+        return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
     ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                             &pOptions};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp", &params);
 
-    getContext()->logger.info("---> urProgramBuildExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramBuildExp");
 
     ur_result_t result = pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
 
     getContext()->notify_end(UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD_EXP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_BUILD_EXP, &params},
+                result);
 
     return result;
 }
@@ -7736,12 +8733,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE_EXP)) {
+        return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
     ur_program_compile_exp_params_t params = {&hProgram, &numDevices,
                                               &phDevices, &pOptions};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp", &params);
 
-    getContext()->logger.info("---> urProgramCompileExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramCompileExp");
 
     ur_result_t result =
         pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
@@ -7749,10 +8751,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     getContext()->notify_end(UR_FUNCTION_PROGRAM_COMPILE_EXP,
                              "urProgramCompileExp", &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_COMPILE_EXP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_COMPILE_EXP, &params},
+                result);
 
     return result;
 }
@@ -7781,13 +8782,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK_EXP)) {
+        return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
+                          pOptions, phProgram);
+    }
+
     ur_program_link_exp_params_t params = {&hContext, &numDevices, &phDevices,
                                            &count,    &phPrograms, &pOptions,
                                            &phProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK_EXP,
                                                    "urProgramLinkExp", &params);
 
-    getContext()->logger.info("---> urProgramLinkExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urProgramLinkExp");
 
     ur_result_t result = pfnLinkExp(hContext, numDevices, phDevices, count,
                                     phPrograms, pOptions, phProgram);
@@ -7795,10 +8802,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     getContext()->notify_end(UR_FUNCTION_PROGRAM_LINK_EXP, "urProgramLinkExp",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK_EXP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_PROGRAM_LINK_EXP, &params},
+                result);
 
     return result;
 }
@@ -7816,21 +8822,24 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_IMPORT_EXP)) {
+        return pfnImportExp(hContext, pMem, size);
+    }
+
     ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_IMPORT_EXP,
                                                    "urUSMImportExp", &params);
 
-    getContext()->logger.info("---> urUSMImportExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMImportExp");
 
     ur_result_t result = pfnImportExp(hContext, pMem, size);
 
     getContext()->notify_end(UR_FUNCTION_USM_IMPORT_EXP, "urUSMImportExp",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_IMPORT_EXP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_IMPORT_EXP, &params}, result);
 
     return result;
 }
@@ -7847,21 +8856,24 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_RELEASE_EXP)) {
+        return pfnReleaseExp(hContext, pMem);
+    }
+
     ur_usm_release_exp_params_t params = {&hContext, &pMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_RELEASE_EXP,
                                                    "urUSMReleaseExp", &params);
 
-    getContext()->logger.info("---> urUSMReleaseExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUSMReleaseExp");
 
     ur_result_t result = pfnReleaseExp(hContext, pMem);
 
     getContext()->notify_end(UR_FUNCTION_USM_RELEASE_EXP, "urUSMReleaseExp",
                              &params, &result, instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_RELEASE_EXP,
-                                    &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info("({}) -> {};\n",
+                params_printer_t{UR_FUNCTION_USM_RELEASE_EXP, &params}, result);
 
     return result;
 }
@@ -7880,13 +8892,18 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP)) {
+        return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    }
+
     ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
                                                          &peerDevice};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
                                    "urUsmP2PEnablePeerAccessExp", &params);
 
-    getContext()->logger.info("---> urUsmP2PEnablePeerAccessExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUsmP2PEnablePeerAccessExp");
 
     ur_result_t result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
 
@@ -7894,10 +8911,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
                              "urUsmP2PEnablePeerAccessExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP, &params},
+        result);
 
     return result;
 }
@@ -7916,13 +8933,18 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP)) {
+        return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    }
+
     ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
                                                           &peerDevice};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
                                    "urUsmP2PDisablePeerAccessExp", &params);
 
-    getContext()->logger.info("---> urUsmP2PDisablePeerAccessExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUsmP2PDisablePeerAccessExp");
 
     ur_result_t result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
 
@@ -7930,10 +8952,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
                              "urUsmP2PDisablePeerAccessExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP, &params},
+        result);
 
     return result;
 }
@@ -7963,6 +8985,11 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP)) {
+        return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
+                                       propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_usm_p2p_peer_access_get_info_exp_params_t params = {
         &commandDevice, &peerDevice, &propName,
         &propSize,      &pPropValue, &pPropSizeRet};
@@ -7970,7 +8997,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         getContext()->notify_begin(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
                                    "urUsmP2PPeerAccessGetInfoExp", &params);
 
-    getContext()->logger.info("---> urUsmP2PPeerAccessGetInfoExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urUsmP2PPeerAccessGetInfoExp");
 
     ur_result_t result =
         pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName, propSize,
@@ -7980,10 +9008,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
                              "urUsmP2PPeerAccessGetInfoExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP, &params},
+        result);
 
     return result;
 }
@@ -8020,6 +9048,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP)) {
+        return pfnNativeCommandExp(hQueue, pfnNativeEnqueue, data,
+                                   numMemsInMemList, phMemList, pProperties,
+                                   numEventsInWaitList, phEventWaitList,
+                                   phEvent);
+    }
+
     ur_enqueue_native_command_exp_params_t params = {&hQueue,
                                                      &pfnNativeEnqueue,
                                                      &data,
@@ -8033,7 +9068,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         getContext()->notify_begin(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
                                    "urEnqueueNativeCommandExp", &params);
 
-    getContext()->logger.info("---> urEnqueueNativeCommandExp");
+    auto &logger = getContext()->logger;
+    logger.info("---> urEnqueueNativeCommandExp");
 
     ur_result_t result = pfnNativeCommandExp(
         hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
@@ -8043,10 +9079,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
                              "urEnqueueNativeCommandExp", &params, &result,
                              instance);
 
-    std::ostringstream args_str;
-    ur::extras::printFunctionParams(
-        args_str, UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, &params);
-    getContext()->logger.info("({}) -> {};\n", args_str.str(), result);
+    logger.info(
+        "({}) -> {};\n",
+        params_printer_t{UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, &params},
+        result);
 
     return result;
 }
@@ -9347,6 +10383,317 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
 
     ur_tracing_layer::getContext()->codelocData = codelocData;
 
+    initTracing();
+    initTracedFunction(UR_FUNCTION_ADAPTER_GET, "urAdapterGet");
+    initTracedFunction(UR_FUNCTION_ADAPTER_RELEASE, "urAdapterRelease");
+    initTracedFunction(UR_FUNCTION_ADAPTER_RETAIN, "urAdapterRetain");
+    initTracedFunction(UR_FUNCTION_ADAPTER_GET_LAST_ERROR,
+                       "urAdapterGetLastError");
+    initTracedFunction(UR_FUNCTION_ADAPTER_GET_INFO, "urAdapterGetInfo");
+    initTracedFunction(UR_FUNCTION_PLATFORM_GET, "urPlatformGet");
+    initTracedFunction(UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo");
+    initTracedFunction(UR_FUNCTION_PLATFORM_GET_API_VERSION,
+                       "urPlatformGetApiVersion");
+    initTracedFunction(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE,
+                       "urPlatformGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
+                       "urPlatformCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION,
+                       "urPlatformGetBackendOption");
+    initTracedFunction(UR_FUNCTION_DEVICE_GET, "urDeviceGet");
+    initTracedFunction(UR_FUNCTION_DEVICE_GET_INFO, "urDeviceGetInfo");
+    initTracedFunction(UR_FUNCTION_DEVICE_RETAIN, "urDeviceRetain");
+    initTracedFunction(UR_FUNCTION_DEVICE_RELEASE, "urDeviceRelease");
+    initTracedFunction(UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition");
+    initTracedFunction(UR_FUNCTION_DEVICE_SELECT_BINARY,
+                       "urDeviceSelectBinary");
+    initTracedFunction(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE,
+                       "urDeviceGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
+                       "urDeviceCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
+                       "urDeviceGetGlobalTimestamps");
+    initTracedFunction(UR_FUNCTION_CONTEXT_CREATE, "urContextCreate");
+    initTracedFunction(UR_FUNCTION_CONTEXT_RETAIN, "urContextRetain");
+    initTracedFunction(UR_FUNCTION_CONTEXT_RELEASE, "urContextRelease");
+    initTracedFunction(UR_FUNCTION_CONTEXT_GET_INFO, "urContextGetInfo");
+    initTracedFunction(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE,
+                       "urContextGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
+                       "urContextCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
+                       "urContextSetExtendedDeleter");
+    initTracedFunction(UR_FUNCTION_MEM_IMAGE_CREATE, "urMemImageCreate");
+    initTracedFunction(UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate");
+    initTracedFunction(UR_FUNCTION_MEM_RETAIN, "urMemRetain");
+    initTracedFunction(UR_FUNCTION_MEM_RELEASE, "urMemRelease");
+    initTracedFunction(UR_FUNCTION_MEM_BUFFER_PARTITION,
+                       "urMemBufferPartition");
+    initTracedFunction(UR_FUNCTION_MEM_GET_NATIVE_HANDLE,
+                       "urMemGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
+                       "urMemBufferCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
+                       "urMemImageCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_MEM_GET_INFO, "urMemGetInfo");
+    initTracedFunction(UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo");
+    initTracedFunction(UR_FUNCTION_SAMPLER_CREATE, "urSamplerCreate");
+    initTracedFunction(UR_FUNCTION_SAMPLER_RETAIN, "urSamplerRetain");
+    initTracedFunction(UR_FUNCTION_SAMPLER_RELEASE, "urSamplerRelease");
+    initTracedFunction(UR_FUNCTION_SAMPLER_GET_INFO, "urSamplerGetInfo");
+    initTracedFunction(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE,
+                       "urSamplerGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
+                       "urSamplerCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_USM_HOST_ALLOC, "urUSMHostAlloc");
+    initTracedFunction(UR_FUNCTION_USM_DEVICE_ALLOC, "urUSMDeviceAlloc");
+    initTracedFunction(UR_FUNCTION_USM_SHARED_ALLOC, "urUSMSharedAlloc");
+    initTracedFunction(UR_FUNCTION_USM_FREE, "urUSMFree");
+    initTracedFunction(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO,
+                       "urUSMGetMemAllocInfo");
+    initTracedFunction(UR_FUNCTION_USM_POOL_CREATE, "urUSMPoolCreate");
+    initTracedFunction(UR_FUNCTION_USM_POOL_RETAIN, "urUSMPoolRetain");
+    initTracedFunction(UR_FUNCTION_USM_POOL_RELEASE, "urUSMPoolRelease");
+    initTracedFunction(UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
+                       "urVirtualMemGranularityGetInfo");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_FREE, "urVirtualMemFree");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_MAP, "urVirtualMemMap");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS,
+                       "urVirtualMemSetAccess");
+    initTracedFunction(UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo");
+    initTracedFunction(UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate");
+    initTracedFunction(UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain");
+    initTracedFunction(UR_FUNCTION_PHYSICAL_MEM_RELEASE,
+                       "urPhysicalMemRelease");
+    initTracedFunction(UR_FUNCTION_PROGRAM_CREATE_WITH_IL,
+                       "urProgramCreateWithIL");
+    initTracedFunction(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY,
+                       "urProgramCreateWithBinary");
+    initTracedFunction(UR_FUNCTION_PROGRAM_BUILD, "urProgramBuild");
+    initTracedFunction(UR_FUNCTION_PROGRAM_COMPILE, "urProgramCompile");
+    initTracedFunction(UR_FUNCTION_PROGRAM_LINK, "urProgramLink");
+    initTracedFunction(UR_FUNCTION_PROGRAM_RETAIN, "urProgramRetain");
+    initTracedFunction(UR_FUNCTION_PROGRAM_RELEASE, "urProgramRelease");
+    initTracedFunction(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
+                       "urProgramGetFunctionPointer");
+    initTracedFunction(UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
+                       "urProgramGetGlobalVariablePointer");
+    initTracedFunction(UR_FUNCTION_PROGRAM_GET_INFO, "urProgramGetInfo");
+    initTracedFunction(UR_FUNCTION_PROGRAM_GET_BUILD_INFO,
+                       "urProgramGetBuildInfo");
+    initTracedFunction(UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
+                       "urProgramSetSpecializationConstants");
+    initTracedFunction(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE,
+                       "urProgramGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
+                       "urProgramCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_KERNEL_CREATE, "urKernelCreate");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal");
+    initTracedFunction(UR_FUNCTION_KERNEL_GET_INFO, "urKernelGetInfo");
+    initTracedFunction(UR_FUNCTION_KERNEL_GET_GROUP_INFO,
+                       "urKernelGetGroupInfo");
+    initTracedFunction(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO,
+                       "urKernelGetSubGroupInfo");
+    initTracedFunction(UR_FUNCTION_KERNEL_RETAIN, "urKernelRetain");
+    initTracedFunction(UR_FUNCTION_KERNEL_RELEASE, "urKernelRelease");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_ARG_POINTER,
+                       "urKernelSetArgPointer");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER,
+                       "urKernelSetArgSampler");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ,
+                       "urKernelSetArgMemObj");
+    initTracedFunction(UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
+                       "urKernelSetSpecializationConstants");
+    initTracedFunction(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE,
+                       "urKernelGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
+                       "urKernelCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
+                       "urKernelGetSuggestedLocalWorkSize");
+    initTracedFunction(UR_FUNCTION_QUEUE_GET_INFO, "urQueueGetInfo");
+    initTracedFunction(UR_FUNCTION_QUEUE_CREATE, "urQueueCreate");
+    initTracedFunction(UR_FUNCTION_QUEUE_RETAIN, "urQueueRetain");
+    initTracedFunction(UR_FUNCTION_QUEUE_RELEASE, "urQueueRelease");
+    initTracedFunction(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE,
+                       "urQueueGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
+                       "urQueueCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_QUEUE_FINISH, "urQueueFinish");
+    initTracedFunction(UR_FUNCTION_QUEUE_FLUSH, "urQueueFlush");
+    initTracedFunction(UR_FUNCTION_EVENT_GET_INFO, "urEventGetInfo");
+    initTracedFunction(UR_FUNCTION_EVENT_GET_PROFILING_INFO,
+                       "urEventGetProfilingInfo");
+    initTracedFunction(UR_FUNCTION_EVENT_WAIT, "urEventWait");
+    initTracedFunction(UR_FUNCTION_EVENT_RETAIN, "urEventRetain");
+    initTracedFunction(UR_FUNCTION_EVENT_RELEASE, "urEventRelease");
+    initTracedFunction(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE,
+                       "urEventGetNativeHandle");
+    initTracedFunction(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
+                       "urEventCreateWithNativeHandle");
+    initTracedFunction(UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
+                       "urEnqueueKernelLaunch");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+                       "urEnqueueEventsWaitWithBarrier");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                       "urEnqueueMemBufferRead");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
+                       "urEnqueueMemBufferWrite");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
+                       "urEnqueueMemBufferReadRect");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+                       "urEnqueueMemBufferWriteRect");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY,
+                       "urEnqueueMemBufferCopy");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
+                       "urEnqueueMemBufferCopyRect");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL,
+                       "urEnqueueMemBufferFill");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ,
+                       "urEnqueueMemImageRead");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE,
+                       "urEnqueueMemImageWrite");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY,
+                       "urEnqueueMemImageCopy");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP,
+                       "urEnqueueMemBufferMap");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_USM_FILL, "urEnqueueUSMFill");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_USM_PREFETCH,
+                       "urEnqueueUSMPrefetch");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D,
+                       "urEnqueueUSMMemcpy2D");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+                       "urEnqueueDeviceGlobalVariableWrite");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+                       "urEnqueueDeviceGlobalVariableRead");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE,
+                       "urEnqueueReadHostPipe");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE,
+                       "urEnqueueWriteHostPipe");
+    initTracedFunction(UR_FUNCTION_USM_PITCHED_ALLOC_EXP,
+                       "urUSMPitchedAllocExp");
+    initTracedFunction(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+        "urBindlessImagesUnsampledImageHandleDestroyExp");
+    initTracedFunction(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+        "urBindlessImagesSampledImageHandleDestroyExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
+                       "urBindlessImagesImageAllocateExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
+                       "urBindlessImagesImageFreeExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
+                       "urBindlessImagesUnsampledImageCreateExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
+                       "urBindlessImagesSampledImageCreateExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
+                       "urBindlessImagesImageCopyExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
+                       "urBindlessImagesImageGetInfoExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
+                       "urBindlessImagesMipmapGetLevelExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
+                       "urBindlessImagesMipmapFreeExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
+                       "urBindlessImagesImportExternalMemoryExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
+                       "urBindlessImagesMapExternalArrayExp");
+    initTracedFunction(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
+        "urBindlessImagesMapExternalLinearMemoryExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
+                       "urBindlessImagesReleaseExternalMemoryExp");
+    initTracedFunction(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesImportExternalSemaphoreExp");
+    initTracedFunction(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesReleaseExternalSemaphoreExp");
+    initTracedFunction(UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
+                       "urBindlessImagesWaitExternalSemaphoreExp");
+    initTracedFunction(
+        UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesSignalExternalSemaphoreExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP,
+                       "urCommandBufferCreateExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP,
+                       "urCommandBufferRetainExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP,
+                       "urCommandBufferReleaseExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP,
+                       "urCommandBufferFinalizeExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
+                       "urCommandBufferAppendKernelLaunchExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
+                       "urCommandBufferAppendUSMMemcpyExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
+                       "urCommandBufferAppendUSMFillExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
+                       "urCommandBufferAppendMemBufferCopyExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
+                       "urCommandBufferAppendMemBufferWriteExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
+                       "urCommandBufferAppendMemBufferReadExp");
+    initTracedFunction(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
+        "urCommandBufferAppendMemBufferCopyRectExp");
+    initTracedFunction(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
+        "urCommandBufferAppendMemBufferWriteRectExp");
+    initTracedFunction(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
+        "urCommandBufferAppendMemBufferReadRectExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
+                       "urCommandBufferAppendMemBufferFillExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
+                       "urCommandBufferAppendUSMPrefetchExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
+                       "urCommandBufferAppendUSMAdviseExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
+                       "urCommandBufferEnqueueExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
+                       "urCommandBufferRetainCommandExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
+                       "urCommandBufferReleaseCommandExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
+                       "urCommandBufferUpdateKernelLaunchExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP,
+                       "urCommandBufferGetInfoExp");
+    initTracedFunction(UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
+                       "urCommandBufferCommandGetInfoExp");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+                       "urEnqueueCooperativeKernelLaunchExp");
+    initTracedFunction(
+        UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
+        "urKernelSuggestMaxCooperativeGroupCountExp");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
+                       "urEnqueueTimestampRecordingExp");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
+                       "urEnqueueKernelLaunchCustomExp");
+    initTracedFunction(UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp");
+    initTracedFunction(UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp");
+    initTracedFunction(UR_FUNCTION_PROGRAM_LINK_EXP, "urProgramLinkExp");
+    initTracedFunction(UR_FUNCTION_USM_IMPORT_EXP, "urUSMImportExp");
+    initTracedFunction(UR_FUNCTION_USM_RELEASE_EXP, "urUSMReleaseExp");
+    initTracedFunction(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+                       "urUsmP2PEnablePeerAccessExp");
+    initTracedFunction(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+                       "urUsmP2PDisablePeerAccessExp");
+    initTracedFunction(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+                       "urUsmP2PPeerAccessGetInfoExp");
+    initTracedFunction(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
+                       "urEnqueueNativeCommandExp");
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_tracing_layer::urGetGlobalProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Global);
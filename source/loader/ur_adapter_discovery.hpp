@@ -0,0 +1,236 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#ifndef UR_ADAPTER_DISCOVERY_HPP
+#define UR_ADAPTER_DISCOVERY_HPP 1
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "logger/ur_logger.hpp"
+#include "ur_adapter_search.hpp"
+#include "ur_util.hpp"
+
+namespace ur_loader {
+
+/// @brief The backend implemented by an adapter library, taken from its file
+///        name: "cuda" for libur_adapter_cuda.so.0 or ur_adapter_cuda.dll.
+///        Empty when the file isn't named like the adapters are.
+inline std::string adapterBackendName(const fs::path &path) {
+    static constexpr char prefix[] = "ur_adapter_";
+    std::string name = path.filename().string();
+    auto begin = name.find(prefix);
+    if (begin == std::string::npos) {
+        return {};
+    }
+    begin += sizeof(prefix) - 1;
+    auto end = name.find('.', begin);
+    return name.substr(begin, end == std::string::npos ? end : end - begin);
+}
+
+/// @brief Whether the devices of backend can be selected by the
+///        ONEAPI_DEVICE_SELECTOR terms in \p ods, so that its adapter has to be
+///        loaded.
+///        This only rules out backends which no term accepts, or which a term
+///        discards entirely, urDeviceGetSelected does the actual selection.
+///        Adapters which aren't named after a known backend are always needed.
+inline bool isBackendSelected(const std::string &backend,
+                              const std::optional<EnvVarMap> &ods) {
+    static constexpr std::array<const char *, 5> knownBackends{
+        "level_zero", "opencl", "cuda", "hip", "native_cpu"};
+    if (!ods.has_value() ||
+        std::find(knownBackends.begin(), knownBackends.end(), backend) ==
+            knownBackends.end()) {
+        return true;
+    }
+
+    auto matches = [&backend](std::string term) {
+        std::transform(term.begin(), term.end(), term.begin(), [](char c) {
+            return static_cast<char>(
+                std::tolower(static_cast<unsigned char>(c)));
+        });
+        return term == "*" || term == backend;
+    };
+
+    bool hasAcceptTerm = false;
+    bool accepted = false;
+    for (const auto &[key, filters] : ods.value()) {
+        if (key.empty()) {
+            continue;
+        }
+        if (key.front() != '!') {
+            hasAcceptTerm = true;
+            accepted = accepted || matches(key);
+        } else if (matches(key.substr(1)) &&
+                   std::find(filters.begin(), filters.end(), "*") !=
+                       filters.end()) {
+            // "!backend:*" discards every root device of the backend.
+            return false;
+        }
+    }
+
+    // Discard terms alone accept all the other devices.
+    return accepted || !hasAcceptTerm;
+}
+
+/// @brief Remembers, across runs, the adapters which couldn't be loaded from
+///        any of their candidate paths, so that they aren't probed again.
+///
+///        An entry only stands for the same candidate paths and library search
+///        path, with the candidates given as full paths unchanged since. For
+///        candidates given as bare names, which the OS searches for, it also
+///        stands for the directories searched being unchanged, so that
+///        installing the adapter there drops the entry. Directories named by
+///        the run paths of the loading binaries aren't watched. Deleting the
+///        cache file makes the loader probe all the adapters again.
+class AdapterDiscoveryCache {
+  public:
+    explicit AdapterDiscoveryCache(fs::path file) : file(std::move(file)) {
+        std::ifstream in(this->file);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (!line.empty() && line.front() != '#') {
+                absent.insert(line);
+            }
+        }
+    }
+
+    bool isKnownAbsent(const std::vector<fs::path> &candidates) const {
+        return absent.count(key(candidates)) != 0;
+    }
+
+    void update(const std::vector<fs::path> &candidates, bool isAbsent) {
+        auto entry = key(candidates);
+        bool changed = isAbsent ? absent.insert(entry).second
+                                : absent.erase(entry) != 0;
+        modified = modified || changed;
+    }
+
+    /// @brief Writes the cache back if it has changed, failures only lose the
+    ///        cache.
+    void save() {
+        if (!modified) {
+            return;
+        }
+        std::error_code ec;
+        if (file.has_parent_path()) {
+            fs::create_directories(file.parent_path(), ec);
+        }
+        // Written aside and renamed, so that concurrent processes never read
+        // a partial file.
+        auto tmp = file;
+        tmp += ".tmp" + std::to_string(std::random_device{}());
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            out << "# Adapters the unified runtime loader couldn't load\n";
+            for (const auto &entry : absent) {
+                out << entry << "\n";
+            }
+            if (!out) {
+                logger::warning("couldn't write the adapter discovery cache {}",
+                                file.string());
+                fs::remove(tmp, ec);
+                return;
+            }
+        }
+        fs::rename(tmp, file, ec);
+        if (ec) {
+            logger::warning("couldn't write the adapter discovery cache {}",
+                            file.string());
+            fs::remove(tmp, ec);
+            return;
+        }
+        modified = false;
+    }
+
+  private:
+#ifdef _WIN32
+    static constexpr const char *searchPathVar = "PATH";
+    static constexpr char searchPathSeparator = ';';
+#else
+    static constexpr const char *searchPathVar = "LD_LIBRARY_PATH";
+    static constexpr char searchPathSeparator = ':';
+#endif
+
+    /// @brief Appends the modification time of path to entry, or a marker if
+    ///        it doesn't exist, so that creating or replacing the file or
+    ///        adding files to the directory changes the entry.
+    static void appendWriteTime(std::string &entry, const fs::path &path) {
+        std::error_code ec;
+        auto time = fs::last_write_time(path, ec);
+        entry += ec ? std::string("@-")
+                    : "@" + std::to_string(time.time_since_epoch().count());
+    }
+
+    /// @brief The files and directories the OS looks at when loading a
+    ///        library by its bare name.
+    static std::vector<fs::path> librarySearchPaths() {
+#ifdef _WIN32
+        std::vector<fs::path> paths;
+        if (auto systemRoot = ur_getenv("SystemRoot")) {
+            paths.emplace_back(fs::path(*systemRoot) / "System32");
+        }
+#else
+        // ldconfig rewrites its cache when libraries are installed in the
+        // directories it lists.
+        std::vector<fs::path> paths{"/etc/ld.so.cache", "/lib", "/usr/lib",
+                                    "/lib64", "/usr/lib64"};
+#endif
+        auto value = ur_getenv(searchPathVar).value_or("");
+        size_t begin = 0;
+        while (begin <= value.size()) {
+            auto end = value.find(searchPathSeparator, begin);
+            if (end == std::string::npos) {
+                end = value.size();
+            }
+            if (end != begin) {
+                paths.emplace_back(value.substr(begin, end - begin));
+            }
+            begin = end + 1;
+        }
+        return paths;
+    }
+
+    static std::string key(const std::vector<fs::path> &candidates) {
+        std::string entry;
+        bool searched = false;
+        for (const auto &path : candidates) {
+            entry += path.string();
+            if (path.is_absolute()) {
+                appendWriteTime(entry, path);
+            } else {
+                searched = true;
+            }
+            entry += ";";
+        }
+        entry += "|" + ur_getenv(searchPathVar).value_or("");
+        if (searched) {
+            for (const auto &path : librarySearchPaths()) {
+                entry += "|" + path.string();
+                appendWriteTime(entry, path);
+            }
+        }
+        return entry;
+    }
+
+    fs::path file;
+    std::set<std::string> absent;
+    bool modified = false;
+};
+
+} // namespace ur_loader
+
+#endif // UR_ADAPTER_DISCOVERY_HPP
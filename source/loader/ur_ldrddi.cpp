@@ -32,6 +32,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 
     [[maybe_unused]] auto context = getContext();
 
+    // Opens the adapters now if their loading was deferred.
+    context->loadLazyAdapters();
+
     size_t adapterIndex = 0;
     if (nullptr != phAdapters && NumEntries != 0) {
         for (auto &platform : context->platforms) {
@@ -73,14 +76,14 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnAdapterRelease = dditable->ur.Global.pfnAdapterRelease;
     if (nullptr == pfnAdapterRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // forward to device-platform
     result = pfnAdapterRelease(hAdapter);
@@ -98,14 +101,14 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnAdapterRetain = dditable->ur.Global.pfnAdapterRetain;
     if (nullptr == pfnAdapterRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // forward to device-platform
     result = pfnAdapterRetain(hAdapter);
@@ -129,14 +132,14 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnAdapterGetLastError = dditable->ur.Global.pfnAdapterGetLastError;
     if (nullptr == pfnAdapterGetLastError) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // forward to device-platform
     result = pfnAdapterGetLastError(hAdapter, ppMessage, pError);
@@ -164,14 +167,14 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnAdapterGetInfo = dditable->ur.Global.pfnAdapterGetInfo;
     if (nullptr == pfnAdapterGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // forward to device-platform
     result = pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
@@ -207,8 +210,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
          adapter_index++) {
         // extract adapter's function pointer table
         auto dditable =
-            reinterpret_cast<ur_platform_object_t *>(phAdapters[adapter_index])
-                ->dditable;
+            ur_adapter_object_t::getDditable(phAdapters[adapter_index]);
 
         if ((0 < NumEntries) && (NumEntries == total_platform_handle_count)) {
             break;
@@ -279,15 +281,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_platform_object_t *>(hPlatform)->dditable;
+    auto dditable = ur_platform_object_t::getDditable(hPlatform);
     auto pfnGetInfo = dditable->ur.Platform.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPlatform = reinterpret_cast<ur_platform_object_t *>(hPlatform)->handle;
+    hPlatform = ur_platform_object_t::getHandle(hPlatform);
 
     // forward to device-platform
     result =
@@ -307,15 +308,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_platform_object_t *>(hPlatform)->dditable;
+    auto dditable = ur_platform_object_t::getDditable(hPlatform);
     auto pfnGetApiVersion = dditable->ur.Platform.pfnGetApiVersion;
     if (nullptr == pfnGetApiVersion) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPlatform = reinterpret_cast<ur_platform_object_t *>(hPlatform)->handle;
+    hPlatform = ur_platform_object_t::getHandle(hPlatform);
 
     // forward to device-platform
     result = pfnGetApiVersion(hPlatform, pVersion);
@@ -335,15 +335,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_platform_object_t *>(hPlatform)->dditable;
+    auto dditable = ur_platform_object_t::getDditable(hPlatform);
     auto pfnGetNativeHandle = dditable->ur.Platform.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPlatform = reinterpret_cast<ur_platform_object_t *>(hPlatform)->handle;
+    hPlatform = ur_platform_object_t::getHandle(hPlatform);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hPlatform, phNativePlatform);
@@ -372,7 +371,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Platform.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -380,7 +379,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
@@ -417,15 +416,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_platform_object_t *>(hPlatform)->dditable;
+    auto dditable = ur_platform_object_t::getDditable(hPlatform);
     auto pfnGetBackendOption = dditable->ur.Platform.pfnGetBackendOption;
     if (nullptr == pfnGetBackendOption) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPlatform = reinterpret_cast<ur_platform_object_t *>(hPlatform)->handle;
+    hPlatform = ur_platform_object_t::getHandle(hPlatform);
 
     // forward to device-platform
     result = pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
@@ -455,15 +453,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_platform_object_t *>(hPlatform)->dditable;
+    auto dditable = ur_platform_object_t::getDditable(hPlatform);
     auto pfnGet = dditable->ur.Device.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPlatform = reinterpret_cast<ur_platform_object_t *>(hPlatform)->handle;
+    hPlatform = ur_platform_object_t::getHandle(hPlatform);
 
     // forward to device-platform
     result = pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
@@ -507,14 +504,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnGetInfo = dditable->ur.Device.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -602,14 +599,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnRetain = dditable->ur.Device.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnRetain(hDevice);
@@ -628,14 +625,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnRelease = dditable->ur.Device.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnRelease(hDevice);
@@ -663,14 +660,14 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnPartition = dditable->ur.Device.pfnPartition;
     if (nullptr == pfnPartition) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
@@ -713,14 +710,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnSelectBinary = dditable->ur.Device.pfnSelectBinary;
     if (nullptr == pfnSelectBinary) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
@@ -740,14 +737,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnGetNativeHandle = dditable->ur.Device.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hDevice, phNativeDevice);
@@ -776,7 +773,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Device.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -784,7 +781,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativeDevice, hAdapter, pProperties,
@@ -822,14 +819,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnGetGlobalTimestamps = dditable->ur.Device.pfnGetGlobalTimestamps;
     if (nullptr == pfnGetGlobalTimestamps) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
@@ -853,18 +850,16 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(*phDevices)->dditable;
+    auto dditable = ur_device_object_t::getDditable(*phDevices);
     auto pfnCreate = dditable->ur.Context.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(DeviceCount);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(DeviceCount);
     for (size_t i = 0; i < DeviceCount; ++i) {
-        phDevicesLocal[i] =
-            reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
+        phDevicesLocal[i] = ur_device_object_t::getHandle(phDevices[i]);
     }
 
     // forward to device-platform
@@ -898,14 +893,14 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnRetain = dditable->ur.Context.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnRetain(hContext);
@@ -924,14 +919,14 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnRelease = dditable->ur.Context.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnRelease(hContext);
@@ -961,14 +956,14 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnGetInfo = dditable->ur.Context.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -1021,14 +1016,14 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnGetNativeHandle = dditable->ur.Context.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hContext, phNativeContext);
@@ -1061,7 +1056,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto dditable = ur_adapter_object_t::getDditable(hAdapter);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Context.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -1069,13 +1064,12 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
+    hAdapter = ur_adapter_object_t::getHandle(hAdapter);
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
-        phDevicesLocal[i] =
-            reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
+        phDevicesLocal[i] = ur_device_object_t::getHandle(phDevices[i]);
     }
 
     // forward to device-platform
@@ -1113,14 +1107,14 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnSetExtendedDeleter = dditable->ur.Context.pfnSetExtendedDeleter;
     if (nullptr == pfnSetExtendedDeleter) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
@@ -1144,14 +1138,14 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImageCreate = dditable->ur.Mem.pfnImageCreate;
     if (nullptr == pfnImageCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result =
@@ -1188,14 +1182,14 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnBufferCreate = dditable->ur.Mem.pfnBufferCreate;
     if (nullptr == pfnBufferCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
@@ -1226,14 +1220,14 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_mem_object_t *>(hMem)->dditable;
+    auto dditable = ur_mem_object_t::getDditable(hMem);
     auto pfnRetain = dditable->ur.Mem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hMem = reinterpret_cast<ur_mem_object_t *>(hMem)->handle;
+    hMem = ur_mem_object_t::getHandle(hMem);
 
     // forward to device-platform
     result = pfnRetain(hMem);
@@ -1252,14 +1246,14 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_mem_object_t *>(hMem)->dditable;
+    auto dditable = ur_mem_object_t::getDditable(hMem);
     auto pfnRelease = dditable->ur.Mem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hMem = reinterpret_cast<ur_mem_object_t *>(hMem)->handle;
+    hMem = ur_mem_object_t::getHandle(hMem);
 
     // forward to device-platform
     result = pfnRelease(hMem);
@@ -1284,14 +1278,14 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_mem_object_t *>(hBuffer)->dditable;
+    auto dditable = ur_mem_object_t::getDditable(hBuffer);
     auto pfnBufferPartition = dditable->ur.Mem.pfnBufferPartition;
     if (nullptr == pfnBufferPartition) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // forward to device-platform
     result =
@@ -1327,19 +1321,17 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_mem_object_t *>(hMem)->dditable;
+    auto dditable = ur_mem_object_t::getDditable(hMem);
     auto pfnGetNativeHandle = dditable->ur.Mem.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hMem = reinterpret_cast<ur_mem_object_t *>(hMem)->handle;
+    hMem = ur_mem_object_t::getHandle(hMem);
 
     // convert loader handle to platform handle
-    hDevice = (hDevice)
-                  ? reinterpret_cast<ur_device_object_t *>(hDevice)->handle
-                  : nullptr;
+    hDevice = (hDevice) ? ur_device_object_t::getHandle(hDevice) : nullptr;
 
     // forward to device-platform
     result = pfnGetNativeHandle(hMem, hDevice, phNativeMem);
@@ -1367,7 +1359,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnBufferCreateWithNativeHandle =
         dditable->ur.Mem.pfnBufferCreateWithNativeHandle;
     if (nullptr == pfnBufferCreateWithNativeHandle) {
@@ -1375,7 +1367,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnBufferCreateWithNativeHandle(hNativeMem, hContext, pProperties,
@@ -1415,7 +1407,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImageCreateWithNativeHandle =
         dditable->ur.Mem.pfnImageCreateWithNativeHandle;
     if (nullptr == pfnImageCreateWithNativeHandle) {
@@ -1423,7 +1415,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnImageCreateWithNativeHandle(hNativeMem, hContext, pImageFormat,
@@ -1466,14 +1458,14 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_mem_object_t *>(hMemory)->dditable;
+    auto dditable = ur_mem_object_t::getDditable(hMemory);
     auto pfnGetInfo = dditable->ur.Mem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hMemory = reinterpret_cast<ur_mem_object_t *>(hMemory)->handle;
+    hMemory = ur_mem_object_t::getHandle(hMemory);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -1535,14 +1527,14 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_mem_object_t *>(hMemory)->dditable;
+    auto dditable = ur_mem_object_t::getDditable(hMemory);
     auto pfnImageGetInfo = dditable->ur.Mem.pfnImageGetInfo;
     if (nullptr == pfnImageGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hMemory = reinterpret_cast<ur_mem_object_t *>(hMemory)->handle;
+    hMemory = ur_mem_object_t::getHandle(hMemory);
 
     // forward to device-platform
     result =
@@ -1564,14 +1556,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreate = dditable->ur.Sampler.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnCreate(hContext, pDesc, phSampler);
@@ -1603,14 +1595,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_sampler_object_t *>(hSampler)->dditable;
+    auto dditable = ur_sampler_object_t::getDditable(hSampler);
     auto pfnRetain = dditable->ur.Sampler.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hSampler = reinterpret_cast<ur_sampler_object_t *>(hSampler)->handle;
+    hSampler = ur_sampler_object_t::getHandle(hSampler);
 
     // forward to device-platform
     result = pfnRetain(hSampler);
@@ -1629,14 +1621,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_sampler_object_t *>(hSampler)->dditable;
+    auto dditable = ur_sampler_object_t::getDditable(hSampler);
     auto pfnRelease = dditable->ur.Sampler.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hSampler = reinterpret_cast<ur_sampler_object_t *>(hSampler)->handle;
+    hSampler = ur_sampler_object_t::getHandle(hSampler);
 
     // forward to device-platform
     result = pfnRelease(hSampler);
@@ -1662,14 +1654,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_sampler_object_t *>(hSampler)->dditable;
+    auto dditable = ur_sampler_object_t::getDditable(hSampler);
     auto pfnGetInfo = dditable->ur.Sampler.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hSampler = reinterpret_cast<ur_sampler_object_t *>(hSampler)->handle;
+    hSampler = ur_sampler_object_t::getHandle(hSampler);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -1722,14 +1714,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_sampler_object_t *>(hSampler)->dditable;
+    auto dditable = ur_sampler_object_t::getDditable(hSampler);
     auto pfnGetNativeHandle = dditable->ur.Sampler.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hSampler = reinterpret_cast<ur_sampler_object_t *>(hSampler)->handle;
+    hSampler = ur_sampler_object_t::getHandle(hSampler);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hSampler, phNativeSampler);
@@ -1757,7 +1749,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Sampler.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -1765,7 +1757,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
@@ -1804,18 +1796,17 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnHostAlloc = dditable->ur.USM.pfnHostAlloc;
     if (nullptr == pfnHostAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    pool = (pool) ? reinterpret_cast<ur_usm_pool_object_t *>(pool)->handle
-                  : nullptr;
+    pool = (pool) ? ur_usm_pool_object_t::getHandle(pool) : nullptr;
 
     // forward to device-platform
     result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
@@ -1841,21 +1832,20 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnDeviceAlloc = dditable->ur.USM.pfnDeviceAlloc;
     if (nullptr == pfnDeviceAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    pool = (pool) ? reinterpret_cast<ur_usm_pool_object_t *>(pool)->handle
-                  : nullptr;
+    pool = (pool) ? ur_usm_pool_object_t::getHandle(pool) : nullptr;
 
     // forward to device-platform
     result = pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
@@ -1881,21 +1871,20 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnSharedAlloc = dditable->ur.USM.pfnSharedAlloc;
     if (nullptr == pfnSharedAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    pool = (pool) ? reinterpret_cast<ur_usm_pool_object_t *>(pool)->handle
-                  : nullptr;
+    pool = (pool) ? ur_usm_pool_object_t::getHandle(pool) : nullptr;
 
     // forward to device-platform
     result = pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
@@ -1914,14 +1903,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnFree = dditable->ur.USM.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnFree(hContext, pMem);
@@ -1949,14 +1938,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnGetMemAllocInfo = dditable->ur.USM.pfnGetMemAllocInfo;
     if (nullptr == pfnGetMemAllocInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -2024,14 +2013,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnPoolCreate = dditable->ur.USM.pfnPoolCreate;
     if (nullptr == pfnPoolCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnPoolCreate(hContext, pPoolDesc, ppPool);
@@ -2062,14 +2051,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_usm_pool_object_t *>(pPool)->dditable;
+    auto dditable = ur_usm_pool_object_t::getDditable(pPool);
     auto pfnPoolRetain = dditable->ur.USM.pfnPoolRetain;
     if (nullptr == pfnPoolRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    pPool = reinterpret_cast<ur_usm_pool_object_t *>(pPool)->handle;
+    pPool = ur_usm_pool_object_t::getHandle(pPool);
 
     // forward to device-platform
     result = pfnPoolRetain(pPool);
@@ -2087,14 +2076,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_usm_pool_object_t *>(pPool)->dditable;
+    auto dditable = ur_usm_pool_object_t::getDditable(pPool);
     auto pfnPoolRelease = dditable->ur.USM.pfnPoolRelease;
     if (nullptr == pfnPoolRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    pPool = reinterpret_cast<ur_usm_pool_object_t *>(pPool)->handle;
+    pPool = ur_usm_pool_object_t::getHandle(pPool);
 
     // forward to device-platform
     result = pfnPoolRelease(pPool);
@@ -2119,14 +2108,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_usm_pool_object_t *>(hPool)->dditable;
+    auto dditable = ur_usm_pool_object_t::getDditable(hPool);
     auto pfnPoolGetInfo = dditable->ur.USM.pfnPoolGetInfo;
     if (nullptr == pfnPoolGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPool = reinterpret_cast<ur_usm_pool_object_t *>(hPool)->handle;
+    hPool = ur_usm_pool_object_t::getHandle(hPool);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -2192,19 +2181,17 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnGranularityGetInfo = dditable->ur.VirtualMem.pfnGranularityGetInfo;
     if (nullptr == pfnGranularityGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = (hDevice)
-                  ? reinterpret_cast<ur_device_object_t *>(hDevice)->handle
-                  : nullptr;
+    hDevice = (hDevice) ? ur_device_object_t::getHandle(hDevice) : nullptr;
 
     // forward to device-platform
     result = pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
@@ -2232,14 +2219,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnReserve = dditable->ur.VirtualMem.pfnReserve;
     if (nullptr == pfnReserve) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnReserve(hContext, pStart, size, ppStart);
@@ -2260,14 +2247,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnFree = dditable->ur.VirtualMem.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnFree(hContext, pStart, size);
@@ -2294,18 +2281,17 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnMap = dditable->ur.VirtualMem.pfnMap;
     if (nullptr == pfnMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hPhysicalMem =
-        reinterpret_cast<ur_physical_mem_object_t *>(hPhysicalMem)->handle;
+    hPhysicalMem = ur_physical_mem_object_t::getHandle(hPhysicalMem);
 
     // forward to device-platform
     result = pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
@@ -2326,14 +2312,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnUnmap = dditable->ur.VirtualMem.pfnUnmap;
     if (nullptr == pfnUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnUnmap(hContext, pStart, size);
@@ -2356,14 +2342,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnSetAccess = dditable->ur.VirtualMem.pfnSetAccess;
     if (nullptr == pfnSetAccess) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnSetAccess(hContext, pStart, size, flags);
@@ -2394,14 +2380,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnGetInfo = dditable->ur.VirtualMem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnGetInfo(hContext, pStart, size, propName, propSize, pPropValue,
@@ -2428,17 +2414,17 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreate = dditable->ur.PhysicalMem.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
@@ -2470,16 +2456,14 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_physical_mem_object_t *>(hPhysicalMem)->dditable;
+    auto dditable = ur_physical_mem_object_t::getDditable(hPhysicalMem);
     auto pfnRetain = dditable->ur.PhysicalMem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPhysicalMem =
-        reinterpret_cast<ur_physical_mem_object_t *>(hPhysicalMem)->handle;
+    hPhysicalMem = ur_physical_mem_object_t::getHandle(hPhysicalMem);
 
     // forward to device-platform
     result = pfnRetain(hPhysicalMem);
@@ -2498,16 +2482,14 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_physical_mem_object_t *>(hPhysicalMem)->dditable;
+    auto dditable = ur_physical_mem_object_t::getDditable(hPhysicalMem);
     auto pfnRelease = dditable->ur.PhysicalMem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hPhysicalMem =
-        reinterpret_cast<ur_physical_mem_object_t *>(hPhysicalMem)->handle;
+    hPhysicalMem = ur_physical_mem_object_t::getHandle(hPhysicalMem);
 
     // forward to device-platform
     result = pfnRelease(hPhysicalMem);
@@ -2531,14 +2513,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithIL = dditable->ur.Program.pfnCreateWithIL;
     if (nullptr == pfnCreateWithIL) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
@@ -2577,17 +2559,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithBinary = dditable->ur.Program.pfnCreateWithBinary;
     if (nullptr == pfnCreateWithBinary) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnCreateWithBinary(hContext, hDevice, size, pBinary, pProperties,
@@ -2622,17 +2604,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnBuild = dditable->ur.Program.pfnBuild;
     if (nullptr == pfnBuild) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnBuild(hContext, hProgram, pOptions);
@@ -2654,17 +2636,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCompile = dditable->ur.Program.pfnCompile;
     if (nullptr == pfnCompile) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnCompile(hContext, hProgram, pOptions);
@@ -2692,20 +2674,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnLink = dditable->ur.Program.pfnLink;
     if (nullptr == pfnLink) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = std::vector<ur_program_handle_t>(count);
+    auto phProgramsLocal = handle_list_t<ur_program_handle_t>(count);
     for (size_t i = 0; i < count; ++i) {
-        phProgramsLocal[i] =
-            reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
+        phProgramsLocal[i] = ur_program_object_t::getHandle(phPrograms[i]);
     }
 
     // forward to device-platform
@@ -2737,14 +2718,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnRetain = dditable->ur.Program.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnRetain(hProgram);
@@ -2763,14 +2744,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnRelease = dditable->ur.Program.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnRelease(hProgram);
@@ -2797,17 +2778,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnGetFunctionPointer = dditable->ur.Program.pfnGetFunctionPointer;
     if (nullptr == pfnGetFunctionPointer) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
@@ -2836,7 +2817,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_device_object_t *>(hDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(hDevice);
     auto pfnGetGlobalVariablePointer =
         dditable->ur.Program.pfnGetGlobalVariablePointer;
     if (nullptr == pfnGetGlobalVariablePointer) {
@@ -2844,10 +2825,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     }
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnGetGlobalVariablePointer(hDevice, hProgram, pGlobalVariableName,
@@ -2878,14 +2859,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnGetInfo = dditable->ur.Program.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -2961,17 +2942,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnGetBuildInfo = dditable->ur.Program.pfnGetBuildInfo;
     if (nullptr == pfnGetBuildInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnGetBuildInfo(hProgram, hDevice, propName, propSize, pPropValue,
@@ -2994,7 +2975,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnSetSpecializationConstants =
         dditable->ur.Program.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
@@ -3002,7 +2983,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
@@ -3022,14 +3003,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnGetNativeHandle = dditable->ur.Program.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hProgram, phNativeProgram);
@@ -3057,7 +3038,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Program.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -3065,7 +3046,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
@@ -3100,14 +3081,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnCreate = dditable->ur.Kernel.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // forward to device-platform
     result = pfnCreate(hProgram, pKernelName, phKernel);
@@ -3145,14 +3126,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetArgValue = dditable->ur.Kernel.pfnSetArgValue;
     if (nullptr == pfnSetArgValue) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
@@ -3175,14 +3156,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetArgLocal = dditable->ur.Kernel.pfnSetArgLocal;
     if (nullptr == pfnSetArgLocal) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
@@ -3212,14 +3193,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnGetInfo = dditable->ur.Kernel.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -3292,17 +3273,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnGetGroupInfo = dditable->ur.Kernel.pfnGetGroupInfo;
     if (nullptr == pfnGetGroupInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
@@ -3331,17 +3312,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnGetSubGroupInfo = dditable->ur.Kernel.pfnGetSubGroupInfo;
     if (nullptr == pfnGetSubGroupInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
@@ -3360,14 +3341,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnRetain = dditable->ur.Kernel.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnRetain(hKernel);
@@ -3386,14 +3367,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnRelease = dditable->ur.Kernel.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnRelease(hKernel);
@@ -3417,14 +3398,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetArgPointer = dditable->ur.Kernel.pfnSetArgPointer;
     if (nullptr == pfnSetArgPointer) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
@@ -3449,14 +3430,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetExecInfo = dditable->ur.Kernel.pfnSetExecInfo;
     if (nullptr == pfnSetExecInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result =
@@ -3479,17 +3460,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetArgSampler = dditable->ur.Kernel.pfnSetArgSampler;
     if (nullptr == pfnSetArgSampler) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handle to platform handle
-    hArgValue = reinterpret_cast<ur_sampler_object_t *>(hArgValue)->handle;
+    hArgValue = ur_sampler_object_t::getHandle(hArgValue);
 
     // forward to device-platform
     result = pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
@@ -3511,19 +3492,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetArgMemObj = dditable->ur.Kernel.pfnSetArgMemObj;
     if (nullptr == pfnSetArgMemObj) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handle to platform handle
-    hArgValue = (hArgValue)
-                    ? reinterpret_cast<ur_mem_object_t *>(hArgValue)->handle
-                    : nullptr;
+    hArgValue = (hArgValue) ? ur_mem_object_t::getHandle(hArgValue) : nullptr;
 
     // forward to device-platform
     result = pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
@@ -3544,7 +3523,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSetSpecializationConstants =
         dditable->ur.Kernel.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
@@ -3552,7 +3531,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
@@ -3572,14 +3551,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnGetNativeHandle = dditable->ur.Kernel.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hKernel, phNativeKernel);
@@ -3609,7 +3588,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Kernel.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -3617,12 +3596,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hProgram = (hProgram)
-                   ? reinterpret_cast<ur_program_object_t *>(hProgram)->handle
-                   : nullptr;
+    hProgram = (hProgram) ? ur_program_object_t::getHandle(hProgram) : nullptr;
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
@@ -3668,7 +3645,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnGetSuggestedLocalWorkSize =
         dditable->ur.Kernel.pfnGetSuggestedLocalWorkSize;
     if (nullptr == pfnGetSuggestedLocalWorkSize) {
@@ -3676,10 +3653,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
@@ -3707,14 +3684,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnGetInfo = dditable->ur.Queue.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -3794,17 +3771,17 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreate = dditable->ur.Queue.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnCreate(hContext, hDevice, pProperties, phQueue);
@@ -3836,14 +3813,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnRetain = dditable->ur.Queue.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnRetain(hQueue);
@@ -3862,14 +3839,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnRelease = dditable->ur.Queue.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnRelease(hQueue);
@@ -3891,14 +3868,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnGetNativeHandle = dditable->ur.Queue.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
@@ -3927,7 +3904,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Queue.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -3935,12 +3912,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = (hDevice)
-                  ? reinterpret_cast<ur_device_object_t *>(hDevice)->handle
-                  : nullptr;
+    hDevice = (hDevice) ? ur_device_object_t::getHandle(hDevice) : nullptr;
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
@@ -3972,14 +3947,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnFinish = dditable->ur.Queue.pfnFinish;
     if (nullptr == pfnFinish) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnFinish(hQueue);
@@ -3997,14 +3972,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnFlush = dditable->ur.Queue.pfnFlush;
     if (nullptr == pfnFlush) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnFlush(hQueue);
@@ -4028,14 +4003,14 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto dditable = ur_event_object_t::getDditable(hEvent);
     auto pfnGetInfo = dditable->ur.Event.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+    hEvent = ur_event_object_t::getHandle(hEvent);
 
     // this value is needed for converting adapter handles to loader handles
     size_t sizeret = 0;
@@ -4107,14 +4082,14 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto dditable = ur_event_object_t::getDditable(hEvent);
     auto pfnGetProfilingInfo = dditable->ur.Event.pfnGetProfilingInfo;
     if (nullptr == pfnGetProfilingInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+    hEvent = ur_event_object_t::getHandle(hEvent);
 
     // forward to device-platform
     result = pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
@@ -4136,18 +4111,17 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_event_object_t *>(*phEventWaitList)->dditable;
+    auto dditable = ur_event_object_t::getDditable(*phEventWaitList);
     auto pfnWait = dditable->ur.Event.pfnWait;
     if (nullptr == pfnWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = std::vector<ur_event_handle_t>(numEvents);
+    auto phEventWaitListLocal = handle_list_t<ur_event_handle_t>(numEvents);
     for (size_t i = 0; i < numEvents; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4166,14 +4140,14 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto dditable = ur_event_object_t::getDditable(hEvent);
     auto pfnRetain = dditable->ur.Event.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+    hEvent = ur_event_object_t::getHandle(hEvent);
 
     // forward to device-platform
     result = pfnRetain(hEvent);
@@ -4191,14 +4165,14 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto dditable = ur_event_object_t::getDditable(hEvent);
     auto pfnRelease = dditable->ur.Event.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+    hEvent = ur_event_object_t::getHandle(hEvent);
 
     // forward to device-platform
     result = pfnRelease(hEvent);
@@ -4218,14 +4192,14 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto dditable = ur_event_object_t::getDditable(hEvent);
     auto pfnGetNativeHandle = dditable->ur.Event.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+    hEvent = ur_event_object_t::getHandle(hEvent);
 
     // forward to device-platform
     result = pfnGetNativeHandle(hEvent, phNativeEvent);
@@ -4253,7 +4227,7 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateWithNativeHandle =
         dditable->ur.Event.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4261,7 +4235,7 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result =
@@ -4297,14 +4271,14 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto dditable = ur_event_object_t::getDditable(hEvent);
     auto pfnSetCallback = dditable->ur.Event.pfnSetCallback;
     if (nullptr == pfnSetCallback) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+    hEvent = ur_event_object_t::getHandle(hEvent);
 
     // forward to device-platform
     result = pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
@@ -4348,24 +4322,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnKernelLaunch = dditable->ur.Enqueue.pfnKernelLaunch;
     if (nullptr == pfnKernelLaunch) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4413,21 +4387,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnEventsWait = dditable->ur.Enqueue.pfnEventsWait;
     if (nullptr == pfnEventsWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4473,7 +4447,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnEventsWaitWithBarrier =
         dditable->ur.Enqueue.pfnEventsWaitWithBarrier;
     if (nullptr == pfnEventsWaitWithBarrier) {
@@ -4481,14 +4455,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4539,24 +4513,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferRead = dditable->ur.Enqueue.pfnMemBufferRead;
     if (nullptr == pfnMemBufferRead) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4610,24 +4584,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferWrite = dditable->ur.Enqueue.pfnMemBufferWrite;
     if (nullptr == pfnMemBufferWrite) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4691,24 +4665,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferReadRect = dditable->ur.Enqueue.pfnMemBufferReadRect;
     if (nullptr == pfnMemBufferReadRect) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4776,24 +4750,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferWriteRect = dditable->ur.Enqueue.pfnMemBufferWriteRect;
     if (nullptr == pfnMemBufferWriteRect) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4847,27 +4821,27 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferCopy = dditable->ur.Enqueue.pfnMemBufferCopy;
     if (nullptr == pfnMemBufferCopy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBufferSrc = reinterpret_cast<ur_mem_object_t *>(hBufferSrc)->handle;
+    hBufferSrc = ur_mem_object_t::getHandle(hBufferSrc);
 
     // convert loader handle to platform handle
-    hBufferDst = reinterpret_cast<ur_mem_object_t *>(hBufferDst)->handle;
+    hBufferDst = ur_mem_object_t::getHandle(hBufferDst);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -4929,27 +4903,27 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferCopyRect = dditable->ur.Enqueue.pfnMemBufferCopyRect;
     if (nullptr == pfnMemBufferCopyRect) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBufferSrc = reinterpret_cast<ur_mem_object_t *>(hBufferSrc)->handle;
+    hBufferSrc = ur_mem_object_t::getHandle(hBufferSrc);
 
     // convert loader handle to platform handle
-    hBufferDst = reinterpret_cast<ur_mem_object_t *>(hBufferDst)->handle;
+    hBufferDst = ur_mem_object_t::getHandle(hBufferDst);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5002,24 +4976,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferFill = dditable->ur.Enqueue.pfnMemBufferFill;
     if (nullptr == pfnMemBufferFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5076,24 +5050,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemImageRead = dditable->ur.Enqueue.pfnMemImageRead;
     if (nullptr == pfnMemImageRead) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hImage = reinterpret_cast<ur_mem_object_t *>(hImage)->handle;
+    hImage = ur_mem_object_t::getHandle(hImage);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5151,24 +5125,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemImageWrite = dditable->ur.Enqueue.pfnMemImageWrite;
     if (nullptr == pfnMemImageWrite) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hImage = reinterpret_cast<ur_mem_object_t *>(hImage)->handle;
+    hImage = ur_mem_object_t::getHandle(hImage);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5227,27 +5201,27 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemImageCopy = dditable->ur.Enqueue.pfnMemImageCopy;
     if (nullptr == pfnMemImageCopy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hImageSrc = reinterpret_cast<ur_mem_object_t *>(hImageSrc)->handle;
+    hImageSrc = ur_mem_object_t::getHandle(hImageSrc);
 
     // convert loader handle to platform handle
-    hImageDst = reinterpret_cast<ur_mem_object_t *>(hImageDst)->handle;
+    hImageDst = ur_mem_object_t::getHandle(hImageDst);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5301,24 +5275,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemBufferMap = dditable->ur.Enqueue.pfnMemBufferMap;
     if (nullptr == pfnMemBufferMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5367,24 +5341,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnMemUnmap = dditable->ur.Enqueue.pfnMemUnmap;
     if (nullptr == pfnMemUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hMem = reinterpret_cast<ur_mem_object_t *>(hMem)->handle;
+    hMem = ur_mem_object_t::getHandle(hMem);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5437,21 +5411,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnUSMFill = dditable->ur.Enqueue.pfnUSMFill;
     if (nullptr == pfnUSMFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5503,21 +5477,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnUSMMemcpy = dditable->ur.Enqueue.pfnUSMMemcpy;
     if (nullptr == pfnUSMMemcpy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5567,21 +5541,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnUSMPrefetch = dditable->ur.Enqueue.pfnUSMPrefetch;
     if (nullptr == pfnUSMPrefetch) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5624,14 +5598,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnUSMAdvise = dditable->ur.Enqueue.pfnUSMAdvise;
     if (nullptr == pfnUSMAdvise) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // forward to device-platform
     result = pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
@@ -5687,21 +5661,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnUSMFill2D = dditable->ur.Enqueue.pfnUSMFill2D;
     if (nullptr == pfnUSMFill2D) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5759,21 +5733,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnUSMMemcpy2D = dditable->ur.Enqueue.pfnUSMMemcpy2D;
     if (nullptr == pfnUSMMemcpy2D) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5828,7 +5802,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnDeviceGlobalVariableWrite =
         dditable->ur.Enqueue.pfnDeviceGlobalVariableWrite;
     if (nullptr == pfnDeviceGlobalVariableWrite) {
@@ -5836,17 +5810,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5901,7 +5875,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnDeviceGlobalVariableRead =
         dditable->ur.Enqueue.pfnDeviceGlobalVariableRead;
     if (nullptr == pfnDeviceGlobalVariableRead) {
@@ -5909,17 +5883,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -5978,24 +5952,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnReadHostPipe = dditable->ur.Enqueue.pfnReadHostPipe;
     if (nullptr == pfnReadHostPipe) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -6054,24 +6028,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnWriteHostPipe = dditable->ur.Enqueue.pfnWriteHostPipe;
     if (nullptr == pfnWriteHostPipe) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -6120,21 +6094,20 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnPitchedAllocExp = dditable->ur.USMExp.pfnPitchedAllocExp;
     if (nullptr == pfnPitchedAllocExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    pool = (pool) ? reinterpret_cast<ur_usm_pool_object_t *>(pool)->handle
-                  : nullptr;
+    pool = (pool) ? ur_usm_pool_object_t::getHandle(pool) : nullptr;
 
     // forward to device-platform
     result = pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
@@ -6157,7 +6130,7 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnUnsampledImageHandleDestroyExp =
         dditable->ur.BindlessImagesExp.pfnUnsampledImageHandleDestroyExp;
     if (nullptr == pfnUnsampledImageHandleDestroyExp) {
@@ -6165,10 +6138,10 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
@@ -6190,7 +6163,7 @@ urBindlessImagesSampledImageHandleDestroyExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnSampledImageHandleDestroyExp =
         dditable->ur.BindlessImagesExp.pfnSampledImageHandleDestroyExp;
     if (nullptr == pfnSampledImageHandleDestroyExp) {
@@ -6198,10 +6171,10 @@ urBindlessImagesSampledImageHandleDestroyExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
@@ -6225,7 +6198,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImageAllocateExp =
         dditable->ur.BindlessImagesExp.pfnImageAllocateExp;
     if (nullptr == pfnImageAllocateExp) {
@@ -6233,10 +6206,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
@@ -6262,17 +6235,17 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImageFreeExp = dditable->ur.BindlessImagesExp.pfnImageFreeExp;
     if (nullptr == pfnImageFreeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnImageFreeExp(hContext, hDevice, hImageMem);
@@ -6298,7 +6271,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnUnsampledImageCreateExp =
         dditable->ur.BindlessImagesExp.pfnUnsampledImageCreateExp;
     if (nullptr == pfnUnsampledImageCreateExp) {
@@ -6306,10 +6279,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
@@ -6341,7 +6314,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnSampledImageCreateExp =
         dditable->ur.BindlessImagesExp.pfnSampledImageCreateExp;
     if (nullptr == pfnSampledImageCreateExp) {
@@ -6349,13 +6322,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hSampler = reinterpret_cast<ur_sampler_object_t *>(hSampler)->handle;
+    hSampler = ur_sampler_object_t::getHandle(hSampler);
 
     // forward to device-platform
     result =
@@ -6402,21 +6375,21 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnImageCopyExp = dditable->ur.BindlessImagesExp.pfnImageCopyExp;
     if (nullptr == pfnImageCopyExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -6458,14 +6431,14 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImageGetInfoExp = dditable->ur.BindlessImagesExp.pfnImageGetInfoExp;
     if (nullptr == pfnImageGetInfoExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnImageGetInfoExp(hContext, hImageMem, propName, pPropValue,
@@ -6490,7 +6463,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnMipmapGetLevelExp =
         dditable->ur.BindlessImagesExp.pfnMipmapGetLevelExp;
     if (nullptr == pfnMipmapGetLevelExp) {
@@ -6498,10 +6471,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
@@ -6527,17 +6500,17 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnMipmapFreeExp = dditable->ur.BindlessImagesExp.pfnMipmapFreeExp;
     if (nullptr == pfnMipmapFreeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnMipmapFreeExp(hContext, hDevice, hMem);
@@ -6563,7 +6536,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImportExternalMemoryExp =
         dditable->ur.BindlessImagesExp.pfnImportExternalMemoryExp;
     if (nullptr == pfnImportExternalMemoryExp) {
@@ -6571,10 +6544,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnImportExternalMemoryExp(hContext, hDevice, size, memHandleType,
@@ -6614,7 +6587,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnMapExternalArrayExp =
         dditable->ur.BindlessImagesExp.pfnMapExternalArrayExp;
     if (nullptr == pfnMapExternalArrayExp) {
@@ -6622,14 +6595,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hExternalMem =
-        reinterpret_cast<ur_exp_external_mem_object_t *>(hExternalMem)->handle;
+    hExternalMem = ur_exp_external_mem_object_t::getHandle(hExternalMem);
 
     // forward to device-platform
     result = pfnMapExternalArrayExp(hContext, hDevice, pImageFormat, pImageDesc,
@@ -6658,7 +6630,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnMapExternalLinearMemoryExp =
         dditable->ur.BindlessImagesExp.pfnMapExternalLinearMemoryExp;
     if (nullptr == pfnMapExternalLinearMemoryExp) {
@@ -6666,14 +6638,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hExternalMem =
-        reinterpret_cast<ur_exp_external_mem_object_t *>(hExternalMem)->handle;
+    hExternalMem = ur_exp_external_mem_object_t::getHandle(hExternalMem);
 
     // forward to device-platform
     result = pfnMapExternalLinearMemoryExp(hContext, hDevice, offset, size,
@@ -6695,7 +6666,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnReleaseExternalMemoryExp =
         dditable->ur.BindlessImagesExp.pfnReleaseExternalMemoryExp;
     if (nullptr == pfnReleaseExternalMemoryExp) {
@@ -6703,14 +6674,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hExternalMem =
-        reinterpret_cast<ur_exp_external_mem_object_t *>(hExternalMem)->handle;
+    hExternalMem = ur_exp_external_mem_object_t::getHandle(hExternalMem);
 
     // forward to device-platform
     result = pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
@@ -6735,7 +6705,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImportExternalSemaphoreExp =
         dditable->ur.BindlessImagesExp.pfnImportExternalSemaphoreExp;
     if (nullptr == pfnImportExternalSemaphoreExp) {
@@ -6743,10 +6713,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result = pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
@@ -6783,7 +6753,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnReleaseExternalSemaphoreExp =
         dditable->ur.BindlessImagesExp.pfnReleaseExternalSemaphoreExp;
     if (nullptr == pfnReleaseExternalSemaphoreExp) {
@@ -6791,15 +6761,14 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // convert loader handle to platform handle
-    hExternalSemaphore = reinterpret_cast<ur_exp_external_semaphore_object_t *>(
-                             hExternalSemaphore)
-                             ->handle;
+    hExternalSemaphore =
+        ur_exp_external_semaphore_object_t::getHandle(hExternalSemaphore);
 
     // forward to device-platform
     result =
@@ -6836,7 +6805,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnWaitExternalSemaphoreExp =
         dditable->ur.BindlessImagesExp.pfnWaitExternalSemaphoreExp;
     if (nullptr == pfnWaitExternalSemaphoreExp) {
@@ -6844,19 +6813,17 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hSemaphore =
-        reinterpret_cast<ur_exp_external_semaphore_object_t *>(hSemaphore)
-            ->handle;
+    hSemaphore = ur_exp_external_semaphore_object_t::getHandle(hSemaphore);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -6910,7 +6877,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnSignalExternalSemaphoreExp =
         dditable->ur.BindlessImagesExp.pfnSignalExternalSemaphoreExp;
     if (nullptr == pfnSignalExternalSemaphoreExp) {
@@ -6918,19 +6885,17 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hSemaphore =
-        reinterpret_cast<ur_exp_external_semaphore_object_t *>(hSemaphore)
-            ->handle;
+    hSemaphore = ur_exp_external_semaphore_object_t::getHandle(hSemaphore);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -6971,17 +6936,17 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnCreateExp = dditable->ur.CommandBufferExp.pfnCreateExp;
     if (nullptr == pfnCreateExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handle to platform handle
-    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+    hDevice = ur_device_object_t::getHandle(hDevice);
 
     // forward to device-platform
     result =
@@ -7014,18 +6979,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnRetainExp = dditable->ur.CommandBufferExp.pfnRetainExp;
     if (nullptr == pfnRetainExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnRetainExp(hCommandBuffer);
@@ -7044,18 +7005,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnReleaseExp = dditable->ur.CommandBufferExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnReleaseExp(hCommandBuffer);
@@ -7074,18 +7031,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnFinalizeExp = dditable->ur.CommandBufferExp.pfnFinalizeExp;
     if (nullptr == pfnFinalizeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnFinalizeExp(hCommandBuffer);
@@ -7121,9 +7074,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendKernelLaunchExp =
         dditable->ur.CommandBufferExp.pfnAppendKernelLaunchExp;
     if (nullptr == pfnAppendKernelLaunchExp) {
@@ -7131,12 +7082,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnAppendKernelLaunchExp(
@@ -7184,9 +7133,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendUSMMemcpyExp =
         dditable->ur.CommandBufferExp.pfnAppendUSMMemcpyExp;
     if (nullptr == pfnAppendUSMMemcpyExp) {
@@ -7194,9 +7141,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
@@ -7229,9 +7174,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendUSMFillExp =
         dditable->ur.CommandBufferExp.pfnAppendUSMFillExp;
     if (nullptr == pfnAppendUSMFillExp) {
@@ -7239,9 +7182,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern, patternSize,
@@ -7274,9 +7215,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferCopyExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferCopyExp;
     if (nullptr == pfnAppendMemBufferCopyExp) {
@@ -7284,15 +7223,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hSrcMem = reinterpret_cast<ur_mem_object_t *>(hSrcMem)->handle;
+    hSrcMem = ur_mem_object_t::getHandle(hSrcMem);
 
     // convert loader handle to platform handle
-    hDstMem = reinterpret_cast<ur_mem_object_t *>(hDstMem)->handle;
+    hDstMem = ur_mem_object_t::getHandle(hDstMem);
 
     // forward to device-platform
     result = pfnAppendMemBufferCopyExp(
@@ -7325,9 +7262,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferWriteExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferWriteExp;
     if (nullptr == pfnAppendMemBufferWriteExp) {
@@ -7335,12 +7270,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // forward to device-platform
     result = pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
@@ -7372,9 +7305,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferReadExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferReadExp;
     if (nullptr == pfnAppendMemBufferReadExp) {
@@ -7382,12 +7313,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // forward to device-platform
     result = pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
@@ -7427,9 +7356,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferCopyRectExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferCopyRectExp;
     if (nullptr == pfnAppendMemBufferCopyRectExp) {
@@ -7437,15 +7364,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hSrcMem = reinterpret_cast<ur_mem_object_t *>(hSrcMem)->handle;
+    hSrcMem = ur_mem_object_t::getHandle(hSrcMem);
 
     // convert loader handle to platform handle
-    hDstMem = reinterpret_cast<ur_mem_object_t *>(hDstMem)->handle;
+    hDstMem = ur_mem_object_t::getHandle(hDstMem);
 
     // forward to device-platform
     result = pfnAppendMemBufferCopyRectExp(
@@ -7492,9 +7417,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferWriteRectExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferWriteRectExp;
     if (nullptr == pfnAppendMemBufferWriteRectExp) {
@@ -7502,12 +7425,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // forward to device-platform
     result = pfnAppendMemBufferWriteRectExp(
@@ -7552,9 +7473,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferReadRectExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferReadRectExp;
     if (nullptr == pfnAppendMemBufferReadRectExp) {
@@ -7562,12 +7481,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // forward to device-platform
     result = pfnAppendMemBufferReadRectExp(
@@ -7602,9 +7519,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendMemBufferFillExp =
         dditable->ur.CommandBufferExp.pfnAppendMemBufferFillExp;
     if (nullptr == pfnAppendMemBufferFillExp) {
@@ -7612,12 +7527,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
+    hBuffer = ur_mem_object_t::getHandle(hBuffer);
 
     // forward to device-platform
     result = pfnAppendMemBufferFillExp(
@@ -7648,9 +7561,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendUSMPrefetchExp =
         dditable->ur.CommandBufferExp.pfnAppendUSMPrefetchExp;
     if (nullptr == pfnAppendUSMPrefetchExp) {
@@ -7658,9 +7569,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
@@ -7691,9 +7600,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnAppendUSMAdviseExp =
         dditable->ur.CommandBufferExp.pfnAppendUSMAdviseExp;
     if (nullptr == pfnAppendUSMAdviseExp) {
@@ -7701,9 +7608,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
@@ -7734,28 +7639,24 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnEnqueueExp = dditable->ur.CommandBufferExp.pfnEnqueueExp;
     if (nullptr == pfnEnqueueExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -7792,8 +7693,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
 
     // extract platform's function pointer table
     auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->dditable;
+        ur_exp_command_buffer_command_object_t::getDditable(hCommand);
     auto pfnRetainCommandExp =
         dditable->ur.CommandBufferExp.pfnRetainCommandExp;
     if (nullptr == pfnRetainCommandExp) {
@@ -7801,9 +7701,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     }
 
     // convert loader handle to platform handle
-    hCommand =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->handle;
+    hCommand = ur_exp_command_buffer_command_object_t::getHandle(hCommand);
 
     // forward to device-platform
     result = pfnRetainCommandExp(hCommand);
@@ -7823,8 +7721,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
 
     // extract platform's function pointer table
     auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->dditable;
+        ur_exp_command_buffer_command_object_t::getDditable(hCommand);
     auto pfnReleaseCommandExp =
         dditable->ur.CommandBufferExp.pfnReleaseCommandExp;
     if (nullptr == pfnReleaseCommandExp) {
@@ -7832,9 +7729,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     }
 
     // convert loader handle to platform handle
-    hCommand =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->handle;
+    hCommand = ur_exp_command_buffer_command_object_t::getHandle(hCommand);
 
     // forward to device-platform
     result = pfnReleaseCommandExp(hCommand);
@@ -7856,8 +7751,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
 
     // extract platform's function pointer table
     auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->dditable;
+        ur_exp_command_buffer_command_object_t::getDditable(hCommand);
     auto pfnUpdateKernelLaunchExp =
         dditable->ur.CommandBufferExp.pfnUpdateKernelLaunchExp;
     if (nullptr == pfnUpdateKernelLaunchExp) {
@@ -7865,9 +7759,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     }
 
     // convert loader handle to platform handle
-    hCommand =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->handle;
+    hCommand = ur_exp_command_buffer_command_object_t::getHandle(hCommand);
 
     // Deal with any struct parameters that have handle members we need to convert.
     auto pUpdateKernelLaunchLocal = *pUpdateKernelLaunch;
@@ -7878,9 +7770,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         ur_exp_command_buffer_update_memobj_arg_desc_t NewRangeStruct =
             pUpdateKernelLaunchLocal.pNewMemObjArgList[i];
         if (NewRangeStruct.hNewMemObjArg) {
-            NewRangeStruct.hNewMemObjArg = reinterpret_cast<ur_mem_object_t *>(
-                                               NewRangeStruct.hNewMemObjArg)
-                                               ->handle;
+            NewRangeStruct.hNewMemObjArg =
+                ur_mem_object_t::getHandle(NewRangeStruct.hNewMemObjArg);
         }
 
         pUpdateKernelLaunchpNewMemObjArgList.push_back(NewRangeStruct);
@@ -7917,18 +7808,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->dditable;
+    auto dditable = ur_exp_command_buffer_object_t::getDditable(hCommandBuffer);
     auto pfnGetInfoExp = dditable->ur.CommandBufferExp.pfnGetInfoExp;
     if (nullptr == pfnGetInfoExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hCommandBuffer =
-        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
-            ->handle;
+    hCommandBuffer = ur_exp_command_buffer_object_t::getHandle(hCommandBuffer);
 
     // forward to device-platform
     result = pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
@@ -7958,8 +7845,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
     // extract platform's function pointer table
     auto dditable =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->dditable;
+        ur_exp_command_buffer_command_object_t::getDditable(hCommand);
     auto pfnCommandGetInfoExp =
         dditable->ur.CommandBufferExp.pfnCommandGetInfoExp;
     if (nullptr == pfnCommandGetInfoExp) {
@@ -7967,9 +7853,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     }
 
     // convert loader handle to platform handle
-    hCommand =
-        reinterpret_cast<ur_exp_command_buffer_command_object_t *>(hCommand)
-            ->handle;
+    hCommand = ur_exp_command_buffer_command_object_t::getHandle(hCommand);
 
     // forward to device-platform
     result = pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
@@ -8014,7 +7898,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnCooperativeKernelLaunchExp =
         dditable->ur.EnqueueExp.pfnCooperativeKernelLaunchExp;
     if (nullptr == pfnCooperativeKernelLaunchExp) {
@@ -8022,17 +7906,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -8077,7 +7961,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto dditable = ur_kernel_object_t::getDditable(hKernel);
     auto pfnSuggestMaxCooperativeGroupCountExp =
         dditable->ur.KernelExp.pfnSuggestMaxCooperativeGroupCountExp;
     if (nullptr == pfnSuggestMaxCooperativeGroupCountExp) {
@@ -8085,7 +7969,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     }
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnSuggestMaxCooperativeGroupCountExp(
@@ -8122,7 +8006,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnTimestampRecordingExp =
         dditable->ur.EnqueueExp.pfnTimestampRecordingExp;
     if (nullptr == pfnTimestampRecordingExp) {
@@ -8130,14 +8014,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -8196,7 +8080,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnKernelLaunchCustomExp =
         dditable->ur.EnqueueExp.pfnKernelLaunchCustomExp;
     if (nullptr == pfnKernelLaunchCustomExp) {
@@ -8204,10 +8088,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handle to platform handle
-    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+    hKernel = ur_kernel_object_t::getHandle(hKernel);
 
     // forward to device-platform
     result = pfnKernelLaunchCustomExp(hQueue, hKernel, workDim, pGlobalWorkSize,
@@ -8233,20 +8117,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnBuildExp = dditable->ur.ProgramExp.pfnBuildExp;
     if (nullptr == pfnBuildExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
-        phDevicesLocal[i] =
-            reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
+        phDevicesLocal[i] = ur_device_object_t::getHandle(phDevices[i]);
     }
 
     // forward to device-platform
@@ -8271,20 +8154,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto dditable = ur_program_object_t::getDditable(hProgram);
     auto pfnCompileExp = dditable->ur.ProgramExp.pfnCompileExp;
     if (nullptr == pfnCompileExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+    hProgram = ur_program_object_t::getHandle(hProgram);
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
-        phDevicesLocal[i] =
-            reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
+        phDevicesLocal[i] = ur_device_object_t::getHandle(phDevices[i]);
     }
 
     // forward to device-platform
@@ -8317,27 +8199,25 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnLinkExp = dditable->ur.ProgramExp.pfnLinkExp;
     if (nullptr == pfnLinkExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
-        phDevicesLocal[i] =
-            reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
+        phDevicesLocal[i] = ur_device_object_t::getHandle(phDevices[i]);
     }
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = std::vector<ur_program_handle_t>(count);
+    auto phProgramsLocal = handle_list_t<ur_program_handle_t>(count);
     for (size_t i = 0; i < count; ++i) {
-        phProgramsLocal[i] =
-            reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
+        phProgramsLocal[i] = ur_program_object_t::getHandle(phPrograms[i]);
     }
 
     // forward to device-platform
@@ -8370,14 +8250,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnImportExp = dditable->ur.USMExp.pfnImportExp;
     if (nullptr == pfnImportExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnImportExp(hContext, pMem, size);
@@ -8396,14 +8276,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto dditable = ur_context_object_t::getDditable(hContext);
     auto pfnReleaseExp = dditable->ur.USMExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    hContext = ur_context_object_t::getHandle(hContext);
 
     // forward to device-platform
     result = pfnReleaseExp(hContext, pMem);
@@ -8423,19 +8303,17 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(commandDevice);
     auto pfnEnablePeerAccessExp = dditable->ur.UsmP2PExp.pfnEnablePeerAccessExp;
     if (nullptr == pfnEnablePeerAccessExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    commandDevice =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+    commandDevice = ur_device_object_t::getHandle(commandDevice);
 
     // convert loader handle to platform handle
-    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+    peerDevice = ur_device_object_t::getHandle(peerDevice);
 
     // forward to device-platform
     result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
@@ -8455,8 +8333,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(commandDevice);
     auto pfnDisablePeerAccessExp =
         dditable->ur.UsmP2PExp.pfnDisablePeerAccessExp;
     if (nullptr == pfnDisablePeerAccessExp) {
@@ -8464,11 +8341,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     }
 
     // convert loader handle to platform handle
-    commandDevice =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+    commandDevice = ur_device_object_t::getHandle(commandDevice);
 
     // convert loader handle to platform handle
-    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+    peerDevice = ur_device_object_t::getHandle(peerDevice);
 
     // forward to device-platform
     result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
@@ -8499,8 +8375,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
+    auto dditable = ur_device_object_t::getDditable(commandDevice);
     auto pfnPeerAccessGetInfoExp =
         dditable->ur.UsmP2PExp.pfnPeerAccessGetInfoExp;
     if (nullptr == pfnPeerAccessGetInfoExp) {
@@ -8508,11 +8383,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     }
 
     // convert loader handle to platform handle
-    commandDevice =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+    commandDevice = ur_device_object_t::getHandle(commandDevice);
 
     // convert loader handle to platform handle
-    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+    peerDevice = ur_device_object_t::getHandle(peerDevice);
 
     // forward to device-platform
     result = pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
@@ -8551,28 +8425,27 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto dditable = ur_queue_object_t::getDditable(hQueue);
     auto pfnNativeCommandExp = dditable->ur.EnqueueExp.pfnNativeCommandExp;
     if (nullptr == pfnNativeCommandExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+    hQueue = ur_queue_object_t::getHandle(hQueue);
 
     // convert loader handles to platform handles
-    auto phMemListLocal = std::vector<ur_mem_handle_t>(numMemsInMemList);
+    auto phMemListLocal = handle_list_t<ur_mem_handle_t>(numMemsInMemList);
     for (size_t i = 0; i < numMemsInMemList; ++i) {
-        phMemListLocal[i] =
-            reinterpret_cast<ur_mem_object_t *>(phMemList[i])->handle;
+        phMemListLocal[i] = ur_mem_object_t::getHandle(phMemList[i]);
     }
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
-            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+            ur_event_object_t::getHandle(phEventWaitList[i]);
     }
 
     // forward to device-platform
@@ -8599,6 +8472,225 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Fills the DDI tables of a platform opened after the loader's own
+///        tables were filled, by context_t::loadLazyAdapters
+ur_result_t context_t::initPlatformDdiTables(platform_t &platform) {
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetGlobalProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetGlobalProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Global);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable =
+            reinterpret_cast<ur_pfnGetBindlessImagesExpProcAddrTable_t>(
+                LibLoader::getFunctionPtr(
+                    platform.handle.get(),
+                    "urGetBindlessImagesExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.BindlessImagesExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable =
+            reinterpret_cast<ur_pfnGetCommandBufferExpProcAddrTable_t>(
+                LibLoader::getFunctionPtr(
+                    platform.handle.get(),
+                    "urGetCommandBufferExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.CommandBufferExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetContextProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetContextProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Context);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetEnqueueProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetEnqueueProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Enqueue);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetEnqueueExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetEnqueueExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.EnqueueExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetEventProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetEventProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Event);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetKernelProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetKernelProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Kernel);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetKernelExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetKernelExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.KernelExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetMemProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(version, &platform.dditable.ur.Mem);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetPhysicalMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetPhysicalMemProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.PhysicalMem);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetPlatformProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetPlatformProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Platform);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetProgramProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetProgramProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Program);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetProgramExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetProgramExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.ProgramExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetQueueProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetQueueProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Queue);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetSamplerProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetSamplerProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Sampler);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetUSMProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetUSMProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(version, &platform.dditable.ur.USM);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetUSMExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetUSMExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.USMExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetUsmP2PExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetUsmP2PExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.UsmP2PExp);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetVirtualMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetVirtualMemProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.VirtualMem);
+        }
+    }
+
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetDeviceProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetDeviceProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(version, &platform.dditable.ur.Device);
+        }
+    }
+
+    return platform.initStatus;
+}
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -8,6 +8,7 @@
  *
  */
 #include "ur_loader.hpp"
+#include "ur_adapter_discovery.hpp"
 
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
@@ -15,23 +16,116 @@ context_t *getContext() { return context_t::get_direct(); }
 
 ///////////////////////////////////////////////////////////////////////////////
 ur_result_t context_t::init() {
+    forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
+    lazyLoad = getenv_tobool("UR_ADAPTERS_LAZY_LOAD");
+
+    if (lazyLoad) {
+        // The adapters are loaded by the first urAdapterGet, after the DDI
+        // tables have been filled. The loader's DDIs dispatch through the
+        // handles, so they are used whatever the number of adapters.
+        forceIntercept = true;
+    } else {
+        loadAdapters(false);
+    }
+
+    if (forceIntercept || platforms.size() > 1) {
+        intercept_enabled = true;
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::loadLazyAdapters() {
+    if (!lazyLoad) {
+        return;
+    }
+    std::call_once(lazyLoadOnce, [this]() {
+        loadAdapters(true);
+        for (auto &platform : platforms) {
+            initPlatformDdiTables(platform);
+        }
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::loadAdapters(bool selectedOnly) {
+    std::optional<EnvVarMap> ods;
+    if (selectedOnly) {
+        try {
+            ods = getenv_to_map("ONEAPI_DEVICE_SELECTOR", false);
+        } catch (const std::invalid_argument &e) {
+            // urDeviceGetSelected reports the error, every adapter is loaded.
+            logger::error(e.what());
+        }
+    }
+
+    std::optional<AdapterDiscoveryCache> cache;
+    if (auto cachePath = ur_getenv("UR_ADAPTERS_DISCOVERY_CACHE")) {
+        cache.emplace(*cachePath);
+    }
+
+    // Platforms are never added once adapters have been handed out, so the
+    // DDI tables the adapter handles point to don't move.
+    platforms.reserve(adapter_registry.size());
     for (const auto &adapterPaths : adapter_registry) {
+        if (adapterPaths.empty()) {
+            continue;
+        }
+        auto backend = adapterBackendName(adapterPaths.front());
+        if (!isBackendSelected(backend, ods)) {
+            logger::info("not loading the {} adapter, ONEAPI_DEVICE_SELECTOR "
+                         "doesn't select its devices",
+                         backend);
+            continue;
+        }
+        if (cache && cache->isKnownAbsent(adapterPaths)) {
+            logger::info("not loading {}, the discovery cache has it absent",
+                         adapterPaths.front().filename().string());
+            continue;
+        }
+
+        bool loaded = false;
         for (const auto &path : adapterPaths) {
             auto handle = LibLoader::loadAdapterLibrary(path.string().c_str());
             if (handle) {
                 platforms.emplace_back(std::move(handle));
+                loaded = true;
                 break;
             }
         }
+        if (cache) {
+            cache->update(adapterPaths, !loaded);
+        }
     }
 
-    forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
+    if (cache) {
+        cache->save();
+    }
 
-    if (forceIntercept || platforms.size() > 1) {
-        intercept_enabled = true;
+    assignHandleTags();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::assignHandleTags() {
+    for (auto &dditable : handle_tags_t::dditables) {
+        dditable = nullptr;
+    }
+    if (getenv_tobool("UR_DISABLE_LOADER_HANDLE_TAGS")) {
+        return;
     }
 
-    return UR_RESULT_SUCCESS;
+    uintptr_t tag = 0;
+    for (auto &platform : platforms) {
+        if (tag == handle_tags_t::maxTags) {
+            logger::info("the handles of the adapters after the first {} are "
+                         "wrapped by the loader",
+                         handle_tags_t::maxTags);
+            break;
+        }
+        platform.dditable.handleTag = ++tag;
+        handle_tags_t::dditables[tag] = &platform.dditable;
+    }
 }
 
 } // namespace ur_loader
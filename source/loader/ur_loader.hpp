@@ -12,6 +12,8 @@
 #ifndef UR_LOADER_HPP
 #define UR_LOADER_HPP 1
 
+#include <mutex>
+
 #include "ur_adapter_registry.hpp"
 #include "ur_ldrddi.hpp"
 #include "ur_lib_loader.hpp"
@@ -41,7 +43,31 @@ class context_t : public AtomicSingleton<context_t> {
     ur_result_t init();
     bool intercept_enabled = false;
 
+    /// @brief With UR_ADAPTERS_LAZY_LOAD, opens the adapter libraries of the
+    ///        backends ONEAPI_DEVICE_SELECTOR can select. Called by
+    ///        urAdapterGet, only the first call loads anything.
+    void loadLazyAdapters();
+
     struct handle_factories factories;
+
+  private:
+    /// @brief Opens the first library found for each adapter of the registry
+    ///        whose backend is selected, skipping the adapters the discovery
+    ///        cache knows are absent.
+    void loadAdapters(bool selectedOnly);
+
+    /// @brief Gives the loaded adapters the tags of their loader handles, so
+    ///        that the loader dispatches the calls on their handles without
+    ///        wrapper objects. UR_DISABLE_LOADER_HANDLE_TAGS makes the loader
+    ///        wrap all of the handles.
+    void assignHandleTags();
+
+    /// @brief Fills the DDI tables of a platform opened after the loader's own
+    ///        tables, defined with them in ur_ldrddi.cpp.
+    ur_result_t initPlatformDdiTables(platform_t &platform);
+
+    bool lazyLoad = false;
+    std::once_flag lazyLoadOnce;
 };
 
 context_t *getContext();
@@ -13,16 +13,43 @@
 #ifndef UR_OBJECT_H
 #define UR_OBJECT_H 1
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
 #include "ur_ddi.h"
+#include "ur_singleton.hpp"
 #include "ur_util.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 struct dditable_t {
     ur_dditable_t ur;
+    /// tag of the loader handles of the adapter, zero if they are wrapped
+    uintptr_t handleTag = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// the loader handles of an adapter given a tag are its platform handles
+/// with the tag set in their low bits, so that calls are dispatched without
+/// going through a wrapper object. platform handles point to objects aligned
+/// to at least 8 bytes, those which don't have the low bits clear anyway, and
+/// the handles of the adapters without a tag, are wrapped in an object_t,
+/// whose address has the low bits clear
+struct handle_tags_t {
+    static constexpr uintptr_t mask = 0x7;
+    static constexpr uintptr_t maxTags = mask;
+
+    /// the dditables of the tagged adapters, indexed by tag
+    static inline dditable_t *dditables[mask + 1] = {};
+
+    static uintptr_t getTag(const void *handle) {
+        return reinterpret_cast<uintptr_t>(handle) & mask;
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////
-template <typename _handle_t> class object_t {
+template <typename _handle_t>
+class alignas(handle_tags_t::mask + 1) object_t {
   public:
     using handle_t = _handle_t;
 
@@ -35,6 +62,79 @@ template <typename _handle_t> class object_t {
         : handle(_handle), dditable(_dditable) {}
 
     ~object_t() = default;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// the dditable of the adapter of a loader handle
+    static dditable_t *getDditable(handle_t loaderHandle) {
+        if (auto tag = handle_tags_t::getTag(loaderHandle)) {
+            return handle_tags_t::dditables[tag];
+        }
+        return reinterpret_cast<object_t *>(loaderHandle)->dditable;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// the platform handle of a loader handle
+    static handle_t getHandle(handle_t loaderHandle) {
+        if (auto tag = handle_tags_t::getTag(loaderHandle)) {
+            return reinterpret_cast<handle_t>(
+                reinterpret_cast<uintptr_t>(loaderHandle) ^ tag);
+        }
+        return reinterpret_cast<object_t *>(loaderHandle)->handle;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// creates the loader handles of the platform handles returned by adapters
+template <typename object_tn, typename handle_tn>
+class handle_factory_t : public singleton_factory_t<object_tn, handle_tn> {
+  public:
+    //////////////////////////////////////////////////////////////////////////
+    /// the loader handle of a platform handle of the adapter of dditable,
+    /// either the tagged platform handle or a wrapper object
+    handle_tn getInstance(handle_tn handle, dditable_t *dditable) {
+        if (dditable->handleTag != 0 && handle != nullptr &&
+            handle_tags_t::getTag(handle) == 0) {
+            return reinterpret_cast<handle_tn>(
+                reinterpret_cast<uintptr_t>(handle) | dditable->handleTag);
+        }
+        return reinterpret_cast<handle_tn>(
+            singleton_factory_t<object_tn, handle_tn>::getInstance(handle,
+                                                                   dditable));
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// storage for the platform handles of a list of loader handles, such as an
+/// event wait list. lists of up to inlineCapacity handles, which covers the
+/// usual wait lists, are stored inline so that translating them doesn't
+/// allocate
+template <typename handle_t, size_t inlineCapacity = 16> class handle_list_t {
+  public:
+    explicit handle_list_t(size_t size) : count(size) {
+        if (count > inlineCapacity) {
+            heapHandles.reset(new handle_t[count]);
+        }
+    }
+
+    handle_list_t(const handle_list_t &) = delete;
+    handle_list_t &operator=(const handle_list_t &) = delete;
+
+    handle_t &operator[](size_t i) { return data()[i]; }
+
+    /// nullptr for an empty list, as adapters expect for an empty wait list
+    handle_t *data() {
+        if (count == 0) {
+            return nullptr;
+        }
+        return heapHandles ? heapHandles.get() : inlineHandles;
+    }
+
+    size_t size() const { return count; }
+
+  private:
+    handle_t inlineHandles[inlineCapacity];
+    std::unique_ptr<handle_t[]> heapHandles;
+    size_t count;
 };
 
 #endif /* UR_OBJECT_H */
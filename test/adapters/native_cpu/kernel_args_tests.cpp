@@ -0,0 +1,162 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel_args.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+template <typename T> T valueAt(const native_cpu::kernel_args &args, size_t i) {
+    T value;
+    std::memcpy(&value, args.data()[i].MPtr, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+TEST(KernelArgsTest, SetOutOfOrder) {
+    native_cpu::kernel_args args;
+    int pointee = 0;
+    const uint64_t value = 42;
+    args.setPointer(2, &pointee);
+    args.setValue(0, &value, sizeof(value));
+    ASSERT_EQ(args.size(), 3u);
+    EXPECT_EQ(valueAt<uint64_t>(args, 0), value);
+    EXPECT_EQ(args.data()[1].MPtr, nullptr);
+    EXPECT_EQ(args.data()[2].MPtr, &pointee);
+}
+
+TEST(KernelArgsTest, ValuesAreCopied) {
+    native_cpu::kernel_args args;
+    uint32_t value = 1;
+    args.setValue(0, &value, sizeof(value));
+    value = 2;
+    EXPECT_EQ(valueAt<uint32_t>(args, 0), 1u);
+}
+
+TEST(KernelArgsTest, ResetKeepsSlot) {
+    native_cpu::kernel_args args;
+    const uint64_t first = 1, second = 2;
+    args.setValue(0, &first, sizeof(first));
+    const void *slot = args.data()[0].MPtr;
+    args.setValue(0, &second, sizeof(second));
+    EXPECT_EQ(args.data()[0].MPtr, slot);
+    EXPECT_EQ(valueAt<uint64_t>(args, 0), second);
+
+    // A pointer in between doesn't lose the slot either.
+    args.setPointer(0, nullptr);
+    args.setValue(0, &first, sizeof(first));
+    EXPECT_EQ(args.data()[0].MPtr, slot);
+    EXPECT_EQ(valueAt<uint64_t>(args, 0), first);
+}
+
+TEST(KernelArgsTest, ValuesAreAligned) {
+    native_cpu::kernel_args args;
+    const char byte = 'x';
+    const uint64_t word = 7;
+    const std::vector<char> large(100, 'y');
+    args.setValue(0, &byte, 1);
+    args.setValue(1, &word, sizeof(word));
+    args.setValue(2, large.data(), large.size());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(args.data()[1].MPtr) % 8, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(args.data()[2].MPtr) % 64, 0u);
+}
+
+TEST(KernelArgsTest, GrowsPastInlineStorage) {
+    native_cpu::kernel_args args;
+    std::vector<std::vector<uint8_t>> values;
+    for (uint32_t i = 0; i < 32; i++) {
+        values.emplace_back(24 + i, uint8_t(i));
+        args.setValue(i, values.back().data(), values.back().size());
+    }
+    ASSERT_EQ(args.size(), 32u);
+    for (uint32_t i = 0; i < 32; i++) {
+        EXPECT_EQ(std::memcmp(args.data()[i].MPtr, values[i].data(),
+                              values[i].size()),
+                  0)
+            << "argument " << i;
+    }
+}
+
+TEST(KernelArgsTest, LocalArgs) {
+    native_cpu::kernel_args args;
+    const int value = 3;
+    args.setLocal(1, 128);
+    args.setLocal(3, 16);
+    args.setValue(0, &value, sizeof(value));
+    ASSERT_EQ(args.localArgs().size(), 2u);
+    EXPECT_EQ(args.localArgs()[0].argIndex, 1u);
+    EXPECT_EQ(args.localArgs()[0].argSize, 128u);
+
+    // Setting the local argument again changes its size, setting it to
+    // something else makes it a regular argument.
+    args.setLocal(3, 32);
+    args.setValue(1, &value, sizeof(value));
+    ASSERT_EQ(args.localArgs().size(), 1u);
+    EXPECT_EQ(args.localArgs()[0].argIndex, 3u);
+    EXPECT_EQ(args.localArgs()[0].argSize, 32u);
+    EXPECT_EQ(valueAt<int>(args, 1), value);
+}
+
+TEST(KernelArgsTest, LocalArgsLayout) {
+    native_cpu::kernel_args args;
+    args.setLocal(0, 100);
+    args.setLocal(2, 1);
+    args.setLocal(1, 64);
+    EXPECT_EQ(args.localMemSize(), 256u);
+
+    std::vector<native_cpu::NativeCPUArgDesc> bound(args.data(),
+                                                    args.data() + args.size());
+    alignas(64) char localMem[256];
+    args.bindLocalArgs(bound.data(), localMem);
+    EXPECT_EQ(bound[0].MPtr, localMem);
+    EXPECT_EQ(bound[2].MPtr, localMem + 128);
+    EXPECT_EQ(bound[1].MPtr, localMem + 192);
+    // The arguments themselves aren't bound.
+    EXPECT_EQ(args.data()[0].MPtr, nullptr);
+
+    // Arguments after one which is no longer local move down.
+    const int value = 0;
+    args.setValue(0, &value, sizeof(value));
+    EXPECT_EQ(args.localMemSize(), 128u);
+    args.bindLocalArgs(bound.data(), localMem);
+    EXPECT_EQ(bound[2].MPtr, localMem);
+    EXPECT_EQ(bound[1].MPtr, localMem + 64);
+}
+
+TEST(KernelArgsTest, CopiesAreSnapshots) {
+    native_cpu::kernel_args args;
+    std::vector<uint8_t> large(1000, 1);
+    const uint32_t small = 5;
+    args.setValue(0, &small, sizeof(small));
+    args.setValue(1, large.data(), large.size());
+    args.setLocal(2, 64);
+
+    native_cpu::kernel_args snapshot(args);
+    const uint32_t changed = 6;
+    args.setValue(0, &changed, sizeof(changed));
+    std::vector<uint8_t> other(1000, 2);
+    args.setValue(1, other.data(), other.size());
+
+    // The snapshot has its own copy of the values.
+    EXPECT_NE(snapshot.data()[0].MPtr, args.data()[0].MPtr);
+    EXPECT_EQ(valueAt<uint32_t>(snapshot, 0), small);
+    EXPECT_EQ(std::memcmp(snapshot.data()[1].MPtr, large.data(), large.size()),
+              0);
+    EXPECT_EQ(snapshot.localArgs().size(), 1u);
+
+    // Assigning again reuses the storage of the snapshot.
+    const void *slot = snapshot.data()[1].MPtr;
+    snapshot = args;
+    EXPECT_EQ(snapshot.data()[1].MPtr, slot);
+    EXPECT_EQ(valueAt<uint32_t>(snapshot, 0), changed);
+    EXPECT_EQ(std::memcmp(snapshot.data()[1].MPtr, other.data(), other.size()),
+              0);
+}
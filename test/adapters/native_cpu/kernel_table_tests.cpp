@@ -0,0 +1,68 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace {
+
+const unsigned char kernelA = 0;
+const unsigned char kernelB = 0;
+const unsigned char kernelDup = 0;
+
+const nativecpu_entry entries[] = {
+    {"_ZTS7KernelA", &kernelA},
+    {"_ZTS7KernelB", &kernelB},
+    {"_ZTS7KernelA", &kernelDup},
+    {nullptr, nullptr},
+};
+
+} // namespace
+
+TEST(KernelTableTest, FindsKernelsByName) {
+    native_cpu::kernel_table table(entries);
+    EXPECT_EQ(table.size(), 2u);
+
+    // Names built at runtime, not the strings of the binary.
+    const std::string nameA = std::string("_ZTS7") + "KernelA";
+    const auto *a = table.find(nameA.c_str());
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a->kernelPtr, &kernelA);
+    EXPECT_EQ(a->name, entries[0].kernelname);
+    EXPECT_FALSE(a->hasReqdWGSize);
+
+    const auto *b = table.find("_ZTS7KernelB");
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(b->kernelPtr, &kernelB);
+
+    EXPECT_EQ(table.find("_ZTS7KernelC"), nullptr);
+    EXPECT_EQ(table.find("_ZTS7Kernel"), nullptr);
+}
+
+TEST(KernelTableTest, ReqdWGSizeIsAttachedToTemplates) {
+    native_cpu::kernel_table table(entries);
+    const auto *a = table.find("_ZTS7KernelA");
+    ASSERT_NE(a, nullptr);
+
+    table.setReqdWGSize("_ZTS7KernelA", {8, 4, 1});
+    table.setReqdWGSize("_ZTS7Missing", {2, 2, 2});
+
+    // Templates stay in place, kernels keep references to them.
+    EXPECT_EQ(table.find("_ZTS7KernelA"), a);
+    EXPECT_TRUE(a->hasReqdWGSize);
+    EXPECT_EQ(a->reqdWGSize, (native_cpu::ReqdWGSize_t{8, 4, 1}));
+    EXPECT_FALSE(table.find("_ZTS7KernelB")->hasReqdWGSize);
+    EXPECT_EQ(table.size(), 2u);
+}
+
+TEST(KernelTableTest, EmptyBinary) {
+    const nativecpu_entry empty[] = {{nullptr, nullptr}};
+    native_cpu::kernel_table table(empty);
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(table.find("_ZTS7KernelA"), nullptr);
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Checks that kernel launches on a warmed up queue don't allocate, the
+// launch descriptors, events and commands are all recycled by the adapter.
+// The global operator new of the test replaces the one used by the adapter
+// library, so that its allocations are counted as well.
+
+#include "kernel_args.hpp"
+#include "kernel_table.hpp"
+#include "nativecpu_state.hpp"
+
+#include <gtest/gtest.h>
+#include <ur_api.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<size_t> numAllocations{0};
+
+void increment(const native_cpu::NativeCPUArgDesc *args,
+               native_cpu::state *state) {
+    auto *data = static_cast<int *>(args[0].MPtr);
+    const size_t begin = state->MWorkGroup_id[0] * state->MWorkGroup_size[0];
+    for (size_t i = 0; i < state->MWorkGroup_size[0]; i++) {
+        if (begin + i < state->MGlobal_range[0]) {
+            data[begin + i]++;
+        }
+    }
+}
+
+constexpr size_t globalSize = 64;
+constexpr size_t numWarmUpLaunches = 1000;
+constexpr size_t numLaunches = 1000;
+
+struct LaunchAllocationTest : ::testing::Test {
+    void SetUp() override {
+        ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urPlatformGet(&adapter, 1, 1, &platform, nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(
+            urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr),
+            UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+                  UR_RESULT_SUCCESS);
+
+        ASSERT_EQ(urProgramCreateWithBinary(
+                      context, device, sizeof(entries),
+                      reinterpret_cast<const uint8_t *>(entries), nullptr,
+                      &program),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urKernelCreate(program, "increment", &kernel),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urUSMHostAlloc(context, nullptr, nullptr,
+                                 globalSize * sizeof(int), &data),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr, data),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        if (data) {
+            EXPECT_EQ(urUSMFree(context, data), UR_RESULT_SUCCESS);
+        }
+        if (kernel) {
+            EXPECT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+        }
+        if (program) {
+            EXPECT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+        }
+        if (queue) {
+            EXPECT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+        }
+        if (context) {
+            EXPECT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        }
+    }
+
+    ur_result_t launch(ur_event_handle_t *event) {
+        const size_t offset = 0;
+        return urEnqueueKernelLaunch(queue, kernel, 1, &offset, &globalSize,
+                                     nullptr, 0, nullptr, event);
+    }
+
+    // Returns the number of allocations made by the launches that follow
+    // the warm-up ones.
+    template <typename F> size_t countAllocations(F &&launchAndWait) {
+        for (size_t i = 0; i < numWarmUpLaunches; i++) {
+            launchAndWait();
+        }
+        size_t before = numAllocations.load();
+        for (size_t i = 0; i < numLaunches; i++) {
+            launchAndWait();
+        }
+        return numAllocations.load() - before;
+    }
+
+    static inline const nativecpu_entry entries[] = {
+        {"increment", reinterpret_cast<const unsigned char *>(&increment)},
+        {nullptr, nullptr},
+    };
+
+    ur_adapter_handle_t adapter = nullptr;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    void *data = nullptr;
+};
+
+} // namespace
+
+void *operator new(size_t size) {
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+TEST_F(LaunchAllocationTest, LaunchAndFinish) {
+    bool ok = true;
+    size_t allocations = countAllocations([&]() {
+        ok &= launch(nullptr) == UR_RESULT_SUCCESS;
+        ok &= urQueueFinish(queue) == UR_RESULT_SUCCESS;
+    });
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST_F(LaunchAllocationTest, LaunchAndWaitForEvent) {
+    bool ok = true;
+    size_t allocations = countAllocations([&]() {
+        ur_event_handle_t event = nullptr;
+        ok &= launch(&event) == UR_RESULT_SUCCESS;
+        ok &= urEventWait(1, &event) == UR_RESULT_SUCCESS;
+        ok &= urEventRelease(event) == UR_RESULT_SUCCESS;
+    });
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(allocations, 0u);
+}
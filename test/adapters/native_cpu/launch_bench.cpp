@@ -0,0 +1,167 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the overhead of small kernel launches on the native CPU adapter:
+// the latency of a launch waited for immediately, the throughput of a stream
+// of launches, and the heap allocations made per launch once warmed up.
+//
+// Usage: bench-adapter-native_cpu-launch [numLaunches] [globalSize]
+
+#include "nativecpu_state.hpp"
+
+#include <ur_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace {
+
+std::atomic<size_t> numAllocations{0};
+
+// Same layouts as native_cpu::NativeCPUArgDesc and nativecpu_entry, which
+// compiled kernels and the offload wrapper rely on.
+struct arg_desc {
+    void *MPtr;
+};
+
+struct kernel_entry {
+    const char *kernelname;
+    const unsigned char *kernel_ptr;
+};
+
+using kernel_fn_t = void(const arg_desc *, native_cpu::state *);
+
+void increment(const arg_desc *args, native_cpu::state *state) {
+    auto *data = static_cast<int *>(args[0].MPtr);
+    const size_t begin =
+        state->MWorkGroup_id[0] * state->MWorkGroup_size[0];
+    for (size_t i = 0; i < state->MWorkGroup_size[0]; i++) {
+        if (begin + i < state->MGlobal_range[0]) {
+            data[begin + i]++;
+        }
+    }
+}
+
+#define CHECK(call)                                                            \
+    do {                                                                       \
+        ur_result_t result = (call);                                           \
+        if (result != UR_RESULT_SUCCESS) {                                     \
+            std::fprintf(stderr, "%s failed: %d\n", #call, int(result));       \
+            std::exit(1);                                                      \
+        }                                                                      \
+    } while (0)
+
+struct measurement {
+    double usPerLaunch;
+    double allocationsPerLaunch;
+};
+
+template <typename F> measurement measure(size_t numLaunches, F &&launch) {
+    using clock = std::chrono::steady_clock;
+    // Warm up the recycled launch state of the adapter.
+    for (size_t i = 0; i < 1000; i++) {
+        launch();
+    }
+    size_t allocationsBefore = numAllocations.load();
+    auto start = clock::now();
+    for (size_t i = 0; i < numLaunches; i++) {
+        launch();
+    }
+    std::chrono::duration<double, std::micro> elapsed = clock::now() - start;
+    size_t allocations = numAllocations.load() - allocationsBefore;
+    return {elapsed.count() / numLaunches,
+            double(allocations) / numLaunches};
+}
+
+} // namespace
+
+void *operator new(size_t size) {
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char **argv) {
+    size_t numLaunches = argc > 1 ? std::stoul(argv[1]) : 100000;
+    size_t globalSize = argc > 2 ? std::stoul(argv[2]) : 64;
+
+    ur_adapter_handle_t adapter;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue;
+    CHECK(urQueueCreate(context, device, nullptr, &queue));
+
+    static kernel_fn_t *kernelFn = &increment;
+    kernel_entry entries[] = {
+        {"increment", reinterpret_cast<const unsigned char *>(kernelFn)},
+        {nullptr, nullptr}};
+    ur_program_handle_t program;
+    CHECK(urProgramCreateWithBinary(
+        context, device, sizeof(entries),
+        reinterpret_cast<const uint8_t *>(entries), nullptr, &program));
+    ur_kernel_handle_t kernel;
+    CHECK(urKernelCreate(program, "increment", &kernel));
+
+    void *data;
+    CHECK(urUSMHostAlloc(context, nullptr, nullptr, globalSize * sizeof(int),
+                         &data));
+
+    const size_t offset = 0;
+    auto enqueue = [&](ur_event_handle_t *event) {
+        CHECK(urKernelSetArgPointer(kernel, 0, nullptr, data));
+        CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &globalSize,
+                                    nullptr, 0, nullptr, event));
+    };
+
+    std::printf("launches: %zu, global size: %zu\n", numLaunches, globalSize);
+    std::printf("%-24s %12s %16s\n", "pattern", "us/launch", "allocs/launch");
+    auto report = [](const char *pattern, measurement m) {
+        std::printf("%-24s %12.3f %16.3f\n", pattern, m.usPerLaunch,
+                    m.allocationsPerLaunch);
+    };
+
+    report("launch + finish", measure(numLaunches / 10, [&]() {
+               enqueue(nullptr);
+               CHECK(urQueueFinish(queue));
+           }));
+    report("launch + event wait", measure(numLaunches / 10, [&]() {
+               ur_event_handle_t event;
+               enqueue(&event);
+               CHECK(urEventWait(1, &event));
+               CHECK(urEventRelease(event));
+           }));
+    // The queue is drained regularly, otherwise the launches in flight would
+    // pile up for as long as enqueuing is faster than running them.
+    size_t numStreamed = 0;
+    report("batches of 64 launches", measure(numLaunches, [&]() {
+               enqueue(nullptr);
+               if (++numStreamed % 64 == 0) {
+                   CHECK(urQueueFinish(queue));
+               }
+           }));
+    CHECK(urQueueFinish(queue));
+
+    CHECK(urUSMFree(context, data));
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urQueueRelease(queue));
+    CHECK(urContextRelease(context));
+    return 0;
+}
@@ -0,0 +1,211 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the bandwidth of the memory operations of the native CPU adapter:
+// copies, fills with patterns of several sizes including non powers of two,
+// buffer reads and writes, rectangle copies and the 2D USM operations. The
+// destination of each operation is checked after it has been timed.
+//
+// The number of threads sharing the work is set as for kernels, compare e.g.
+//   SYCL_NATIVE_CPU_HOST_THREADS=1 bench-adapter-native_cpu-memops
+//
+// Usage: bench-adapter-native_cpu-memops [numRepeats] [sizeMiB]
+
+#include <ur_api.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+#define CHECK(call)                                                            \
+    do {                                                                       \
+        ur_result_t result = (call);                                           \
+        if (result != UR_RESULT_SUCCESS) {                                     \
+            std::fprintf(stderr, "%s failed: %d\n", #call, int(result));       \
+            std::exit(1);                                                      \
+        }                                                                      \
+    } while (0)
+
+size_t numRepeats = 10;
+
+// Runs op numRepeats times after a warm up run and prints the bandwidth for
+// the bytes written by each run, then runs check on the result.
+void measure(const char *name, size_t bytes, ur_queue_handle_t queue,
+             const std::function<void()> &op,
+             const std::function<bool()> &check) {
+    using clock = std::chrono::steady_clock;
+    op();
+    CHECK(urQueueFinish(queue));
+    auto start = clock::now();
+    for (size_t i = 0; i < numRepeats; i++) {
+        op();
+    }
+    CHECK(urQueueFinish(queue));
+    std::chrono::duration<double> elapsed = clock::now() - start;
+    if (!check()) {
+        std::fprintf(stderr, "%s: wrong result\n", name);
+        std::exit(1);
+    }
+    const double seconds = elapsed.count() / numRepeats;
+    std::printf("%-28s %10.3f %10.2f\n", name, seconds * 1000.0,
+                bytes / seconds / 1e9);
+}
+
+std::vector<uint8_t> makePattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = uint8_t(i * 7 + 1);
+    }
+    return pattern;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    numRepeats = argc > 1 ? std::stoul(argv[1]) : 10;
+    const size_t size = (argc > 2 ? std::stoul(argv[2]) : 64) << 20;
+
+    ur_adapter_handle_t adapter;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue;
+    CHECK(urQueueCreate(context, device, nullptr, &queue));
+
+    void *src, *dst;
+    CHECK(urUSMHostAlloc(context, nullptr, nullptr, size, &src));
+    CHECK(urUSMHostAlloc(context, nullptr, nullptr, size, &dst));
+    auto *srcBytes = static_cast<uint8_t *>(src);
+    auto *dstBytes = static_cast<uint8_t *>(dst);
+    for (size_t i = 0; i < size; i++) {
+        srcBytes[i] = uint8_t(i % 251);
+    }
+    ur_mem_handle_t buffer;
+    CHECK(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size, nullptr,
+                            &buffer));
+
+    std::printf("size: %zu MiB, repeats: %zu\n", size >> 20, numRepeats);
+    std::printf("%-28s %10s %10s\n", "operation", "ms", "GB/s");
+
+    auto sameAsSrc = [&]() { return std::memcmp(dst, src, size) == 0; };
+    measure(
+        "USM memcpy", size, queue,
+        [&]() {
+            CHECK(urEnqueueUSMMemcpy(queue, false, dst, src, size, 0, nullptr,
+                                     nullptr));
+        },
+        sameAsSrc);
+
+    for (size_t patternSize : {1, 4, 12, 16, 24, 96}) {
+        const std::vector<uint8_t> pattern = makePattern(patternSize);
+        const size_t fillSize = size / patternSize * patternSize;
+        const std::string name =
+            "USM fill, " + std::to_string(patternSize) + "B pattern";
+        measure(
+            name.c_str(), fillSize, queue,
+            [&]() {
+                CHECK(urEnqueueUSMFill(queue, dst, patternSize, pattern.data(),
+                                       fillSize, 0, nullptr, nullptr));
+            },
+            [&]() {
+                for (size_t i = 0; i < fillSize; i++) {
+                    if (dstBytes[i] != pattern[i % patternSize]) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+    }
+
+    measure(
+        "buffer write", size, queue,
+        [&]() {
+            CHECK(urEnqueueMemBufferWrite(queue, buffer, false, 0, size, src, 0,
+                                          nullptr, nullptr));
+        },
+        []() { return true; });
+    measure(
+        "buffer read", size, queue,
+        [&]() {
+            CHECK(urEnqueueMemBufferRead(queue, buffer, false, 0, size, dst, 0,
+                                         nullptr, nullptr));
+        },
+        sameAsSrc);
+
+    // Rectangles of rows shorter than their pitch, so that they can't be
+    // copied as a whole.
+    const size_t pitch = 4096;
+    const size_t width = pitch - 96;
+    const size_t height = size / pitch;
+    auto sameRows = [&]() {
+        for (size_t row = 0; row < height; row++) {
+            if (std::memcmp(dstBytes + row * pitch, srcBytes + row * pitch,
+                            width) != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    const ur_rect_offset_t origin{0, 0, 0};
+    const ur_rect_region_t region{width, height, 1};
+    measure(
+        "buffer read rect", width * height, queue,
+        [&]() {
+            CHECK(urEnqueueMemBufferReadRect(queue, buffer, false, origin,
+                                             origin, region, pitch, 0, pitch,
+                                             0, dst, 0, nullptr, nullptr));
+        },
+        sameRows);
+    measure(
+        "USM memcpy 2D", width * height, queue,
+        [&]() {
+            CHECK(urEnqueueUSMMemcpy2D(queue, false, dst, pitch, src, pitch,
+                                       width, height, 0, nullptr, nullptr));
+        },
+        sameRows);
+
+    for (size_t patternSize : {1, 16, 64}) {
+        const std::vector<uint8_t> pattern = makePattern(patternSize);
+        const std::string name =
+            "USM fill 2D, " + std::to_string(patternSize) + "B pattern";
+        measure(
+            name.c_str(), width * height, queue,
+            [&]() {
+                CHECK(urEnqueueUSMFill2D(queue, dst, pitch, patternSize,
+                                         pattern.data(), width, height, 0,
+                                         nullptr, nullptr));
+            },
+            [&]() {
+                // The pattern carries on from one row to the next.
+                for (size_t row = 0; row < height; row++) {
+                    for (size_t x = 0; x < width; x++) {
+                        if (dstBytes[row * pitch + x] !=
+                            pattern[(row * width + x) % patternSize]) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            });
+    }
+
+    CHECK(urMemRelease(buffer));
+    CHECK(urUSMFree(context, src));
+    CHECK(urUSMFree(context, dst));
+    CHECK(urQueueRelease(queue));
+    CHECK(urContextRelease(context));
+    return 0;
+}
@@ -0,0 +1,148 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "memops.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> makePattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = uint8_t(i * 7 + 1);
+    }
+    return pattern;
+}
+
+// Runs the chunks of op backwards, to catch chunks depending on each other.
+void runReversed(const native_cpu::mem_op &op) {
+    for (size_t chunk = op.numChunks; chunk-- > 0;) {
+        op.runChunk(chunk);
+    }
+}
+
+} // namespace
+
+TEST(MemOpsTest, FillPatternSizes) {
+    for (size_t patternSize :
+         {1, 2, 3, 4, 5, 8, 12, 16, 24, 32, 48, 64, 96, 100, 1000, 5000}) {
+        const auto pattern = makePattern(patternSize);
+        for (size_t size : {size_t{0}, patternSize, 3 * patternSize + 1,
+                            size_t{4096}, size_t{100003}}) {
+            // Fill past a guard byte to check the fill stops at size.
+            std::vector<uint8_t> mem(size + 1, 0xAA);
+            native_cpu::fill(mem.data(), pattern.data(), patternSize, size);
+            for (size_t i = 0; i < size; i++) {
+                ASSERT_EQ(mem[i], pattern[i % patternSize])
+                    << "pattern " << patternSize << ", size " << size
+                    << ", byte " << i;
+            }
+            ASSERT_EQ(mem[size], 0xAA);
+        }
+    }
+}
+
+TEST(MemOpsTest, FillSplitsOnPatterns) {
+    for (size_t patternSize : {1, 12, 24, 64, 96}) {
+        const auto pattern = makePattern(patternSize);
+        const size_t size = (4 << 20) / patternSize * patternSize;
+        std::vector<uint8_t> mem(size);
+        auto op = native_cpu::makeFill(mem.data(), pattern.data(), patternSize,
+                                       size, 8);
+        EXPECT_GT(op.numChunks, 1u);
+        EXPECT_LE(op.numChunks, 8u);
+        runReversed(op);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(mem[i], pattern[i % patternSize]) << "byte " << i;
+        }
+    }
+}
+
+TEST(MemOpsTest, CopySplitsDisjointRanges) {
+    const size_t size = (4 << 20) + 5;
+    const auto src = makePattern(size);
+    std::vector<uint8_t> dst(size);
+    auto op = native_cpu::makeCopy(dst.data(), src.data(), size, 8);
+    EXPECT_EQ(op.numChunks, 8u);
+    runReversed(op);
+    EXPECT_EQ(dst, src);
+
+    auto small = native_cpu::makeCopy(dst.data(), src.data(), 100, 8);
+    EXPECT_EQ(small.numChunks, 1u);
+}
+
+TEST(MemOpsTest, CopyOverlapping) {
+    auto mem = makePattern(1 << 22);
+    const auto expected = mem;
+    auto op = native_cpu::makeCopy(mem.data() + 1, mem.data(), mem.size() - 1,
+                                   8);
+    EXPECT_EQ(op.numChunks, 1u);
+    op();
+    EXPECT_EQ(mem[0], expected[0]);
+    EXPECT_TRUE(std::equal(mem.begin() + 1, mem.end(), expected.begin()));
+}
+
+TEST(MemOpsTest, CopyRect) {
+    const size_t srcRowPitch = 37, srcSlicePitch = 37 * 11;
+    const size_t dstRowPitch = 29, dstSlicePitch = 29 * 13;
+    auto src = makePattern(srcSlicePitch * 5);
+    std::vector<uint8_t> dst(dstSlicePitch * 5, 0);
+    auto *srcMem = reinterpret_cast<char *>(src.data());
+    auto *dstMem = reinterpret_cast<char *>(dst.data());
+    const ur_rect_offset_t srcOffset{3, 2, 1}, dstOffset{1, 4, 0};
+    const ur_rect_region_t region{20, 7, 3};
+    for (size_t numChunks : {1, 4}) {
+        std::fill(dst.begin(), dst.end(), 0);
+        runReversed(native_cpu::makeCopyRect(
+            {dstMem, dstOffset, dstRowPitch, dstSlicePitch},
+            {srcMem, srcOffset, srcRowPitch, srcSlicePitch}, region,
+            numChunks));
+        for (size_t z = 0; z < dst.size() / dstSlicePitch; z++) {
+            for (size_t y = 0; y < dstSlicePitch / dstRowPitch; y++) {
+                for (size_t x = 0; x < dstRowPitch; x++) {
+                    const bool inside =
+                        z >= dstOffset.z && z < dstOffset.z + region.depth &&
+                        y >= dstOffset.y && y < dstOffset.y + region.height &&
+                        x >= dstOffset.x && x < dstOffset.x + region.width;
+                    const uint8_t expected =
+                        inside
+                            ? src[(z - dstOffset.z + srcOffset.z) *
+                                      srcSlicePitch +
+                                  (y - dstOffset.y + srcOffset.y) *
+                                      srcRowPitch +
+                                  (x - dstOffset.x + srcOffset.x)]
+                            : 0;
+                    ASSERT_EQ(dst[z * dstSlicePitch + y * dstRowPitch + x],
+                              expected)
+                        << x << "," << y << "," << z;
+                }
+            }
+        }
+    }
+}
+
+TEST(MemOpsTest, Fill2DCarriesPatternAcrossRows) {
+    const size_t pitch = 40, width = 24, height = 9;
+    for (size_t patternSize : {1, 4, 16, 64}) {
+        const auto pattern = makePattern(patternSize);
+        std::vector<uint8_t> mem(pitch * height, 0xAA);
+        native_cpu::makeFill2D(mem.data(), pitch, pattern.data(), patternSize,
+                               width, height, 4)();
+        for (size_t row = 0; row < height; row++) {
+            for (size_t x = 0; x < pitch; x++) {
+                const uint8_t expected =
+                    x < width ? pattern[(row * width + x) % patternSize]
+                              : 0xAA;
+                ASSERT_EQ(mem[row * pitch + x], expected)
+                    << "pattern " << patternSize << ", " << x << "," << row;
+            }
+        }
+    }
+}
@@ -0,0 +1,212 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how the native CPU adapter splits kernel launches between its
+// threads, over 1D, 2D and 3D shapes with and without a local size. Each
+// kernel is a stencil whose output is checked against a serial reference.
+//
+// The partitioning policy is read from the environment, run the benchmark
+// once per policy to compare them:
+//   SYCL_NATIVE_CPU_PARTITION=tiled|rows|static bench-adapter-native_cpu-partition
+//
+// Usage: bench-adapter-native_cpu-partition [numLaunches]
+
+#include "nativecpu_state.hpp"
+
+#include <ur_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Same layouts as native_cpu::NativeCPUArgDesc and nativecpu_entry, which
+// compiled kernels and the offload wrapper rely on.
+struct arg_desc {
+    void *MPtr;
+};
+
+struct kernel_entry {
+    const char *kernelname;
+    const unsigned char *kernel_ptr;
+};
+
+using kernel_fn_t = void(const arg_desc *, native_cpu::state *);
+
+// Calls f for each work-item of the work-group of state, as a kernel compiled
+// for the native CPU device does.
+template <typename F> void forEachItem(native_cpu::state *state, F &&f) {
+    size_t begin[3], end[3];
+    for (size_t dim = 0; dim < 3; dim++) {
+        begin[dim] = state->MWorkGroup_id[dim] * state->MWorkGroup_size[dim];
+        end[dim] = std::min(begin[dim] + state->MWorkGroup_size[dim],
+                            state->MGlobal_range[dim]);
+    }
+    for (size_t z = begin[2]; z < end[2]; z++) {
+        for (size_t y = begin[1]; y < end[1]; y++) {
+            for (size_t x = begin[0]; x < end[0]; x++) {
+                f(x, y, z);
+            }
+        }
+    }
+}
+
+// Applies a stencil over the points with all their neighbours in range, and
+// copies the points on the boundary.
+float stencil(const float *in, size_t x, size_t y, size_t z, size_t nx,
+              size_t ny, size_t nz) {
+    const size_t i = (z * ny + y) * nx + x;
+    if (x == 0 || x == nx - 1) {
+        return in[i];
+    }
+    float sum = 2.0f * in[i] + in[i - 1] + in[i + 1];
+    if (ny > 1) {
+        if (y == 0 || y == ny - 1) {
+            return in[i];
+        }
+        sum += in[i - nx] + in[i + nx];
+    }
+    if (nz > 1) {
+        if (z == 0 || z == nz - 1) {
+            return in[i];
+        }
+        sum += in[i - nx * ny] + in[i + nx * ny];
+    }
+    return sum * 0.125f;
+}
+
+void stencilKernel(const arg_desc *args, native_cpu::state *state) {
+    const auto *in = static_cast<const float *>(args[0].MPtr);
+    auto *out = static_cast<float *>(args[1].MPtr);
+    const size_t nx = state->MGlobal_range[0];
+    const size_t ny = state->MGlobal_range[1];
+    const size_t nz = state->MGlobal_range[2];
+    forEachItem(state, [&](size_t x, size_t y, size_t z) {
+        out[(z * ny + y) * nx + x] = stencil(in, x, y, z, nx, ny, nz);
+    });
+}
+
+#define CHECK(call)                                                            \
+    do {                                                                       \
+        ur_result_t result = (call);                                           \
+        if (result != UR_RESULT_SUCCESS) {                                     \
+            std::fprintf(stderr, "%s failed: %d\n", #call, int(result));       \
+            std::exit(1);                                                      \
+        }                                                                      \
+    } while (0)
+
+struct shape {
+    const char *name;
+    uint32_t workDim;
+    size_t globalSize[3];
+    // Null for a launch without a local size.
+    const size_t *localSize;
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t numLaunches = argc > 1 ? std::stoul(argv[1]) : 20;
+
+    ur_adapter_handle_t adapter;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue;
+    CHECK(urQueueCreate(context, device, nullptr, &queue));
+
+    static kernel_fn_t *kernelFn = &stencilKernel;
+    kernel_entry entries[] = {
+        {"stencil", reinterpret_cast<const unsigned char *>(kernelFn)},
+        {nullptr, nullptr}};
+    ur_program_handle_t program;
+    CHECK(urProgramCreateWithBinary(
+        context, device, sizeof(entries),
+        reinterpret_cast<const uint8_t *>(entries), nullptr, &program));
+    ur_kernel_handle_t kernel;
+    CHECK(urKernelCreate(program, "stencil", &kernel));
+
+    static const size_t local2D[] = {4, 4, 1};
+    static const size_t local3D[] = {4, 4, 4};
+    const shape shapes[] = {
+        {"1D range", 1, {4 * 1024 * 1024 + 3, 1, 1}, nullptr},
+        {"2D range", 2, {2048, 2047, 1}, nullptr},
+        {"3D range", 3, {192, 191, 190}, nullptr},
+        {"2D nd_range 4x4", 2, {2048, 2048, 1}, local2D},
+        {"3D nd_range 4x4x4", 3, {128, 128, 128}, local3D},
+    };
+
+    const char *policy = std::getenv("SYCL_NATIVE_CPU_PARTITION");
+    std::printf("partitioning: %s, launches: %zu\n", policy ? policy : "default",
+                numLaunches);
+    std::printf("%-20s %12s %14s\n", "shape", "ms/launch", "Mitems/s");
+
+    using clock = std::chrono::steady_clock;
+    const size_t offset[3] = {0, 0, 0};
+    for (const shape &s : shapes) {
+        const size_t nx = s.globalSize[0];
+        const size_t ny = s.globalSize[1];
+        const size_t nz = s.globalSize[2];
+        const size_t numItems = nx * ny * nz;
+        void *in, *out;
+        CHECK(urUSMHostAlloc(context, nullptr, nullptr,
+                             numItems * sizeof(float), &in));
+        CHECK(urUSMHostAlloc(context, nullptr, nullptr,
+                             numItems * sizeof(float), &out));
+        auto *inData = static_cast<float *>(in);
+        for (size_t i = 0; i < numItems; i++) {
+            inData[i] = float(i % 1031);
+        }
+
+        auto launch = [&]() {
+            CHECK(urKernelSetArgPointer(kernel, 0, nullptr, in));
+            CHECK(urKernelSetArgPointer(kernel, 1, nullptr, out));
+            CHECK(urEnqueueKernelLaunch(queue, kernel, s.workDim, offset,
+                                        s.globalSize, s.localSize, 0, nullptr,
+                                        nullptr));
+            CHECK(urQueueFinish(queue));
+        };
+        launch();
+        auto start = clock::now();
+        for (size_t i = 0; i < numLaunches; i++) {
+            launch();
+        }
+        std::chrono::duration<double, std::milli> elapsed = clock::now() - start;
+
+        const auto *outData = static_cast<const float *>(out);
+        for (size_t z = 0; z < nz; z++) {
+            for (size_t y = 0; y < ny; y++) {
+                for (size_t x = 0; x < nx; x++) {
+                    const size_t i = (z * ny + y) * nx + x;
+                    if (outData[i] != stencil(inData, x, y, z, nx, ny, nz)) {
+                        std::fprintf(stderr, "%s: wrong result at %zu,%zu,%zu\n",
+                                     s.name, x, y, z);
+                        return 1;
+                    }
+                }
+            }
+        }
+
+        const double ms = elapsed.count() / numLaunches;
+        std::printf("%-20s %12.3f %14.1f\n", s.name, ms,
+                    numItems / ms / 1000.0);
+        CHECK(urUSMFree(context, in));
+        CHECK(urUSMFree(context, out));
+    }
+
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urQueueRelease(queue));
+    CHECK(urContextRelease(context));
+    return 0;
+}
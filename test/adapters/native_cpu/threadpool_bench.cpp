@@ -0,0 +1,107 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compares the native CPU thread pools on imbalanced task sets, mimicking
+// nd_range launches where some work-groups are much more expensive than
+// others.
+//
+// Usage: bench-adapter-native_cpu-threadpool [numTasks] [repetitions]
+
+#include "threadpool.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace native_cpu;
+
+namespace {
+
+volatile uint64_t sink;
+
+void spin(uint64_t iterations) {
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+        acc = acc * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    sink = acc;
+}
+
+enum class distribution { uniform, skewed, front_loaded };
+
+const char *name(distribution d) {
+    switch (d) {
+    case distribution::uniform:
+        return "uniform";
+    case distribution::skewed:
+        return "skewed";
+    case distribution::front_loaded:
+        return "front_loaded";
+    }
+    return "";
+}
+
+std::vector<uint64_t> make_costs(distribution d, size_t numTasks) {
+    std::vector<uint64_t> costs(numTasks);
+    std::mt19937_64 rng(42);
+    for (size_t i = 0; i < numTasks; i++) {
+        switch (d) {
+        case distribution::uniform:
+            costs[i] = 2000;
+            break;
+        case distribution::skewed:
+            // Roughly one task in 16 is 50x more expensive
+            costs[i] = (rng() % 16 == 0) ? 100000 : 2000;
+            break;
+        case distribution::front_loaded:
+            costs[i] = i < numTasks / 8 ? 40000 : 500;
+            break;
+        }
+    }
+    return costs;
+}
+
+template <typename PoolT>
+double run(PoolT &pool, const std::vector<uint64_t> &costs, size_t reps) {
+    using clock = std::chrono::steady_clock;
+    double best = 0;
+    for (size_t r = 0; r < reps; r++) {
+        auto start = clock::now();
+        for (auto cost : costs) {
+            pool.schedule([cost](size_t) { spin(cost); });
+        }
+        pool.wait_for_all_pending_tasks();
+        std::chrono::duration<double, std::milli> elapsed =
+            clock::now() - start;
+        if (r == 0 || elapsed.count() < best) {
+            best = elapsed.count();
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t numTasks = argc > 1 ? std::stoul(argv[1]) : 4096;
+    size_t reps = argc > 2 ? std::stoul(argv[2]) : 10;
+
+    detail::simple_thread_pool simple;
+    detail::work_stealing_thread_pool stealing;
+
+    std::printf("threads: %zu, tasks: %zu, best of %zu\n", simple.num_threads(),
+                numTasks, reps);
+    std::printf("%-14s %14s %14s %9s\n", "distribution", "simple [ms]",
+                "stealing [ms]", "speedup");
+    for (auto d : {distribution::uniform, distribution::skewed,
+                   distribution::front_loaded}) {
+        auto costs = make_costs(d, numTasks);
+        double simpleMs = run(simple, costs, reps);
+        double stealingMs = run(stealing, costs, reps);
+        std::printf("%-14s %14.3f %14.3f %8.2fx\n", name(d), simpleMs,
+                    stealingMs, simpleMs / stealingMs);
+    }
+    return 0;
+}
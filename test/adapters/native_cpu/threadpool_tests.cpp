@@ -0,0 +1,227 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "threadpool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <set>
+
+using namespace native_cpu;
+
+TEST(WorkStealingDeque, OwnerPopIsLifo) {
+    detail::work_stealing_deque<int *> deque(2);
+    int values[8];
+    for (auto &v : values) {
+        deque.push(&v);
+    }
+    ASSERT_EQ(deque.size(), 8u);
+    for (int i = 7; i >= 0; i--) {
+        ASSERT_EQ(deque.pop(), &values[i]);
+    }
+    ASSERT_EQ(deque.pop(), nullptr);
+}
+
+TEST(WorkStealingDeque, StealIsFifo) {
+    detail::work_stealing_deque<int *> deque;
+    int values[4];
+    for (auto &v : values) {
+        deque.push(&v);
+    }
+    for (auto &v : values) {
+        ASSERT_EQ(deque.steal(), &v);
+    }
+    ASSERT_EQ(deque.steal(), nullptr);
+}
+
+TEST(WorkStealingDeque, ConcurrentStealsTakeEachElementOnce) {
+    constexpr size_t numElements = 100000;
+    constexpr size_t numThieves = 4;
+    detail::work_stealing_deque<size_t *> deque(16);
+    std::vector<size_t> values(numElements);
+    std::vector<std::atomic<int>> taken(numElements);
+    std::atomic<bool> done(false);
+
+    auto take = [&](size_t *v) { taken[v - values.data()]++; };
+
+    std::vector<std::thread> thieves;
+    for (size_t i = 0; i < numThieves; i++) {
+        thieves.emplace_back([&]() {
+            while (!done.load()) {
+                if (auto *v = deque.steal()) {
+                    take(v);
+                }
+            }
+            while (auto *v = deque.steal()) {
+                take(v);
+            }
+        });
+    }
+    for (size_t i = 0; i < numElements; i++) {
+        deque.push(&values[i]);
+        if (i % 3 == 0) {
+            if (auto *v = deque.pop()) {
+                take(v);
+            }
+        }
+    }
+    done.store(true);
+    for (auto &t : thieves) {
+        t.join();
+    }
+    while (auto *v = deque.pop()) {
+        take(v);
+    }
+    for (auto &t : taken) {
+        ASSERT_EQ(t.load(), 1);
+    }
+}
+
+template <typename T> struct ThreadPoolTest : ::testing::Test {};
+
+using ThreadPoolTypes = ::testing::Types<detail::simple_thread_pool,
+                                         detail::work_stealing_thread_pool>;
+TYPED_TEST_SUITE(ThreadPoolTest, ThreadPoolTypes, );
+
+TYPED_TEST(ThreadPoolTest, RunsAllTasks) {
+    TypeParam pool;
+    std::atomic<size_t> counter(0);
+    constexpr size_t numTasks = 10000;
+    for (size_t i = 0; i < numTasks; i++) {
+        pool.schedule([&counter](size_t) { counter++; });
+    }
+    pool.wait_for_all_pending_tasks();
+    ASSERT_EQ(counter.load(), numTasks);
+    ASSERT_EQ(pool.num_pending_tasks(), 0u);
+}
+
+TYPED_TEST(ThreadPoolTest, ThreadIdsAreInRange) {
+    TypeParam pool;
+    std::atomic<bool> inRange(true);
+    for (size_t i = 0; i < 1000; i++) {
+        pool.schedule([&](size_t threadId) {
+            if (threadId >= pool.num_threads()) {
+                inRange = false;
+            }
+        });
+    }
+    pool.wait_for_all_pending_tasks();
+    ASSERT_TRUE(inRange.load());
+}
+
+TEST(WorkStealingThreadPool, IdleWorkersStealFromBusyOnes) {
+    detail::work_stealing_thread_pool pool;
+    if (pool.num_threads() < 2) {
+        GTEST_SKIP() << "Stealing requires at least two workers";
+    }
+    std::mutex mutex;
+    std::set<size_t> workers;
+    // A single task spawning children pushes them all to its own deque, the
+    // other workers can only get them by stealing.
+    pool.schedule([&](size_t) {
+        for (size_t i = 0; i < 256; i++) {
+            pool.schedule([&](size_t threadId) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                std::lock_guard<std::mutex> lock(mutex);
+                workers.insert(threadId);
+            });
+        }
+    });
+    pool.wait_for_all_pending_tasks();
+    ASSERT_GT(workers.size(), 1u);
+}
+
+TEST(WorkStealingThreadPool, InterfaceFuturesComplete) {
+    threadpool_interface<detail::work_stealing_thread_pool> tp;
+    std::vector<std::future<void>> futures;
+    std::atomic<size_t> counter(0);
+    for (size_t i = 0; i < 100; i++) {
+        futures.emplace_back(tp.schedule_task([&](size_t) { counter++; }));
+    }
+    for (auto &f : futures) {
+        f.get();
+    }
+    ASSERT_EQ(counter.load(), 100u);
+}
+
+TEST(WorkStealingThreadPool, IntrusiveTasksAreReusable) {
+    struct counting_task : intrusive_task {
+        std::atomic<size_t> *counter;
+    };
+    detail::work_stealing_thread_pool pool;
+    std::atomic<size_t> counter(0);
+    std::vector<counting_task> tasks(64);
+    // The same storage is scheduled again once the previous round has run.
+    for (size_t round = 0; round < 10; round++) {
+        for (auto &task : tasks) {
+            task.run = [](intrusive_task *t, size_t) {
+                (*static_cast<counting_task *>(t)->counter)++;
+            };
+            task.counter = &counter;
+            pool.schedule(&task);
+        }
+        pool.wait_for_all_pending_tasks();
+        ASSERT_EQ(counter.load(), (round + 1) * tasks.size());
+    }
+}
+
+TEST(WorkStealingThreadPool, BusyTimeIsOnlyMeasuredWhenProfiling) {
+    thread_placement placement;
+    placement.numThreads = 2;
+    detail::work_stealing_thread_pool pool(placement);
+    auto scheduleSleeps = [&pool]() {
+        for (size_t i = 0; i < 8; i++) {
+            pool.schedule([](size_t) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            });
+        }
+        pool.wait_for_all_pending_tasks();
+    };
+    scheduleSleeps();
+    for (size_t i = 0; i < pool.num_threads(); i++) {
+        ASSERT_EQ(pool.busy_time(i).numTasks, 0u);
+        ASSERT_EQ(pool.busy_time(i).busyNs, 0u);
+    }
+
+    pool.enable_profiling();
+    scheduleSleeps();
+    uint64_t busyNs = 0, numTasks = 0;
+    for (size_t i = 0; i < pool.num_threads(); i++) {
+        busyNs += pool.busy_time(i).busyNs;
+        numTasks += pool.busy_time(i).numTasks;
+    }
+    ASSERT_EQ(numTasks, 8u);
+    ASSERT_GE(busyNs, 8u * 2000000u);
+}
+
+#ifdef __linux__
+TEST(WorkStealingThreadPool, WorkersArePinnedToTheirCpu) {
+    cpu_set_t available;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(available), &available), 0);
+    unsigned cpu = 0;
+    while (!CPU_ISSET(cpu, &available)) {
+        cpu++;
+    }
+    thread_placement placement;
+    placement.numThreads = 2;
+    placement.threadCpus = {{cpu, 0}, {cpu, 0}};
+    placement.isPinned = true;
+    detail::work_stealing_thread_pool pool(placement);
+    std::atomic<size_t> numPinned(0);
+    for (size_t i = 0; i < 16; i++) {
+        pool.schedule([&](size_t) {
+            cpu_set_t set;
+            if (sched_getaffinity(0, sizeof(set), &set) == 0 &&
+                CPU_COUNT(&set) == 1 && CPU_ISSET(cpu, &set)) {
+                numPinned++;
+            }
+        });
+    }
+    pool.wait_for_all_pending_tasks();
+    ASSERT_EQ(numPinned.load(), 16u);
+}
+#endif
@@ -0,0 +1,213 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file allocation_index.cpp
+ *
+ */
+
+#include "asan_allocation_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+// The index never touches the memory, so the addresses are made up
+std::shared_ptr<AllocInfo> makeAlloc(uptr Begin, size_t Size) {
+    auto AI = std::make_shared<AllocInfo>();
+    AI->AllocBegin = Begin;
+    AI->AllocSize = Size;
+    return AI;
+}
+
+std::shared_ptr<AllocInfo> find(const AllocationIndex &Index, uptr Address) {
+    AllocationIndex::ReadGuard Guard;
+    auto *AI = Index.find(Address);
+    return AI ? *AI : nullptr;
+}
+
+constexpr uptr KiB = 1024;
+constexpr uptr MiB = 1024 * KiB;
+constexpr uptr GiB = 1024 * MiB;
+
+} // namespace
+
+TEST(AllocationIndex, FindsSmallAllocations) {
+    AllocationIndex Index;
+    // Two allocations sharing a page, and one crossing a page boundary
+    auto A = makeAlloc(0x10000, 64);
+    auto B = makeAlloc(0x10100, 128);
+    auto C = makeAlloc(0x11f00, 512);
+    Index.insert(A);
+    Index.insert(B);
+    Index.insert(C);
+
+    EXPECT_EQ(find(Index, 0x10000), A);
+    EXPECT_EQ(find(Index, 0x1003f), A);
+    EXPECT_EQ(find(Index, 0x10040), nullptr);
+    EXPECT_EQ(find(Index, 0x10100), B);
+    EXPECT_EQ(find(Index, 0x1017f), B);
+    EXPECT_EQ(find(Index, 0x11f00), C);
+    EXPECT_EQ(find(Index, 0x120ff), C);
+    EXPECT_EQ(find(Index, 0x12100), nullptr);
+    EXPECT_EQ(find(Index, 0xffff), nullptr);
+
+    Index.erase(B);
+    EXPECT_EQ(find(Index, 0x10100), nullptr);
+    EXPECT_EQ(find(Index, 0x10000), A);
+
+    Index.erase(A);
+    Index.erase(C);
+    EXPECT_EQ(find(Index, 0x10000), nullptr);
+    EXPECT_EQ(find(Index, 0x11f00), nullptr);
+}
+
+TEST(AllocationIndex, FindsLargeAllocations) {
+    AllocationIndex Index;
+    // Not aligned to a page, and sharing its first and last pages with
+    // small allocations
+    uptr Begin = 64 * GiB + 3 * MiB + 0x100;
+    auto Large = makeAlloc(Begin, GiB + 5 * MiB);
+    auto Before = makeAlloc(Begin - 0x80, 0x40);
+    auto After = makeAlloc(Begin + GiB + 5 * MiB + 0x40, 0x40);
+    Index.insert(Before);
+    Index.insert(Large);
+    Index.insert(After);
+
+    for (uptr Offset = 0; Offset < GiB + 5 * MiB; Offset += 7 * MiB + 123) {
+        EXPECT_EQ(find(Index, Begin + Offset), Large);
+    }
+    EXPECT_EQ(find(Index, Begin + GiB + 5 * MiB - 1), Large);
+    EXPECT_EQ(find(Index, Begin + GiB + 5 * MiB), nullptr);
+    EXPECT_EQ(find(Index, Begin - 1), nullptr);
+    EXPECT_EQ(find(Index, Begin - 0x80), Before);
+    EXPECT_EQ(find(Index, Begin + GiB + 5 * MiB + 0x40), After);
+
+    // The large allocation is replaced by small ones in its range
+    Index.erase(Large);
+    EXPECT_EQ(find(Index, Begin), nullptr);
+    EXPECT_EQ(find(Index, Begin + 512 * MiB), nullptr);
+    EXPECT_EQ(find(Index, Begin - 0x80), Before);
+    EXPECT_EQ(find(Index, Begin + GiB + 5 * MiB + 0x40), After);
+
+    auto Inside = makeAlloc(Begin + 512 * MiB, 0x40);
+    Index.insert(Inside);
+    EXPECT_EQ(find(Index, Begin + 512 * MiB), Inside);
+    EXPECT_EQ(find(Index, Begin + 256 * MiB), nullptr);
+}
+
+TEST(AllocationIndex, RetiredBucketsOutliveReaders) {
+    AllocationIndex Index;
+    auto AI = makeAlloc(0x100000, 256);
+    auto Other = makeAlloc(0x200000, 256);
+    Index.insert(AI);
+
+    // Writers reclaim what was retired when they can advance the epoch
+    auto Write = [&]() {
+        for (int I = 0; I < 4; I++) {
+            Index.insert(Other);
+            Index.erase(Other);
+        }
+    };
+
+    std::atomic<int> Step{0};
+    std::thread Reader([&]() {
+        AllocationIndex::ReadGuard Guard;
+        auto *Found = Index.find(0x100010);
+        Step = 1;
+        while (Step != 2) {
+            std::this_thread::yield();
+        }
+        // The bucket was retired, but is still alive
+        ASSERT_NE(Found, nullptr);
+        EXPECT_EQ(Found->get(), AI.get());
+    });
+
+    while (Step != 1) {
+        std::this_thread::yield();
+    }
+    Index.erase(AI);
+    Write();
+    EXPECT_EQ(find(Index, 0x100010), nullptr);
+    EXPECT_GT(AI.use_count(), 1);
+
+    Step = 2;
+    Reader.join();
+    Write();
+    EXPECT_EQ(AI.use_count(), 1);
+}
+
+TEST(AllocationIndex, ConcurrentInsertEraseFind) {
+    AllocationIndex Index;
+    constexpr int NumWriters = 4;
+    constexpr int NumReaders = 4;
+    constexpr int NumIterations = 500;
+
+    // Present all along, interleaved with the allocations of the writers
+    std::vector<std::shared_ptr<AllocInfo>> Stable;
+    for (int I = 0; I < 64; I++) {
+        Stable.push_back(makeAlloc(0x1000000 + I * 0x2000, 0x800));
+        Index.insert(Stable.back());
+    }
+
+    std::atomic<bool> Done{false};
+    std::vector<std::thread> Threads;
+    for (int W = 0; W < NumWriters; W++) {
+        Threads.emplace_back([&, W]() {
+            for (int I = 0; I < NumIterations; I++) {
+                // Small allocations sharing pages with the stable ones, and
+                // large ones covering whole subtrees
+                uptr Slot = (I % 16) * NumWriters + W;
+                auto Small = makeAlloc(0x1000800 + Slot * 0x2000, 0x400);
+                auto Large =
+                    makeAlloc((W + 1) * 16 * GiB - 0x10, 64 * MiB + 0x20);
+                Index.insert(Small);
+                Index.insert(Large);
+                Index.erase(Small);
+                Index.erase(Large);
+            }
+        });
+    }
+    for (int R = 0; R < NumReaders; R++) {
+        Threads.emplace_back([&, R]() {
+            size_t I = R;
+            while (!Done) {
+                auto &AI = Stable[I++ % Stable.size()];
+                EXPECT_EQ(find(Index, AI->AllocBegin + 0x10), AI);
+
+                AllocationIndex::ReadGuard Guard;
+                uptr Address =
+                    (I % NumWriters + 1) * 16 * GiB + (I % 64) * MiB;
+                if (auto *Found = Index.find(Address)) {
+                    EXPECT_GE(Address, (*Found)->AllocBegin);
+                    EXPECT_LT(Address,
+                              (*Found)->AllocBegin + (*Found)->AllocSize);
+                }
+            }
+        });
+    }
+
+    for (int W = 0; W < NumWriters; W++) {
+        Threads[W].join();
+    }
+    Done = true;
+    for (int R = 0; R < NumReaders; R++) {
+        Threads[NumWriters + R].join();
+    }
+
+    for (auto &AI : Stable) {
+        EXPECT_EQ(find(Index, AI->AllocBegin), AI);
+        Index.erase(AI);
+        EXPECT_EQ(find(Index, AI->AllocBegin), nullptr);
+    }
+}
@@ -0,0 +1,290 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how the sanitizer layer scales with the number of threads which
+// allocate device USM, pass it to a kernel, launch the kernel and free the
+// memory. Every step looks the allocation up or updates the allocation index
+// of the layer. The mock adapter is made to report a CPU device and to hand
+// out real host memory, so that the layer takes its CPU shadow memory paths.
+//
+// Usage:
+//   bench-sanitizer-asan [iterationsPerThread] [maxThreads]
+//
+// The quarantine can be enabled with UR_LAYER_ASAN_OPTIONS=quarantine_size_mb:N
+
+#include <ur_api.h>
+#include <ur_mock_helpers.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void check(ur_result_t result, const char *call) {
+    if (result != UR_RESULT_SUCCESS) {
+        std::fprintf(stderr, "%s failed with %d\n", call, result);
+        std::exit(1);
+    }
+}
+
+#define CHECK(call) check(call, #call)
+
+ur_context_handle_t benchContext = nullptr;
+ur_device_handle_t benchDevice = nullptr;
+ur_program_handle_t benchProgram = nullptr;
+
+template <typename T>
+ur_result_t returnValue(size_t propSize, void *pPropValue,
+                        size_t *pPropSizeRet, const T &value) {
+    if (pPropSizeRet) {
+        *pPropSizeRet = sizeof(T);
+    }
+    if (pPropValue) {
+        std::memcpy(pPropValue, &value, std::min(propSize, sizeof(T)));
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t replaceDeviceGetInfo(void *pParams) {
+    auto &params = *static_cast<ur_device_get_info_params_t *>(pParams);
+    switch (*params.ppropName) {
+    case UR_DEVICE_INFO_TYPE:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, UR_DEVICE_TYPE_CPU);
+    case UR_DEVICE_INFO_MEM_BASE_ADDR_ALIGN:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, size_t(16));
+    default:
+        if (*params.ppPropValue) {
+            std::memset(*params.ppPropValue, 0, *params.ppropSize);
+        }
+        return UR_RESULT_SUCCESS;
+    }
+}
+
+ur_result_t replaceQueueGetInfo(void *pParams) {
+    auto &params = *static_cast<ur_queue_get_info_params_t *>(pParams);
+    switch (*params.ppropName) {
+    case UR_QUEUE_INFO_CONTEXT:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, benchContext);
+    case UR_QUEUE_INFO_DEVICE:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, benchDevice);
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
+ur_result_t replaceKernelGetInfo(void *pParams) {
+    auto &params = *static_cast<ur_kernel_get_info_params_t *>(pParams);
+    switch (*params.ppropName) {
+    case UR_KERNEL_INFO_CONTEXT:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, benchContext);
+    case UR_KERNEL_INFO_PROGRAM:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, benchProgram);
+    case UR_KERNEL_INFO_NUM_ARGS:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, uint32_t(1));
+    case UR_KERNEL_INFO_FUNCTION_NAME: {
+        const char name[] = "kernel";
+        if (*params.ppPropSizeRet) {
+            **params.ppPropSizeRet = sizeof(name);
+        }
+        if (*params.ppPropValue) {
+            std::memcpy(*params.ppPropValue, name,
+                        std::min(*params.ppropSize, sizeof(name)));
+        }
+        return UR_RESULT_SUCCESS;
+    }
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
+ur_result_t replaceProgramGetInfo(void *pParams) {
+    auto &params = *static_cast<ur_program_get_info_params_t *>(pParams);
+    switch (*params.ppropName) {
+    case UR_PROGRAM_INFO_CONTEXT:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, benchContext);
+    case UR_PROGRAM_INFO_DEVICES:
+        return returnValue(*params.ppropSize, *params.ppPropValue,
+                           *params.ppPropSizeRet, benchDevice);
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
+// The program has no device globals
+ur_result_t replaceDeviceGlobalVariableRead(void *) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+}
+
+ur_result_t allocateMemory(size_t size, void **ppMem) {
+    *ppMem = std::calloc(1, size);
+    return *ppMem ? UR_RESULT_SUCCESS : UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+ur_result_t replaceUSMDeviceAlloc(void *pParams) {
+    auto &params = *static_cast<ur_usm_device_alloc_params_t *>(pParams);
+    return allocateMemory(*params.psize, *params.pppMem);
+}
+
+ur_result_t replaceUSMHostAlloc(void *pParams) {
+    auto &params = *static_cast<ur_usm_host_alloc_params_t *>(pParams);
+    return allocateMemory(*params.psize, *params.pppMem);
+}
+
+ur_result_t replaceUSMSharedAlloc(void *pParams) {
+    auto &params = *static_cast<ur_usm_shared_alloc_params_t *>(pParams);
+    return allocateMemory(*params.psize, *params.pppMem);
+}
+
+ur_result_t replaceUSMFree(void *pParams) {
+    auto &params = *static_cast<ur_usm_free_params_t *>(pParams);
+    std::free(*params.ppMem);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t replaceUSMGetMemAllocInfo(void *pParams) {
+    auto &params = *static_cast<ur_usm_get_mem_alloc_info_params_t *>(pParams);
+    if (*params.ppropName != UR_USM_ALLOC_INFO_DEVICE) {
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+    return returnValue(*params.ppropSize, *params.ppPropValue,
+                       *params.ppPropSizeRet, benchDevice);
+}
+
+void setCallbacks() {
+    auto &callbacks = mock::getCallbacks();
+    callbacks.set_replace_callback("urDeviceGetInfo", &replaceDeviceGetInfo);
+    callbacks.set_replace_callback("urQueueGetInfo", &replaceQueueGetInfo);
+    callbacks.set_replace_callback("urKernelGetInfo", &replaceKernelGetInfo);
+    callbacks.set_replace_callback("urProgramGetInfo", &replaceProgramGetInfo);
+    callbacks.set_replace_callback("urEnqueueDeviceGlobalVariableRead",
+                                   &replaceDeviceGlobalVariableRead);
+    callbacks.set_replace_callback("urUSMDeviceAlloc", &replaceUSMDeviceAlloc);
+    callbacks.set_replace_callback("urUSMHostAlloc", &replaceUSMHostAlloc);
+    callbacks.set_replace_callback("urUSMSharedAlloc", &replaceUSMSharedAlloc);
+    callbacks.set_replace_callback("urUSMFree", &replaceUSMFree);
+    callbacks.set_replace_callback("urUSMGetMemAllocInfo",
+                                   &replaceUSMGetMemAllocInfo);
+}
+
+double iterationsPerSecond(unsigned numThreads, size_t iterationsPerThread) {
+    std::vector<ur_queue_handle_t> queues(numThreads);
+    std::vector<ur_kernel_handle_t> kernels(numThreads);
+    for (unsigned t = 0; t < numThreads; t++) {
+        CHECK(urQueueCreate(benchContext, benchDevice, nullptr, &queues[t]));
+        CHECK(urKernelCreate(benchProgram, "kernel", &kernels[t]));
+    }
+
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, queue = queues[t], kernel = kernels[t]] {
+            const size_t offset = 0;
+            const size_t size = 1024;
+            ready++;
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < iterationsPerThread; i++) {
+                void *ptr = nullptr;
+                CHECK(urUSMDeviceAlloc(benchContext, benchDevice, nullptr,
+                                       nullptr, 64 + (i % 16) * 64, &ptr));
+                CHECK(urKernelSetArgPointer(kernel, 0, nullptr, ptr));
+                CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                            nullptr, 0, nullptr, nullptr));
+                CHECK(urUSMFree(benchContext, ptr));
+            }
+        });
+    }
+
+    while (ready != numThreads) {
+        std::this_thread::yield();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - begin;
+
+    for (unsigned t = 0; t < numThreads; t++) {
+        CHECK(urKernelRelease(kernels[t]));
+        CHECK(urQueueRelease(queues[t]));
+    }
+    return numThreads * iterationsPerThread / elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t iterationsPerThread =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 0) : 0;
+    unsigned maxThreads = argc > 2 ? std::strtoul(argv[2], nullptr, 0) : 0;
+    if (iterationsPerThread == 0) {
+        iterationsPerThread = 20000;
+    }
+    if (maxThreads == 0) {
+        maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    ur_loader_config_handle_t loaderConfig = nullptr;
+    CHECK(urLoaderConfigCreate(&loaderConfig));
+    CHECK(urLoaderConfigSetMockingEnabled(loaderConfig, true));
+    CHECK(urLoaderConfigEnableLayer(loaderConfig, "UR_LAYER_ASAN"));
+    CHECK(urLoaderInit(0, loaderConfig));
+    setCallbacks();
+
+    ur_adapter_handle_t adapter = nullptr;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &benchDevice, nullptr));
+    CHECK(urContextCreate(1, &benchDevice, nullptr, &benchContext));
+    const unsigned char il[4] = {};
+    CHECK(urProgramCreateWithIL(benchContext, il, sizeof(il), nullptr,
+                                &benchProgram));
+    CHECK(urProgramBuild(benchContext, benchProgram, nullptr));
+
+    // Warms up the layer and the allocators.
+    iterationsPerSecond(1, iterationsPerThread / 10);
+
+    std::printf("%8s %16s %14s %10s\n", "threads", "iterations/s",
+                "ns/iteration", "speedup");
+    double single = 0;
+    for (unsigned numThreads = 1; numThreads <= maxThreads;
+         numThreads = numThreads < maxThreads
+                          ? std::min(2 * numThreads, maxThreads)
+                          : numThreads + 1) {
+        double rate = iterationsPerSecond(numThreads, iterationsPerThread);
+        if (numThreads == 1) {
+            single = rate;
+        }
+        std::printf("%8u %16.0f %14.1f %10.2f\n", numThreads, rate,
+                    1e9 * numThreads / rate, rate / single);
+    }
+
+    CHECK(urProgramRelease(benchProgram));
+    CHECK(urContextRelease(benchContext));
+    CHECK(urDeviceRelease(benchDevice));
+    CHECK(urAdapterRelease(adapter));
+    CHECK(urLoaderTearDown());
+    CHECK(urLoaderConfigRelease(loaderConfig));
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file quarantine.cpp
+ *
+ */
+
+#include "asan_quarantine.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+// The quarantine never uses the handles, so they are made up
+template <typename T> T fakeHandle(uptr Value) {
+    return reinterpret_cast<T>(Value);
+}
+
+const auto ContextA = fakeHandle<ur_context_handle_t>(0x10);
+const auto ContextB = fakeHandle<ur_context_handle_t>(0x20);
+const auto Device0 = fakeHandle<ur_device_handle_t>(0x100);
+const auto Device1 = fakeHandle<ur_device_handle_t>(0x200);
+
+std::shared_ptr<AllocInfo> makeAlloc(ur_context_handle_t Context,
+                                     size_t Size) {
+    auto AI = std::make_shared<AllocInfo>();
+    AI->Context = Context;
+    AI->AllocSize = Size;
+    AI->IsReleased = true;
+    return AI;
+}
+
+// Records the allocations released by the quarantine
+struct Released {
+    std::mutex Mutex;
+    std::vector<std::shared_ptr<AllocInfo>> List;
+
+    Quarantine::ReleaseCallback callback() {
+        return [this](const std::shared_ptr<AllocInfo> &AI) {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            List.push_back(AI);
+        };
+    }
+
+    std::vector<std::shared_ptr<AllocInfo>> take() {
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        return std::move(List);
+    }
+
+    // The recycler runs in the background
+    bool waitFor(size_t Count) {
+        auto Deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (std::chrono::steady_clock::now() < Deadline) {
+            {
+                std::scoped_lock<std::mutex> Guard(Mutex);
+                if (List.size() >= Count) {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+};
+
+using AllocSet = std::set<std::shared_ptr<AllocInfo>>;
+
+AllocSet toSet(const std::vector<std::shared_ptr<AllocInfo>> &List) {
+    return AllocSet(List.begin(), List.end());
+}
+
+constexpr size_t KiB = 1024;
+
+} // namespace
+
+TEST(Quarantine, PurgeReleasesTheAllocationsOfTheContext) {
+    Released R;
+    Quarantine Q(size_t(1) << 40, R.callback());
+
+    AllocSet OfA, OfB;
+    // Enough for some batches to move to the device queues, and some to stay
+    // in the batch of the thread
+    for (int I = 0; I < 300; I++) {
+        auto Context = I % 3 ? ContextA : ContextB;
+        auto AI = makeAlloc(Context, 256);
+        (Context == ContextA ? OfA : OfB).insert(AI);
+        Q.put(I % 2 ? Device0 : Device1, AI);
+    }
+    // And in the batches of a thread which exited
+    std::thread([&]() {
+        for (int I = 0; I < 10; I++) {
+            auto AI = makeAlloc(ContextA, 256);
+            OfA.insert(AI);
+            Q.put(Device0, AI);
+        }
+    }).join();
+
+    Q.purge(ContextA);
+    EXPECT_EQ(toSet(R.take()), OfA);
+
+    Q.purge(ContextB);
+    EXPECT_EQ(toSet(R.take()), OfB);
+
+    Q.purge(ContextA);
+    EXPECT_TRUE(R.take().empty());
+}
+
+TEST(Quarantine, RecyclesTheOldestAllocations) {
+    Released R;
+    constexpr size_t MaxSize = 64 * KiB;
+    Quarantine Q(MaxSize, R.callback());
+
+    // Each allocation is big enough to go to the device queue right away
+    std::vector<std::shared_ptr<AllocInfo>> Put;
+    for (int I = 0; I < 100; I++) {
+        Put.push_back(makeAlloc(ContextA, 4 * KiB));
+        Q.put(Device0, Put.back());
+    }
+
+    // At most the size of the quarantine is kept
+    size_t MaxKept = MaxSize / (4 * KiB);
+    ASSERT_TRUE(R.waitFor(Put.size() - MaxKept));
+    auto List = R.take();
+    for (size_t I = 0; I < List.size(); I++) {
+        ASSERT_EQ(List[I], Put[I]);
+    }
+
+    Q.purge(ContextA);
+    EXPECT_EQ(List.size() + R.take().size(), Put.size());
+}
+
+TEST(Quarantine, KeepsTheAllocationsOfExitedThreads) {
+    Released R;
+    constexpr size_t MaxSize = 64 * KiB;
+    Quarantine Q(MaxSize, R.callback());
+
+    // Too small to leave the batch of the thread
+    AllocSet OfThread;
+    std::thread([&]() {
+        for (int I = 0; I < 3; I++) {
+            auto AI = makeAlloc(ContextA, 256);
+            OfThread.insert(AI);
+            Q.put(Device0, AI);
+        }
+    }).join();
+
+    // Goes over the quarantine size, all is recycled
+    auto Large = makeAlloc(ContextB, 2 * MaxSize);
+    Q.put(Device0, Large);
+    ASSERT_TRUE(R.waitFor(OfThread.size() + 1));
+
+    auto Expected = OfThread;
+    Expected.insert(Large);
+    EXPECT_EQ(toSet(R.take()), Expected);
+}
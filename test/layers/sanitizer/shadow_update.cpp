@@ -0,0 +1,127 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file shadow_update.cpp
+ *
+ */
+
+#include "asan_libdevice.hpp"
+#include "asan_shadow_update.hpp"
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+using Ranges = std::vector<std::tuple<uptr, uptr, u8>>;
+
+Ranges ranges(const ShadowUpdatePlan &Plan) {
+    Ranges Result;
+    for (auto &[Begin, R] : Plan.ranges()) {
+        Result.emplace_back(Begin, R.End, R.Value);
+    }
+    return Result;
+}
+
+constexpr uptr G = ASAN_SHADOW_GRANULARITY;
+
+} // namespace
+
+TEST(ShadowUpdatePlan, RoundsToTheGranularity) {
+    ShadowUpdatePlan Plan;
+    Plan.add(0x1000, 0, 1);
+    EXPECT_TRUE(Plan.empty());
+
+    Plan.add(0x1000 + 3, 2 * G, 1);
+    EXPECT_EQ(ranges(Plan), (Ranges{{0x1000, 0x1000 + 3 * G, 1}}));
+
+    Plan.clear();
+    EXPECT_TRUE(Plan.empty());
+}
+
+TEST(ShadowUpdatePlan, LaterRangesOverride) {
+    ShadowUpdatePlan Plan;
+    Plan.add(0x1000, 8 * G, 1);
+    // Splits the first range
+    Plan.add(0x1000 + 2 * G, 2 * G, 2);
+    EXPECT_EQ(ranges(Plan), (Ranges{{0x1000, 0x1000 + 2 * G, 1},
+                                    {0x1000 + 2 * G, 0x1000 + 4 * G, 2},
+                                    {0x1000 + 4 * G, 0x1000 + 8 * G, 1}}));
+
+    // Covers the end of one range, the whole of another and the beginning of
+    // the last one
+    Plan.add(0x1000 + G, 4 * G, 3);
+    EXPECT_EQ(ranges(Plan), (Ranges{{0x1000, 0x1000 + G, 1},
+                                    {0x1000 + G, 0x1000 + 5 * G, 3},
+                                    {0x1000 + 5 * G, 0x1000 + 8 * G, 1}}));
+
+    // Covers everything
+    Plan.add(0x1000 - G, 10 * G, 4);
+    EXPECT_EQ(ranges(Plan), (Ranges{{0x1000 - G, 0x1000 + 9 * G, 4}}));
+}
+
+TEST(ShadowUpdatePlan, MergesAdjacentRangesWithTheSameValue) {
+    ShadowUpdatePlan Plan;
+    Plan.add(0x1000, 2 * G, 1);
+    Plan.add(0x1000 + 4 * G, 2 * G, 1);
+    Plan.add(0x1000 + 2 * G, G, 2);
+    EXPECT_EQ(ranges(Plan), (Ranges{{0x1000, 0x1000 + 2 * G, 1},
+                                    {0x1000 + 2 * G, 0x1000 + 3 * G, 2},
+                                    {0x1000 + 4 * G, 0x1000 + 6 * G, 1}}));
+
+    // Fills the gap and joins both neighbours
+    Plan.add(0x1000 + 2 * G, 2 * G, 1);
+    EXPECT_EQ(ranges(Plan), (Ranges{{0x1000, 0x1000 + 6 * G, 1}}));
+}
+
+TEST(ShadowUpdatePlan, LiveAllocation) {
+    AllocInfo AI;
+    AI.Type = AllocType::DEVICE_USM;
+    AI.AllocBegin = 0x10000;
+    AI.UserBegin = AI.AllocBegin + 4 * G;
+    AI.UserEnd = AI.UserBegin + 5 * G + 3;
+    AI.AllocSize = 16 * G;
+
+    ShadowUpdatePlan Plan;
+    Plan.add(AI);
+    u8 Redzone = static_cast<u8>(kUsmDeviceRedzoneMagic);
+    EXPECT_EQ(ranges(Plan),
+              (Ranges{{AI.AllocBegin, AI.UserBegin, Redzone},
+                      {AI.UserBegin, AI.UserBegin + 5 * G, 0},
+                      {AI.UserBegin + 5 * G, AI.UserBegin + 6 * G, 3},
+                      {AI.UserBegin + 6 * G, AI.AllocBegin + 16 * G,
+                       Redzone}}));
+
+    // The left redzone of a chunk belongs to its slab
+    AI.IsSuballocated = true;
+    Plan.clear();
+    Plan.add(AI);
+    EXPECT_EQ(ranges(Plan).front(),
+              std::make_tuple(AI.UserBegin, AI.UserBegin + 5 * G, u8(0)));
+}
+
+TEST(ShadowUpdatePlan, ReleasedAllocationOverridesTheLiveOne) {
+    AllocInfo AI;
+    AI.Type = AllocType::HOST_USM;
+    AI.AllocBegin = 0x10000;
+    AI.UserBegin = AI.AllocBegin + 2 * G;
+    AI.UserEnd = AI.UserBegin + 4 * G;
+    AI.AllocSize = 8 * G;
+
+    ShadowUpdatePlan Plan;
+    Plan.add(AI);
+    AI.IsReleased = true;
+    Plan.add(AI);
+    EXPECT_EQ(ranges(Plan),
+              (Ranges{{AI.AllocBegin, AI.AllocBegin + 8 * G,
+                       static_cast<u8>(kUsmHostDeallocatedMagic)}}));
+}
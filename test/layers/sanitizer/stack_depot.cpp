@@ -0,0 +1,96 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file stack_depot.cpp
+ *
+ */
+
+#include "stack_depot.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+// The depot only compares the frame addresses, so they are made up
+std::vector<BacktraceFrame> makeStack(uptr Seed, size_t Size) {
+    std::vector<BacktraceFrame> Frames;
+    for (size_t I = 0; I < Size; I++) {
+        Frames.push_back(reinterpret_cast<BacktraceFrame>(Seed * 0x1000 + I));
+    }
+    return Frames;
+}
+
+} // namespace
+
+TEST(StackDepot, PutInternsEachStackOnce) {
+    auto Depot = std::make_unique<StackDepot>();
+    auto A = makeStack(1, 8);
+    auto B = makeStack(2, 8);
+    // A prefix of A, which must not be mistaken for it
+    auto C = makeStack(1, 4);
+
+    StackId IdA = Depot->put(A.data(), A.size());
+    StackId IdB = Depot->put(B.data(), B.size());
+    StackId IdC = Depot->put(C.data(), C.size());
+    EXPECT_NE(IdA, 0u);
+    EXPECT_NE(IdA, IdB);
+    EXPECT_NE(IdA, IdC);
+    EXPECT_NE(IdB, IdC);
+
+    auto Copy = A;
+    EXPECT_EQ(Depot->put(Copy.data(), Copy.size()), IdA);
+    EXPECT_EQ(Depot->put(B.data(), B.size()), IdB);
+
+    EXPECT_EQ(Depot->get(IdA).stack, A);
+    EXPECT_EQ(Depot->get(IdB).stack, B);
+    EXPECT_EQ(Depot->get(IdC).stack, C);
+}
+
+TEST(StackDepot, EmptyAndUnknownStacks) {
+    auto Depot = std::make_unique<StackDepot>();
+    EXPECT_EQ(Depot->put(nullptr, 0), 0u);
+    EXPECT_TRUE(Depot->get(0).stack.empty());
+
+    auto A = makeStack(1, 4);
+    StackId Id = Depot->put(A.data(), A.size());
+    EXPECT_TRUE(Depot->get(Id + 1).stack.empty());
+    EXPECT_TRUE(Depot->get(~StackId(0)).stack.empty());
+}
+
+TEST(StackDepot, ConcurrentPutsAgreeOnIds) {
+    auto Depot = std::make_unique<StackDepot>();
+    constexpr size_t NumThreads = 8;
+    constexpr size_t NumStacks = 2000;
+
+    std::vector<std::vector<StackId>> Ids(NumThreads);
+    std::vector<std::thread> Threads;
+    for (size_t T = 0; T < NumThreads; T++) {
+        Threads.emplace_back([&, T]() {
+            for (size_t S = 0; S < NumStacks; S++) {
+                auto Frames = makeStack(S, 1 + S % 16);
+                Ids[T].push_back(Depot->put(Frames.data(), Frames.size()));
+            }
+        });
+    }
+    for (auto &Thread : Threads) {
+        Thread.join();
+    }
+
+    for (size_t S = 0; S < NumStacks; S++) {
+        for (size_t T = 1; T < NumThreads; T++) {
+            ASSERT_EQ(Ids[T][S], Ids[0][S]);
+        }
+        EXPECT_EQ(Depot->get(Ids[0][S]).stack, makeStack(S, 1 + S % 16));
+    }
+}
@@ -0,0 +1,197 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file suballocator.cpp
+ *
+ */
+
+#include "asan_suballocator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+// Slabs come from the heap, and can be made to fail
+struct FakeUSM {
+    static inline size_t NumAllocs = 0;
+    static inline size_t NumFrees = 0;
+    static inline bool Fail = false;
+
+    static ur_result_t alloc(size_t Size, void **Ptr) {
+        if (Fail) {
+            return UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+        NumAllocs++;
+        *Ptr = std::malloc(Size);
+        return UR_RESULT_SUCCESS;
+    }
+
+    static ur_result_t UR_APICALL deviceAlloc(ur_context_handle_t,
+                                              ur_device_handle_t,
+                                              const ur_usm_desc_t *,
+                                              ur_usm_pool_handle_t,
+                                              size_t Size, void **Ptr) {
+        return alloc(Size, Ptr);
+    }
+
+    static ur_result_t UR_APICALL hostAlloc(ur_context_handle_t,
+                                            const ur_usm_desc_t *,
+                                            ur_usm_pool_handle_t, size_t Size,
+                                            void **Ptr) {
+        return alloc(Size, Ptr);
+    }
+
+    static ur_result_t UR_APICALL free(ur_context_handle_t, void *Ptr) {
+        NumFrees++;
+        std::free(Ptr);
+        return UR_RESULT_SUCCESS;
+    }
+
+    static ur_usm_dditable_t table() {
+        ur_usm_dditable_t Table = {};
+        Table.pfnDeviceAlloc = deviceAlloc;
+        Table.pfnSharedAlloc = deviceAlloc;
+        Table.pfnHostAlloc = hostAlloc;
+        Table.pfnFree = free;
+        return Table;
+    }
+};
+
+struct SuballocatorTest : ::testing::Test {
+    void SetUp() override {
+        FakeUSM::NumAllocs = 0;
+        FakeUSM::NumFrees = 0;
+        FakeUSM::Fail = false;
+    }
+
+    Suballocator::Chunk allocate(Suballocator &SA, uptr RZSize, size_t Size) {
+        Suballocator::Chunk Chunk{};
+        EXPECT_EQ(SA.allocate(RZSize, Size, Chunk,
+                              [&](const Suballocator::Chunk &Slab) {
+                                  Slabs.push_back(Slab);
+                              }),
+                  UR_RESULT_SUCCESS);
+        return Chunk;
+    }
+
+    // Whether the chunk and its right redzone are inside a slab
+    bool inSlab(const Suballocator::Chunk &Chunk, uptr RZSize) {
+        for (auto &Slab : Slabs) {
+            if (Chunk.Begin >= Slab.Begin &&
+                Chunk.Begin + Chunk.Size + RZSize <= Slab.Begin + Slab.Size) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ur_usm_dditable_t USM = FakeUSM::table();
+    const ur_context_handle_t Context =
+        reinterpret_cast<ur_context_handle_t>(0x10);
+    const ur_device_handle_t Device =
+        reinterpret_cast<ur_device_handle_t>(0x20);
+    std::vector<Suballocator::Chunk> Slabs;
+};
+
+} // namespace
+
+TEST_F(SuballocatorTest, CanSuballocate) {
+    EXPECT_TRUE(Suballocator::canSuballocate(AllocType::DEVICE_USM, nullptr,
+                                             nullptr, 64));
+    EXPECT_TRUE(Suballocator::canSuballocate(
+        AllocType::HOST_USM, nullptr, nullptr,
+        Suballocator::kMaxSuballocatedSize));
+    EXPECT_FALSE(Suballocator::canSuballocate(
+        AllocType::SHARED_USM, nullptr, nullptr,
+        Suballocator::kMaxSuballocatedSize + 1));
+    EXPECT_FALSE(Suballocator::canSuballocate(AllocType::MEM_BUFFER, nullptr,
+                                              nullptr, 64));
+
+    auto Pool = reinterpret_cast<ur_usm_pool_handle_t>(0x30);
+    EXPECT_FALSE(
+        Suballocator::canSuballocate(AllocType::DEVICE_USM, Pool, nullptr, 64));
+
+    ur_usm_desc_t Desc = {UR_STRUCTURE_TYPE_USM_DESC, nullptr,
+                          UR_USM_ADVICE_FLAG_DEFAULT, 0};
+    EXPECT_TRUE(Suballocator::canSuballocate(AllocType::DEVICE_USM, nullptr,
+                                             &Desc, 64));
+    Desc.hints = UR_USM_ADVICE_FLAG_SET_READ_MOSTLY;
+    EXPECT_FALSE(Suballocator::canSuballocate(AllocType::DEVICE_USM, nullptr,
+                                              &Desc, 64));
+}
+
+TEST_F(SuballocatorTest, ChunksShareTheirRedzones) {
+    constexpr uptr RZSize = 32;
+    Suballocator SA(Context, Device, AllocType::DEVICE_USM, USM);
+
+    auto First = allocate(SA, RZSize, 100);
+    auto Second = allocate(SA, RZSize, 100);
+    ASSERT_EQ(Slabs.size(), 1u);
+
+    // A redzone then the room of the user memory, aligned to the redzone
+    EXPECT_EQ(First.Begin % RZSize, 0u);
+    EXPECT_EQ(First.Size % RZSize, 0u);
+    EXPECT_GE(First.Size, RZSize + 100);
+    EXPECT_EQ(Second.Size, First.Size);
+    // The redzone of a chunk is the right redzone of the previous one
+    EXPECT_EQ(Second.Begin, First.Begin + First.Size);
+    // The last chunk of the slab still has its right redzone
+    EXPECT_TRUE(inSlab(First, RZSize));
+    EXPECT_TRUE(inSlab(Second, RZSize));
+}
+
+TEST_F(SuballocatorTest, ReusesReleasedChunksOfTheSameClass) {
+    constexpr uptr RZSize = 16;
+    Suballocator SA(Context, Device, AllocType::HOST_USM, USM);
+
+    auto Small = allocate(SA, RZSize, 64);
+    auto Large = allocate(SA, RZSize, 1024);
+    EXPECT_NE(Small.Size, Large.Size);
+
+    SA.deallocate(Small, RZSize);
+    SA.deallocate(Large, RZSize);
+
+    // Rounded to the same size class
+    auto Reused = allocate(SA, RZSize, 60);
+    EXPECT_EQ(Reused.Begin, Small.Begin);
+    EXPECT_EQ(Reused.Size, Small.Size);
+
+    // A chunk is only reused for its redzone size
+    auto OtherRZ = allocate(SA, 2 * RZSize, 1024);
+    EXPECT_NE(OtherRZ.Begin, Large.Begin);
+    EXPECT_EQ(allocate(SA, RZSize, 1024).Begin, Large.Begin);
+}
+
+TEST_F(SuballocatorTest, AllocatesAndFreesSlabs) {
+    constexpr uptr RZSize = 16;
+    {
+        Suballocator SA(Context, Device, AllocType::SHARED_USM, USM);
+        std::set<uptr> Chunks;
+        for (int I = 0; I < 1000; I++) {
+            auto Chunk = allocate(SA, RZSize, 256);
+            EXPECT_TRUE(Chunks.insert(Chunk.Begin).second);
+            EXPECT_TRUE(inSlab(Chunk, RZSize));
+        }
+        EXPECT_GT(Slabs.size(), 1u);
+        EXPECT_EQ(FakeUSM::NumAllocs, Slabs.size());
+
+        // The failure of a new slab is reported
+        FakeUSM::Fail = true;
+        Suballocator::Chunk Chunk{};
+        EXPECT_EQ(SA.allocate(RZSize, 8192, Chunk,
+                              [](const Suballocator::Chunk &) {}),
+                  UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY);
+    }
+    EXPECT_EQ(FakeUSM::NumFrees, FakeUSM::NumAllocs);
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.hpp"
+
+TEST(AdapterBackendNameTest, FromLibraryNames) {
+    EXPECT_EQ(ur_loader::adapterBackendName(
+                  MAKE_LIBRARY_NAME("ur_adapter_level_zero", "0")),
+              "level_zero");
+    EXPECT_EQ(ur_loader::adapterBackendName(
+                  fs::path("/opt/ur/lib") /
+                  MAKE_LIBRARY_NAME("ur_adapter_native_cpu", "0")),
+              "native_cpu");
+    EXPECT_EQ(ur_loader::adapterBackendName("ur_adapter_cuda"), "cuda");
+    EXPECT_EQ(ur_loader::adapterBackendName("libsomething.so"), "");
+}
+
+TEST(IsBackendSelectedTest, NoSelector) {
+    EXPECT_TRUE(ur_loader::isBackendSelected("cuda", std::nullopt));
+}
+
+TEST(IsBackendSelectedTest, AcceptTerms) {
+    EnvVarMap ods{{"level_zero", {"*"}}};
+    EXPECT_TRUE(ur_loader::isBackendSelected("level_zero", ods));
+    EXPECT_FALSE(ur_loader::isBackendSelected("cuda", ods));
+    EXPECT_FALSE(ur_loader::isBackendSelected("native_cpu", ods));
+
+    ods = {{"Level_Zero", {"gpu"}}, {"cuda", {"0"}}};
+    EXPECT_TRUE(ur_loader::isBackendSelected("level_zero", ods));
+    EXPECT_TRUE(ur_loader::isBackendSelected("cuda", ods));
+    EXPECT_FALSE(ur_loader::isBackendSelected("hip", ods));
+
+    ods = {{"*", {"cpu"}}};
+    EXPECT_TRUE(ur_loader::isBackendSelected("opencl", ods));
+    EXPECT_TRUE(ur_loader::isBackendSelected("native_cpu", ods));
+}
+
+TEST(IsBackendSelectedTest, DiscardTerms) {
+    EnvVarMap ods{{"!cuda", {"*"}}};
+    EXPECT_FALSE(ur_loader::isBackendSelected("cuda", ods));
+    EXPECT_TRUE(ur_loader::isBackendSelected("hip", ods));
+
+    // Only some devices of the backend are discarded.
+    ods = {{"!cuda", {"1"}}};
+    EXPECT_TRUE(ur_loader::isBackendSelected("cuda", ods));
+
+    ods = {{"*", {"*"}}, {"!*", {"*"}}};
+    EXPECT_FALSE(ur_loader::isBackendSelected("opencl", ods));
+}
+
+TEST(IsBackendSelectedTest, UnknownBackendsAreAlwaysSelected) {
+    EnvVarMap ods{{"level_zero", {"*"}}};
+    EXPECT_TRUE(ur_loader::isBackendSelected("mock", ods));
+    EXPECT_TRUE(ur_loader::isBackendSelected("", ods));
+}
+
+TEST_F(adapterDiscoveryTest, CacheRoundTrip) {
+    auto cacheFile = tmpDir / "cache" / "adapters";
+    std::vector<fs::path> hip{MAKE_LIBRARY_NAME("ur_adapter_hip", "0")};
+    std::vector<fs::path> cuda{MAKE_LIBRARY_NAME("ur_adapter_cuda", "0")};
+    {
+        ur_loader::AdapterDiscoveryCache cache(cacheFile);
+        EXPECT_FALSE(cache.isKnownAbsent(hip));
+        cache.update(hip, true);
+        cache.update(cuda, false);
+        EXPECT_TRUE(cache.isKnownAbsent(hip));
+        cache.save();
+    }
+    ASSERT_TRUE(fs::exists(cacheFile));
+
+    ur_loader::AdapterDiscoveryCache cache(cacheFile);
+    EXPECT_TRUE(cache.isKnownAbsent(hip));
+    EXPECT_FALSE(cache.isKnownAbsent(cuda));
+
+    // The adapter was found after all.
+    cache.update(hip, false);
+    cache.save();
+    EXPECT_FALSE(ur_loader::AdapterDiscoveryCache(cacheFile).isKnownAbsent(hip));
+}
+
+TEST_F(adapterDiscoveryTest, CacheEntriesFollowTheCandidates) {
+    auto cacheFile = tmpDir / "adapters";
+    auto candidate = tmpDir / MAKE_LIBRARY_NAME("ur_adapter_hip", "0");
+    std::vector<fs::path> hip{candidate};
+
+    ur_loader::AdapterDiscoveryCache cache(cacheFile);
+    cache.update(hip, true);
+    EXPECT_TRUE(cache.isKnownAbsent(hip));
+    EXPECT_FALSE(cache.isKnownAbsent({candidate, "other"}));
+
+    // Installing the adapter invalidates the entry.
+    std::ofstream(candidate) << "adapter";
+    EXPECT_FALSE(cache.isKnownAbsent(hip));
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_ADAPTER_DISCOVERY_TEST_FIXTURES_H
+#define UR_ADAPTER_DISCOVERY_TEST_FIXTURES_H
+
+#include "ur_adapter_discovery.hpp"
+#include "ur_util.hpp"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+
+struct adapterDiscoveryTest : ::testing::Test {
+    fs::path tmpDir;
+
+    void SetUp() override {
+        tmpDir = fs::temp_directory_path() /
+                 ("ur-adapter-discovery-" +
+                  std::to_string(std::random_device{}()));
+        ASSERT_TRUE(fs::create_directories(tmpDir));
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(tmpDir, ec);
+    }
+};
+
+#endif // UR_ADAPTER_DISCOVERY_TEST_FIXTURES_H
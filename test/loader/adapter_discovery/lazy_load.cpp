@@ -0,0 +1,128 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.hpp"
+
+#include <ur_api.h>
+
+#include <cstdlib>
+#include <vector>
+
+// Loads the mock adapter with UR_ADAPTERS_LAZY_LOAD, the loader is initialized
+// again by each test so that it reads the environment set by the test.
+struct lazyLoadTest : adapterDiscoveryTest {
+    fs::path mockAdapter;
+
+    void SetUp() override {
+        auto mockPath = ur_getenv("TEST_MOCK_ADAPTER");
+        if (!mockPath) {
+            GTEST_SKIP() << "TEST_MOCK_ADAPTER isn't set";
+        }
+        mockAdapter = *mockPath;
+        adapterDiscoveryTest::SetUp();
+        ASSERT_EQ(setenv("UR_ADAPTERS_LAZY_LOAD", "1", 1), 0);
+    }
+
+    void TearDown() override {
+        unsetenv("UR_ADAPTERS_LAZY_LOAD");
+        unsetenv("UR_ADAPTERS_FORCE_LOAD");
+        unsetenv("UR_ADAPTERS_DISCOVERY_CACHE");
+        unsetenv("ONEAPI_DEVICE_SELECTOR");
+        adapterDiscoveryTest::TearDown();
+    }
+
+    // The mock adapter under the name of the adapter of backend.
+    fs::path mockAdapterAs(const std::string &backend) {
+        auto path = tmpDir / ("libur_adapter_" + backend + ".so.0");
+        fs::create_symlink(mockAdapter, path);
+        return path;
+    }
+
+    void forceLoad(const std::vector<fs::path> &paths) {
+        std::string value;
+        for (const auto &path : paths) {
+            value += (value.empty() ? "" : ",") + path.string();
+        }
+        ASSERT_EQ(setenv("UR_ADAPTERS_FORCE_LOAD", value.c_str(), 1), 0);
+    }
+
+    // Initializes the loader, gets the adapters and the platforms, and tears
+    // the loader down.
+    void getAdapters(uint32_t expectedNumAdapters) {
+        ASSERT_EQ(urLoaderInit(0, nullptr), UR_RESULT_SUCCESS);
+        uint32_t numAdapters = 0;
+        ASSERT_EQ(urAdapterGet(0, nullptr, &numAdapters), UR_RESULT_SUCCESS);
+        EXPECT_EQ(numAdapters, expectedNumAdapters);
+
+        std::vector<ur_adapter_handle_t> adapters(numAdapters);
+        if (numAdapters) {
+            ASSERT_EQ(urAdapterGet(numAdapters, adapters.data(), nullptr),
+                      UR_RESULT_SUCCESS);
+            uint32_t numPlatforms = 0;
+            ASSERT_EQ(urPlatformGet(adapters.data(), numAdapters, 0, nullptr,
+                                    &numPlatforms),
+                      UR_RESULT_SUCCESS);
+            EXPECT_EQ(numPlatforms, numAdapters);
+        }
+        for (auto adapter : adapters) {
+            EXPECT_EQ(urAdapterRelease(adapter), UR_RESULT_SUCCESS);
+        }
+        ASSERT_EQ(urLoaderTearDown(), UR_RESULT_SUCCESS);
+    }
+};
+
+TEST_F(lazyLoadTest, AdaptersAreLoadedByAdapterGet) {
+    forceLoad({mockAdapter});
+    getAdapters(1);
+}
+
+TEST_F(lazyLoadTest, SelectorSkipsBackends) {
+    forceLoad({mockAdapterAs("cuda"), mockAdapterAs("hip")});
+    ASSERT_EQ(setenv("ONEAPI_DEVICE_SELECTOR", "hip:*", 1), 0);
+    getAdapters(1);
+    ASSERT_EQ(setenv("ONEAPI_DEVICE_SELECTOR", "!hip:*", 1), 0);
+    getAdapters(1);
+    ASSERT_EQ(setenv("ONEAPI_DEVICE_SELECTOR", "*:*", 1), 0);
+    getAdapters(2);
+}
+
+TEST_F(lazyLoadTest, DiscoveryCacheRecordsAbsentAdapters) {
+    // Exists, so the registry keeps it, but isn't a library.
+    auto broken = tmpDir / "libur_adapter_opencl.so.0";
+    std::ofstream(broken) << "not an adapter";
+    forceLoad({broken, mockAdapter});
+    auto cacheFile = tmpDir / "adapters.cache";
+    ASSERT_EQ(setenv("UR_ADAPTERS_DISCOVERY_CACHE", cacheFile.c_str(), 1), 0);
+
+    getAdapters(1);
+    ur_loader::AdapterDiscoveryCache cache(cacheFile);
+    EXPECT_TRUE(cache.isKnownAbsent({broken}));
+    EXPECT_FALSE(cache.isKnownAbsent({mockAdapter}));
+
+    // The next run skips the broken adapter and finds the same adapters.
+    getAdapters(1);
+}
+
+TEST_F(adapterDiscoveryTest, CacheEntriesFollowTheSearchPath) {
+    auto savedSearchPath = ur_getenv("LD_LIBRARY_PATH");
+    auto libDir = tmpDir / "lib";
+    ASSERT_EQ(setenv("LD_LIBRARY_PATH", libDir.c_str(), 1), 0);
+    std::vector<fs::path> hip{"libur_adapter_hip.so.0"};
+
+    ur_loader::AdapterDiscoveryCache cache(tmpDir / "adapters.cache");
+    cache.update(hip, true);
+    EXPECT_TRUE(cache.isKnownAbsent(hip));
+
+    // Installing the adapter where the OS looks for it invalidates the entry.
+    ASSERT_TRUE(fs::create_directories(libDir));
+    std::ofstream(libDir / hip.front()) << "adapter";
+    EXPECT_FALSE(cache.isKnownAbsent(hip));
+
+    if (savedSearchPath) {
+        setenv("LD_LIBRARY_PATH", savedSearchPath->c_str(), 1);
+    } else {
+        unsetenv("LD_LIBRARY_PATH");
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the startup cost of the loader with the adapters loaded by
+// urLoaderInit and with UR_ADAPTERS_LAZY_LOAD: the time spent in urLoaderInit,
+// the time until the first urAdapterGet has returned the adapters, and the
+// resident memory of the process at that point. Each measurement runs in a
+// fresh process, since libraries unloaded by urLoaderTearDown don't always
+// leave the process.
+//
+// The adapters found are those the loader would find for the application,
+// set ONEAPI_DEVICE_SELECTOR to see the effect of selecting one backend.
+//
+// Usage: bench-loader-startup [numRuns]
+
+#include <ur_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+struct measurement {
+    double initUs = 0;
+    double firstAdapterGetUs = 0;
+    uint32_t numAdapters = 0;
+    long rssKiB = 0;
+};
+
+long residentKiB() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::stol(line.substr(6));
+        }
+    }
+    return 0;
+}
+
+measurement measureOnce() {
+    using clock = std::chrono::steady_clock;
+    using us = std::chrono::duration<double, std::micro>;
+    measurement result;
+    auto start = clock::now();
+    if (urLoaderInit(0, nullptr) != UR_RESULT_SUCCESS) {
+        std::exit(1);
+    }
+    auto initialized = clock::now();
+    uint32_t numAdapters = 0;
+    urAdapterGet(0, nullptr, &numAdapters);
+    std::vector<ur_adapter_handle_t> adapters(numAdapters);
+    if (numAdapters) {
+        urAdapterGet(numAdapters, adapters.data(), nullptr);
+    }
+    auto done = clock::now();
+
+    result.initUs = us(initialized - start).count();
+    result.firstAdapterGetUs = us(done - start).count();
+    result.numAdapters = numAdapters;
+    result.rssKiB = residentKiB();
+
+    for (auto adapter : adapters) {
+        urAdapterRelease(adapter);
+    }
+    urLoaderTearDown();
+    return result;
+}
+
+// Runs measureOnce in a child process with UR_ADAPTERS_LAZY_LOAD set to lazy.
+measurement measureInChild(bool lazy) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        std::perror("pipe");
+        std::exit(1);
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        setenv("UR_ADAPTERS_LAZY_LOAD", lazy ? "1" : "0", 1);
+        measurement result = measureOnce();
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == sizeof(result) ? 0 : 1);
+    }
+    close(fds[1]);
+    measurement result;
+    ssize_t got = read(fds[0], &result, sizeof(result));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (got != sizeof(result) || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+        std::fprintf(stderr, "measurement failed\n");
+        std::exit(1);
+    }
+    return result;
+}
+
+template <typename T> T median(std::vector<T> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void report(const char *mode, size_t numRuns) {
+    std::vector<double> init, firstGet;
+    std::vector<long> rss;
+    uint32_t numAdapters = 0;
+    for (size_t i = 0; i < numRuns; i++) {
+        auto m = measureInChild(mode[0] == 'l');
+        init.push_back(m.initUs);
+        firstGet.push_back(m.firstAdapterGetUs);
+        rss.push_back(m.rssKiB);
+        numAdapters = m.numAdapters;
+    }
+    std::printf("%-6s %10.1f %18.1f %10ld %9u\n", mode, median(init),
+                median(firstGet), median(rss), numAdapters);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t numRuns = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 11;
+    if (numRuns == 0) {
+        numRuns = 1;
+    }
+    std::printf("median of %zu runs\n", numRuns);
+    std::printf("%-6s %10s %18s %10s %9s\n", "mode", "init (us)",
+                "first get (us)", "RSS (KiB)", "adapters");
+    report("eager", numRuns);
+    report("lazy", numRuns);
+    return 0;
+}
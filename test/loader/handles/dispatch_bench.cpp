@@ -0,0 +1,172 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the cost of a few API calls with each way the loader can dispatch
+// them: straight to the adapter's DDI tables, through the loader's DDIs with
+// tagged handles, and through the loader's DDIs with every handle wrapped.
+// Each way runs in a fresh process, since the dispatch is chosen when the
+// loader is initialized.
+//
+// Usage, with the mock adapter:
+//   UR_ADAPTERS_FORCE_LOAD=<mock adapter> bench-loader-dispatch [calls] [runs]
+
+#include <ur_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+struct measurement {
+    double retainReleaseNs = 0;
+    double launchNs = 0;
+    double launchWithEventNs = 0;
+};
+
+void check(ur_result_t result, const char *call) {
+    if (result != UR_RESULT_SUCCESS) {
+        std::fprintf(stderr, "%s failed with %d\n", call, result);
+        std::exit(1);
+    }
+}
+
+#define CHECK(call) check(call, #call)
+
+template <typename F> double nsPerCall(size_t calls, F &&f) {
+    for (size_t i = 0; i < calls / 10; i++) {
+        f();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < calls; i++) {
+        f();
+    }
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / calls;
+}
+
+measurement measureOnce(size_t calls) {
+    CHECK(urLoaderInit(0, nullptr));
+    ur_adapter_handle_t adapter = nullptr;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context = nullptr;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue = nullptr;
+    CHECK(urQueueCreate(context, device, nullptr, &queue));
+    const unsigned char il[4] = {};
+    ur_program_handle_t program = nullptr;
+    CHECK(urProgramCreateWithIL(context, il, sizeof(il), nullptr, &program));
+    ur_kernel_handle_t kernel = nullptr;
+    CHECK(urKernelCreate(program, "kernel", &kernel));
+    ur_event_handle_t waitEvent = nullptr;
+    CHECK(urEnqueueEventsWait(queue, 0, nullptr, &waitEvent));
+
+    const size_t offset = 0;
+    const size_t size = 1024;
+    measurement result;
+    result.retainReleaseNs = nsPerCall(calls, [&] {
+        urContextRetain(context);
+        urContextRelease(context);
+    });
+    result.launchNs = nsPerCall(calls, [&] {
+        urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size, nullptr, 1,
+                              &waitEvent, nullptr);
+    });
+    result.launchWithEventNs = nsPerCall(calls, [&] {
+        ur_event_handle_t event = nullptr;
+        urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size, nullptr, 1,
+                              &waitEvent, &event);
+        urEventRelease(event);
+    });
+
+    CHECK(urEventRelease(waitEvent));
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urQueueRelease(queue));
+    CHECK(urContextRelease(context));
+    CHECK(urDeviceRelease(device));
+    CHECK(urAdapterRelease(adapter));
+    CHECK(urLoaderTearDown());
+    return result;
+}
+
+// Runs measureOnce in a child process with the environment of a dispatch.
+measurement measureInChild(size_t calls, bool intercept, bool tags) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        std::perror("pipe");
+        std::exit(1);
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        setenv("UR_ENABLE_LOADER_INTERCEPT", intercept ? "1" : "0", 1);
+        setenv("UR_DISABLE_LOADER_HANDLE_TAGS", tags ? "0" : "1", 1);
+        measurement result = measureOnce(calls);
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == sizeof(result) ? 0 : 1);
+    }
+    close(fds[1]);
+    measurement result;
+    ssize_t got = read(fds[0], &result, sizeof(result));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (got != sizeof(result) || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+        std::fprintf(stderr, "measurement failed\n");
+        std::exit(1);
+    }
+    return result;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void report(const char *dispatch, size_t calls, size_t numRuns, bool intercept,
+            bool tags) {
+    std::vector<double> retainRelease, launch, launchWithEvent;
+    for (size_t i = 0; i < numRuns; i++) {
+        auto m = measureInChild(calls, intercept, tags);
+        retainRelease.push_back(m.retainReleaseNs);
+        launch.push_back(m.launchNs);
+        launchWithEvent.push_back(m.launchWithEventNs);
+    }
+    std::printf("%-10s %16.1f %12.1f %20.1f\n", dispatch,
+                median(retainRelease), median(launch),
+                median(launchWithEvent));
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t calls = argc > 1 ? std::strtoul(argv[1], nullptr, 0) : 0;
+    size_t numRuns = argc > 2 ? std::strtoul(argv[2], nullptr, 0) : 0;
+    if (calls == 0) {
+        calls = 1000000;
+    }
+    if (numRuns == 0) {
+        numRuns = 5;
+    }
+    std::printf("ns per call, median of %zu runs of %zu calls\n", numRuns,
+                calls);
+    std::printf("%-10s %16s %12s %20s\n", "dispatch", "retain+release",
+                "launch", "launch+event+release");
+    report("direct", calls, numRuns, false, false);
+    report("tagged", calls, numRuns, true, true);
+    report("wrapped", calls, numRuns, true, false);
+    return 0;
+}
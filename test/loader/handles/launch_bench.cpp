@@ -0,0 +1,134 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how kernel launches returning an event scale with the number of
+// submitting threads when the loader intercepts the calls, and so creates a
+// loader handle for every event. Each thread launches on its own queue and
+// releases the event right away.
+//
+// Usage, with the mock adapter:
+//   UR_ENABLE_LOADER_INTERCEPT=1 UR_ADAPTERS_FORCE_LOAD=<mock adapter> \
+//   bench-loader-launch [launchesPerThread] [maxThreads]
+
+#include <ur_api.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void check(ur_result_t result, const char *call) {
+    if (result != UR_RESULT_SUCCESS) {
+        std::fprintf(stderr, "%s failed with %d\n", call, result);
+        std::exit(1);
+    }
+}
+
+#define CHECK(call) check(call, #call)
+
+double launchesPerSecond(ur_context_handle_t context, ur_device_handle_t device,
+                         ur_kernel_handle_t kernel, unsigned numThreads,
+                         size_t launchesPerThread) {
+    std::vector<ur_queue_handle_t> queues(numThreads);
+    for (auto &queue : queues) {
+        CHECK(urQueueCreate(context, device, nullptr, &queue));
+    }
+
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, queue = queues[t]] {
+            const size_t offset = 0;
+            const size_t size = 1024;
+            ready++;
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < launchesPerThread; i++) {
+                ur_event_handle_t event = nullptr;
+                CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                            nullptr, 0, nullptr, &event));
+                CHECK(urEventRelease(event));
+            }
+        });
+    }
+
+    while (ready != numThreads) {
+        std::this_thread::yield();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - begin;
+
+    for (auto queue : queues) {
+        CHECK(urQueueRelease(queue));
+    }
+    return numThreads * launchesPerThread / elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    size_t launchesPerThread = argc > 1 ? std::strtoul(argv[1], nullptr, 0) : 0;
+    unsigned maxThreads = argc > 2 ? std::strtoul(argv[2], nullptr, 0) : 0;
+    if (launchesPerThread == 0) {
+        launchesPerThread = 200000;
+    }
+    if (maxThreads == 0) {
+        maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    CHECK(urLoaderInit(0, nullptr));
+    ur_adapter_handle_t adapter = nullptr;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context = nullptr;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    const unsigned char il[4] = {};
+    ur_program_handle_t program = nullptr;
+    CHECK(urProgramCreateWithIL(context, il, sizeof(il), nullptr, &program));
+    ur_kernel_handle_t kernel = nullptr;
+    CHECK(urKernelCreate(program, "kernel", &kernel));
+
+    // Warms up the loader and the allocator.
+    launchesPerSecond(context, device, kernel, 1, launchesPerThread / 10);
+
+    std::printf("%8s %16s %14s %10s\n", "threads", "launches/s", "ns/launch",
+                "speedup");
+    double single = 0;
+    for (unsigned numThreads = 1; numThreads <= maxThreads;
+         numThreads = numThreads < maxThreads
+                          ? std::min(2 * numThreads, maxThreads)
+                          : numThreads + 1) {
+        double rate = launchesPerSecond(context, device, kernel, numThreads,
+                                        launchesPerThread);
+        if (numThreads == 1) {
+            single = rate;
+        }
+        std::printf("%8u %16.0f %14.1f %10.2f\n", numThreads, rate,
+                    1e9 * numThreads / rate, rate / single);
+    }
+
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urContextRelease(context));
+    CHECK(urDeviceRelease(device));
+    CHECK(urAdapterRelease(adapter));
+    CHECK(urLoaderTearDown());
+    return 0;
+}
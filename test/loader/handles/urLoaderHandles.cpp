@@ -7,6 +7,7 @@
 #include "ur_api.h"
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <gtest/gtest.h>
 
 TEST_F(LoaderHandleTest, Success) {
@@ -39,3 +40,25 @@ TEST_F(LoaderHandleTest, SuccessArraySizeRet) {
     ASSERT_EQ(query_platform[0], platform);
     ASSERT_EQ(query_platform[1], (ur_platform_handle_t)0xBEEF);
 }
+
+TEST_F(LoaderHandleTest, TaggedHandles) {
+    // The mock adapter returns 0x1 and 0x2 for the platform and the device,
+    // which can't be tagged, so the loader wraps them. Contexts are heap
+    // objects, handed out with a tag unless the loader has been told to wrap
+    // all the handles.
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(platform) & 0x7, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(device) & 0x7, 0u);
+
+    ur_context_handle_t context = nullptr;
+    ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+    ASSERT_NE(context, nullptr);
+    const bool wrapped = std::getenv("UR_DISABLE_LOADER_HANDLE_TAGS");
+    ASSERT_EQ((reinterpret_cast<uintptr_t>(context) & 0x7) == 0, wrapped);
+
+    ASSERT_SUCCESS(urContextRetain(context));
+    ASSERT_SUCCESS(urContextRelease(context));
+    uint32_t numDevices = 0;
+    ASSERT_SUCCESS(urContextGetInfo(context, UR_CONTEXT_INFO_NUM_DEVICES,
+                                    sizeof(numDevices), &numDevices, nullptr));
+    ASSERT_SUCCESS(urContextRelease(context));
+}
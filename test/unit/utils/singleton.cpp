@@ -0,0 +1,130 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ur_singleton.hpp"
+
+namespace {
+
+struct handle_t_ {};
+using handle_t = handle_t_ *;
+
+std::atomic<int> liveObjects{0};
+
+struct object_t {
+    object_t(handle_t handle, int value) : handle(handle), value(value) {
+        liveObjects++;
+    }
+    ~object_t() { liveObjects--; }
+
+    handle_t handle;
+    int value;
+};
+
+using factory_t = singleton_factory_t<object_t, handle_t>;
+
+handle_t makeHandle(uintptr_t i) { return reinterpret_cast<handle_t>(i * 16); }
+
+struct singletonFactoryTest : ::testing::Test {
+    void SetUp() override { liveObjects = 0; }
+};
+
+} // namespace
+
+TEST_F(singletonFactoryTest, SameKeySameInstance) {
+    factory_t factory;
+    auto *first = factory.getInstance(makeHandle(1), 1);
+    auto *second = factory.getInstance(makeHandle(1), 2);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(first->handle, makeHandle(1));
+    ASSERT_EQ(first->value, 1);
+    ASSERT_NE(factory.getInstance(makeHandle(2), 2), first);
+    ASSERT_EQ(liveObjects, 2);
+}
+
+TEST_F(singletonFactoryTest, NullKey) {
+    factory_t factory;
+    ASSERT_EQ(factory.getInstance(nullptr, 1), nullptr);
+    ASSERT_EQ(liveObjects, 0);
+}
+
+TEST_F(singletonFactoryTest, ReleaseRecyclesStorage) {
+    factory_t factory;
+    auto *first = factory.getInstance(makeHandle(1), 1);
+    factory.release(makeHandle(1));
+    ASSERT_EQ(liveObjects, 0);
+    // Releasing an unknown key does nothing.
+    factory.release(makeHandle(1));
+
+    auto *second = factory.getInstance(makeHandle(1), 2);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(second->value, 2);
+    ASSERT_EQ(liveObjects, 1);
+}
+
+TEST_F(singletonFactoryTest, ClearAndDestroy) {
+    {
+        factory_t factory;
+        for (uintptr_t i = 1; i <= 1000; i++) {
+            factory.getInstance(makeHandle(i), 0);
+        }
+        ASSERT_EQ(liveObjects, 1000);
+        factory.clear();
+        ASSERT_EQ(liveObjects, 0);
+
+        for (uintptr_t i = 1; i <= 100; i++) {
+            ASSERT_EQ(factory.getInstance(makeHandle(i), int(i))->value,
+                      int(i));
+        }
+        ASSERT_EQ(liveObjects, 100);
+    }
+    ASSERT_EQ(liveObjects, 0);
+}
+
+TEST_F(singletonFactoryTest, Concurrent) {
+    constexpr int numThreads = 8;
+    constexpr uintptr_t numShared = 1000;
+    constexpr uintptr_t numOwn = 1000;
+    constexpr int iterations = 10;
+
+    factory_t factory;
+    std::vector<std::vector<object_t *>> shared(numThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t] {
+            for (uintptr_t i = 1; i <= numShared; i++) {
+                shared[t].push_back(factory.getInstance(makeHandle(i), t));
+            }
+            // Keys only used by this thread, created and released over and
+            // over.
+            for (int iter = 0; iter < iterations; iter++) {
+                for (uintptr_t i = 0; i < numOwn; i++) {
+                    auto handle = makeHandle(numShared + 1 + t * numOwn + i);
+                    auto *object = factory.getInstance(handle, iter);
+                    EXPECT_EQ(object->handle, handle);
+                    EXPECT_EQ(object->value, iter);
+                }
+                for (uintptr_t i = 0; i < numOwn; i++) {
+                    factory.release(makeHandle(numShared + 1 + t * numOwn + i));
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 1; t < numThreads; t++) {
+        ASSERT_EQ(shared[t], shared[0]);
+    }
+    ASSERT_EQ(liveObjects, int(numShared));
+}